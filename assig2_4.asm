@@ -0,0 +1,1232 @@
+
+_assig2_4:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// Total no of processes spawned = 5
+// No of non-schedulable processes = 1
+// Process with pids 6 is non-schedulable
+// Processes with pid 4 and 5 have same deadline
+int main(int argc, char *argv[])
+{   
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 2c             	sub    $0x2c,%esp
+    int num_procs = 4;
+    int deadline_value[4] = {20, 20, 24, 52};
+  13:	c7 45 c8 14 00 00 00 	movl   $0x14,-0x38(%ebp)
+  1a:	c7 45 cc 14 00 00 00 	movl   $0x14,-0x34(%ebp)
+  21:	c7 45 d0 18 00 00 00 	movl   $0x18,-0x30(%ebp)
+  28:	c7 45 d4 34 00 00 00 	movl   $0x34,-0x2c(%ebp)
+    int exectime[4] = {8, 4, 5, 4};
+  2f:	c7 45 d8 08 00 00 00 	movl   $0x8,-0x28(%ebp)
+  36:	c7 45 dc 04 00 00 00 	movl   $0x4,-0x24(%ebp)
+  3d:	c7 45 e0 05 00 00 00 	movl   $0x5,-0x20(%ebp)
+  44:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+
+    int parent_pid = getpid();
+  4b:	e8 33 03 00 00       	call   383 <getpid>
+
+    // Set the scheduling policy to EDF
+    deadline(parent_pid, 19);
+  50:	83 ec 08             	sub    $0x8,%esp
+  53:	6a 13                	push   $0x13
+    int parent_pid = getpid();
+  55:	89 c3                	mov    %eax,%ebx
+    deadline(parent_pid, 19);
+  57:	50                   	push   %eax
+  58:	e8 5e 03 00 00       	call   3bb <deadline>
+    exec_time(parent_pid, 6);
+  5d:	58                   	pop    %eax
+  5e:	5a                   	pop    %edx
+  5f:	6a 06                	push   $0x6
+  61:	53                   	push   %ebx
+  62:	e8 4c 03 00 00       	call   3b3 <exec_time>
+    sched_policy(parent_pid, 0);
+  67:	59                   	pop    %ecx
+  68:	5e                   	pop    %esi
+  69:	6a 00                	push   $0x0
+  6b:	53                   	push   %ebx
+
+    for(int i = 0; i < num_procs; i++)
+  6c:	31 f6                	xor    %esi,%esi
+    sched_policy(parent_pid, 0);
+  6e:	e8 38 03 00 00       	call   3ab <sched_policy>
+  73:	83 c4 10             	add    $0x10,%esp
+    {
+        int cid = fork();
+  76:	e8 80 02 00 00       	call   2fb <fork>
+  7b:	89 c3                	mov    %eax,%ebx
+        if (cid != 0)
+  7d:	85 c0                	test   %eax,%eax
+  7f:	74 30                	je     b1 <main+0xb1>
+        {
+            // Set the scheduling policy to EDF
+            deadline(cid, deadline_value[i]);
+  81:	83 ec 08             	sub    $0x8,%esp
+  84:	ff 74 b5 c8          	push   -0x38(%ebp,%esi,4)
+  88:	50                   	push   %eax
+  89:	e8 2d 03 00 00       	call   3bb <deadline>
+            exec_time(cid, exectime[i]);
+  8e:	58                   	pop    %eax
+  8f:	5a                   	pop    %edx
+  90:	ff 74 b5 d8          	push   -0x28(%ebp,%esi,4)
+  94:	53                   	push   %ebx
+    for(int i = 0; i < num_procs; i++)
+  95:	83 c6 01             	add    $0x1,%esi
+            exec_time(cid, exectime[i]);
+  98:	e8 16 03 00 00       	call   3b3 <exec_time>
+            sched_policy(cid, 0);
+  9d:	59                   	pop    %ecx
+  9e:	58                   	pop    %eax
+  9f:	6a 00                	push   $0x0
+  a1:	53                   	push   %ebx
+  a2:	e8 04 03 00 00       	call   3ab <sched_policy>
+    for(int i = 0; i < num_procs; i++)
+  a7:	83 c4 10             	add    $0x10,%esp
+  aa:	83 fe 04             	cmp    $0x4,%esi
+  ad:	75 c7                	jne    76 <main+0x76>
+                
+            }
+        }
+    }
+
+    while(1) {
+  af:	eb fe                	jmp    af <main+0xaf>
+            while(1) {
+  b1:	eb fe                	jmp    b1 <main+0xb1>
+  b3:	66 90                	xchg   %ax,%ax
+  b5:	66 90                	xchg   %ax,%ax
+  b7:	66 90                	xchg   %ax,%ax
+  b9:	66 90                	xchg   %ax,%ax
+  bb:	66 90                	xchg   %ax,%ax
+  bd:	66 90                	xchg   %ax,%ax
+  bf:	90                   	nop
+
+000000c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  c1:	31 c0                	xor    %eax,%eax
+{
+  c3:	89 e5                	mov    %esp,%ebp
+  c5:	53                   	push   %ebx
+  c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  d7:	83 c0 01             	add    $0x1,%eax
+  da:	84 d2                	test   %dl,%dl
+  dc:	75 f2                	jne    d0 <strcpy+0x10>
+    ;
+  return os;
+}
+  de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e1:	89 c8                	mov    %ecx,%eax
+  e3:	c9                   	leave
+  e4:	c3                   	ret
+  e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	53                   	push   %ebx
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  fa:	0f b6 02             	movzbl (%edx),%eax
+  fd:	84 c0                	test   %al,%al
+  ff:	75 17                	jne    118 <strcmp+0x28>
+ 101:	eb 3a                	jmp    13d <strcmp+0x4d>
+ 103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 107:	90                   	nop
+ 108:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 10c:	83 c2 01             	add    $0x1,%edx
+ 10f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 112:	84 c0                	test   %al,%al
+ 114:	74 1a                	je     130 <strcmp+0x40>
+    p++, q++;
+ 116:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 118:	0f b6 19             	movzbl (%ecx),%ebx
+ 11b:	38 c3                	cmp    %al,%bl
+ 11d:	74 e9                	je     108 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 11f:	29 d8                	sub    %ebx,%eax
+}
+ 121:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 124:	c9                   	leave
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 130:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 134:	31 c0                	xor    %eax,%eax
+ 136:	29 d8                	sub    %ebx,%eax
+}
+ 138:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 13b:	c9                   	leave
+ 13c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 13d:	0f b6 19             	movzbl (%ecx),%ebx
+ 140:	31 c0                	xor    %eax,%eax
+ 142:	eb db                	jmp    11f <strcmp+0x2f>
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 156:	80 3a 00             	cmpb   $0x0,(%edx)
+ 159:	74 15                	je     170 <strlen+0x20>
+ 15b:	31 c0                	xor    %eax,%eax
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+ 160:	83 c0 01             	add    $0x1,%eax
+ 163:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 167:	89 c1                	mov    %eax,%ecx
+ 169:	75 f5                	jne    160 <strlen+0x10>
+    ;
+  return n;
+}
+ 16b:	89 c8                	mov    %ecx,%eax
+ 16d:	5d                   	pop    %ebp
+ 16e:	c3                   	ret
+ 16f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 170:	31 c9                	xor    %ecx,%ecx
+}
+ 172:	5d                   	pop    %ebp
+ 173:	89 c8                	mov    %ecx,%eax
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000180 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 187:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 18a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18d:	89 d7                	mov    %edx,%edi
+ 18f:	fc                   	cld
+ 190:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 192:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 195:	89 d0                	mov    %edx,%eax
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1aa:	0f b6 10             	movzbl (%eax),%edx
+ 1ad:	84 d2                	test   %dl,%dl
+ 1af:	75 12                	jne    1c3 <strchr+0x23>
+ 1b1:	eb 1d                	jmp    1d0 <strchr+0x30>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1bc:	83 c0 01             	add    $0x1,%eax
+ 1bf:	84 d2                	test   %dl,%dl
+ 1c1:	74 0d                	je     1d0 <strchr+0x30>
+    if(*s == c)
+ 1c3:	38 d1                	cmp    %dl,%cl
+ 1c5:	75 f1                	jne    1b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1c7:	5d                   	pop    %ebp
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1d0:	31 c0                	xor    %eax,%eax
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1e9:	31 db                	xor    %ebx,%ebx
+{
+ 1eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ee:	eb 27                	jmp    217 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	6a 01                	push   $0x1
+ 1f5:	56                   	push   %esi
+ 1f6:	6a 00                	push   $0x0
+ 1f8:	e8 1e 01 00 00       	call   31b <read>
+    if(cc < 1)
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	85 c0                	test   %eax,%eax
+ 202:	7e 1d                	jle    221 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 204:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 208:	8b 55 08             	mov    0x8(%ebp),%edx
+ 20b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 20f:	3c 0a                	cmp    $0xa,%al
+ 211:	74 10                	je     223 <gets+0x43>
+ 213:	3c 0d                	cmp    $0xd,%al
+ 215:	74 0c                	je     223 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 217:	89 df                	mov    %ebx,%edi
+ 219:	83 c3 01             	add    $0x1,%ebx
+ 21c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21f:	7c cf                	jl     1f0 <gets+0x10>
+ 221:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 22a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22d:	5b                   	pop    %ebx
+ 22e:	5e                   	pop    %esi
+ 22f:	5f                   	pop    %edi
+ 230:	5d                   	pop    %ebp
+ 231:	c3                   	ret
+ 232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 245:	83 ec 08             	sub    $0x8,%esp
+ 248:	6a 00                	push   $0x0
+ 24a:	ff 75 08             	push   0x8(%ebp)
+ 24d:	e8 f1 00 00 00       	call   343 <open>
+  if(fd < 0)
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	78 27                	js     280 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 259:	83 ec 08             	sub    $0x8,%esp
+ 25c:	ff 75 0c             	push   0xc(%ebp)
+ 25f:	89 c3                	mov    %eax,%ebx
+ 261:	50                   	push   %eax
+ 262:	e8 f4 00 00 00       	call   35b <fstat>
+  close(fd);
+ 267:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 26a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 26c:	e8 ba 00 00 00       	call   32b <close>
+  return r;
+ 271:	83 c4 10             	add    $0x10,%esp
+}
+ 274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 277:	89 f0                	mov    %esi,%eax
+ 279:	5b                   	pop    %ebx
+ 27a:	5e                   	pop    %esi
+ 27b:	5d                   	pop    %ebp
+ 27c:	c3                   	ret
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 285:	eb ed                	jmp    274 <stat+0x34>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+
+00000290 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 297:	0f be 02             	movsbl (%edx),%eax
+ 29a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 29d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2a5:	77 1e                	ja     2c5 <atoi+0x35>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2b0:	83 c2 01             	add    $0x1,%edx
+ 2b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ba:	0f be 02             	movsbl (%edx),%eax
+ 2bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2c0:	80 fb 09             	cmp    $0x9,%bl
+ 2c3:	76 eb                	jbe    2b0 <atoi+0x20>
+  return n;
+}
+ 2c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c8:	89 c8                	mov    %ecx,%eax
+ 2ca:	c9                   	leave
+ 2cb:	c3                   	ret
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+ 2d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2de:	85 c0                	test   %eax,%eax
+ 2e0:	7e 13                	jle    2f5 <memmove+0x25>
+ 2e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2e4:	89 d7                	mov    %edx,%edi
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2f1:	39 f8                	cmp    %edi,%eax
+ 2f3:	75 fb                	jne    2f0 <memmove+0x20>
+  return vdst;
+}
+ 2f5:	5e                   	pop    %esi
+ 2f6:	89 d0                	mov    %edx,%eax
+ 2f8:	5f                   	pop    %edi
+ 2f9:	5d                   	pop    %ebp
+ 2fa:	c3                   	ret
+
+000002fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <exit>:
+SYSCALL(exit)
+ 303:	b8 02 00 00 00       	mov    $0x2,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <wait>:
+SYSCALL(wait)
+ 30b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <pipe>:
+SYSCALL(pipe)
+ 313:	b8 04 00 00 00       	mov    $0x4,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <read>:
+SYSCALL(read)
+ 31b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <write>:
+SYSCALL(write)
+ 323:	b8 10 00 00 00       	mov    $0x10,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <close>:
+SYSCALL(close)
+ 32b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <kill>:
+SYSCALL(kill)
+ 333:	b8 06 00 00 00       	mov    $0x6,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <exec>:
+SYSCALL(exec)
+ 33b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <open>:
+SYSCALL(open)
+ 343:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <mknod>:
+SYSCALL(mknod)
+ 34b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <unlink>:
+SYSCALL(unlink)
+ 353:	b8 12 00 00 00       	mov    $0x12,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <fstat>:
+SYSCALL(fstat)
+ 35b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <link>:
+SYSCALL(link)
+ 363:	b8 13 00 00 00       	mov    $0x13,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <mkdir>:
+SYSCALL(mkdir)
+ 36b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <chdir>:
+SYSCALL(chdir)
+ 373:	b8 09 00 00 00       	mov    $0x9,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <dup>:
+SYSCALL(dup)
+ 37b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <getpid>:
+SYSCALL(getpid)
+ 383:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <sbrk>:
+SYSCALL(sbrk)
+ 38b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <sleep>:
+SYSCALL(sleep)
+ 393:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <uptime>:
+SYSCALL(uptime)
+ 39b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <printinfo>:
+SYSCALL(printinfo)
+ 3a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <sched_policy>:
+SYSCALL(sched_policy)
+ 3ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <exec_time>:
+SYSCALL(exec_time)
+ 3b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <deadline>:
+SYSCALL(deadline)
+ 3bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <rate>:
+SYSCALL(rate)
+ 3c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mmap>:
+SYSCALL(mmap)
+ 3cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <munmap>:
+SYSCALL(munmap)
+ 3d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <bcstat>:
+SYSCALL(bcstat)
+ 3db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <splice>:
+SYSCALL(splice)
+ 3e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+ 3eb:	66 90                	xchg   %ax,%ax
+ 3ed:	66 90                	xchg   %ax,%ax
+ 3ef:	90                   	nop
+
+000003f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	53                   	push   %ebx
+ 3f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3f8:	89 d1                	mov    %edx,%ecx
+{
+ 3fa:	83 ec 3c             	sub    $0x3c,%esp
+ 3fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 400:	85 d2                	test   %edx,%edx
+ 402:	0f 89 80 00 00 00    	jns    488 <printint+0x98>
+ 408:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 40c:	74 7a                	je     488 <printint+0x98>
+    x = -xx;
+ 40e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 410:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 415:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 418:	31 f6                	xor    %esi,%esi
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 420:	89 c8                	mov    %ecx,%eax
+ 422:	31 d2                	xor    %edx,%edx
+ 424:	89 f7                	mov    %esi,%edi
+ 426:	f7 f3                	div    %ebx
+ 428:	8d 76 01             	lea    0x1(%esi),%esi
+ 42b:	0f b6 92 18 08 00 00 	movzbl 0x818(%edx),%edx
+ 432:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 436:	89 ca                	mov    %ecx,%edx
+ 438:	89 c1                	mov    %eax,%ecx
+ 43a:	39 da                	cmp    %ebx,%edx
+ 43c:	73 e2                	jae    420 <printint+0x30>
+  if(neg)
+ 43e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 441:	85 c0                	test   %eax,%eax
+ 443:	74 07                	je     44c <printint+0x5c>
+    buf[i++] = '-';
+ 445:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 44a:	89 f7                	mov    %esi,%edi
+ 44c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 44f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 452:	01 df                	add    %ebx,%edi
+ 454:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 458:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 45b:	83 ec 04             	sub    $0x4,%esp
+ 45e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 461:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 464:	6a 01                	push   $0x1
+ 466:	50                   	push   %eax
+ 467:	56                   	push   %esi
+ 468:	e8 b6 fe ff ff       	call   323 <write>
+  while(--i >= 0)
+ 46d:	89 f8                	mov    %edi,%eax
+ 46f:	83 c4 10             	add    $0x10,%esp
+ 472:	83 ef 01             	sub    $0x1,%edi
+ 475:	39 d8                	cmp    %ebx,%eax
+ 477:	75 df                	jne    458 <printint+0x68>
+}
+ 479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 47c:	5b                   	pop    %ebx
+ 47d:	5e                   	pop    %esi
+ 47e:	5f                   	pop    %edi
+ 47f:	5d                   	pop    %ebp
+ 480:	c3                   	ret
+ 481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 488:	31 c0                	xor    %eax,%eax
+ 48a:	eb 89                	jmp    415 <printint+0x25>
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 499:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 49c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 49f:	0f b6 1e             	movzbl (%esi),%ebx
+ 4a2:	83 c6 01             	add    $0x1,%esi
+ 4a5:	84 db                	test   %bl,%bl
+ 4a7:	74 67                	je     510 <printf+0x80>
+ 4a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4ac:	31 d2                	xor    %edx,%edx
+ 4ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4b1:	eb 34                	jmp    4e7 <printf+0x57>
+ 4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4b7:	90                   	nop
+ 4b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4c0:	83 f8 25             	cmp    $0x25,%eax
+ 4c3:	74 18                	je     4dd <printf+0x4d>
+  write(fd, &c, 1);
+ 4c5:	83 ec 04             	sub    $0x4,%esp
+ 4c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ce:	6a 01                	push   $0x1
+ 4d0:	50                   	push   %eax
+ 4d1:	57                   	push   %edi
+ 4d2:	e8 4c fe ff ff       	call   323 <write>
+ 4d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 4e0:	83 c6 01             	add    $0x1,%esi
+ 4e3:	84 db                	test   %bl,%bl
+ 4e5:	74 29                	je     510 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ea:	85 d2                	test   %edx,%edx
+ 4ec:	74 ca                	je     4b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4ee:	83 fa 25             	cmp    $0x25,%edx
+ 4f1:	75 ea                	jne    4dd <printf+0x4d>
+      if(c == 'd'){
+ 4f3:	83 f8 25             	cmp    $0x25,%eax
+ 4f6:	0f 84 24 01 00 00    	je     620 <printf+0x190>
+ 4fc:	83 e8 63             	sub    $0x63,%eax
+ 4ff:	83 f8 15             	cmp    $0x15,%eax
+ 502:	77 1c                	ja     520 <printf+0x90>
+ 504:	ff 24 85 c0 07 00 00 	jmp    *0x7c0(,%eax,4)
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 510:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 513:	5b                   	pop    %ebx
+ 514:	5e                   	pop    %esi
+ 515:	5f                   	pop    %edi
+ 516:	5d                   	pop    %ebp
+ 517:	c3                   	ret
+ 518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+  write(fd, &c, 1);
+ 520:	83 ec 04             	sub    $0x4,%esp
+ 523:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 526:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 52a:	6a 01                	push   $0x1
+ 52c:	52                   	push   %edx
+ 52d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 530:	57                   	push   %edi
+ 531:	e8 ed fd ff ff       	call   323 <write>
+ 536:	83 c4 0c             	add    $0xc,%esp
+ 539:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 53c:	6a 01                	push   $0x1
+ 53e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 541:	52                   	push   %edx
+ 542:	57                   	push   %edi
+ 543:	e8 db fd ff ff       	call   323 <write>
+        putc(fd, c);
+ 548:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 54b:	31 d2                	xor    %edx,%edx
+ 54d:	eb 8e                	jmp    4dd <printf+0x4d>
+ 54f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 550:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 553:	83 ec 0c             	sub    $0xc,%esp
+ 556:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 55b:	8b 13                	mov    (%ebx),%edx
+ 55d:	6a 00                	push   $0x0
+ 55f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 561:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 564:	e8 87 fe ff ff       	call   3f0 <printint>
+        ap++;
+ 569:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 56c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 56f:	31 d2                	xor    %edx,%edx
+ 571:	e9 67 ff ff ff       	jmp    4dd <printf+0x4d>
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 580:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 583:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 585:	83 c0 04             	add    $0x4,%eax
+ 588:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 58b:	85 db                	test   %ebx,%ebx
+ 58d:	0f 84 9d 00 00 00    	je     630 <printf+0x1a0>
+        while(*s != 0){
+ 593:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 596:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 598:	84 c0                	test   %al,%al
+ 59a:	0f 84 3d ff ff ff    	je     4dd <printf+0x4d>
+ 5a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5a6:	89 de                	mov    %ebx,%esi
+ 5a8:	89 d3                	mov    %edx,%ebx
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5b0:	83 ec 04             	sub    $0x4,%esp
+ 5b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5b9:	6a 01                	push   $0x1
+ 5bb:	53                   	push   %ebx
+ 5bc:	57                   	push   %edi
+ 5bd:	e8 61 fd ff ff       	call   323 <write>
+        while(*s != 0){
+ 5c2:	0f b6 06             	movzbl (%esi),%eax
+ 5c5:	83 c4 10             	add    $0x10,%esp
+ 5c8:	84 c0                	test   %al,%al
+ 5ca:	75 e4                	jne    5b0 <printf+0x120>
+      state = 0;
+ 5cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5cf:	31 d2                	xor    %edx,%edx
+ 5d1:	e9 07 ff ff ff       	jmp    4dd <printf+0x4d>
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5e3:	83 ec 0c             	sub    $0xc,%esp
+ 5e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5eb:	8b 13                	mov    (%ebx),%edx
+ 5ed:	6a 01                	push   $0x1
+ 5ef:	e9 6b ff ff ff       	jmp    55f <printf+0xcf>
+ 5f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5fb:	83 ec 04             	sub    $0x4,%esp
+ 5fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 601:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 603:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 606:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 609:	6a 01                	push   $0x1
+ 60b:	52                   	push   %edx
+ 60c:	57                   	push   %edi
+ 60d:	e8 11 fd ff ff       	call   323 <write>
+        ap++;
+ 612:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 615:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 618:	31 d2                	xor    %edx,%edx
+ 61a:	e9 be fe ff ff       	jmp    4dd <printf+0x4d>
+ 61f:	90                   	nop
+  write(fd, &c, 1);
+ 620:	83 ec 04             	sub    $0x4,%esp
+ 623:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 626:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 629:	6a 01                	push   $0x1
+ 62b:	e9 11 ff ff ff       	jmp    541 <printf+0xb1>
+ 630:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 635:	bb b8 07 00 00       	mov    $0x7b8,%ebx
+ 63a:	e9 61 ff ff ff       	jmp    5a0 <printf+0x110>
+ 63f:	90                   	nop
+
+00000640 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 640:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 641:	a1 bc 0a 00 00       	mov    0xabc,%eax
+{
+ 646:	89 e5                	mov    %esp,%ebp
+ 648:	57                   	push   %edi
+ 649:	56                   	push   %esi
+ 64a:	53                   	push   %ebx
+ 64b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 64e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 658:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 65a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 65c:	39 ca                	cmp    %ecx,%edx
+ 65e:	73 30                	jae    690 <free+0x50>
+ 660:	39 c1                	cmp    %eax,%ecx
+ 662:	72 04                	jb     668 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 664:	39 c2                	cmp    %eax,%edx
+ 666:	72 f0                	jb     658 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 668:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 66b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 66e:	39 f8                	cmp    %edi,%eax
+ 670:	74 2e                	je     6a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 672:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 675:	8b 42 04             	mov    0x4(%edx),%eax
+ 678:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 67b:	39 f1                	cmp    %esi,%ecx
+ 67d:	74 38                	je     6b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 67f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 681:	5b                   	pop    %ebx
+  freep = p;
+ 682:	89 15 bc 0a 00 00    	mov    %edx,0xabc
+}
+ 688:	5e                   	pop    %esi
+ 689:	5f                   	pop    %edi
+ 68a:	5d                   	pop    %ebp
+ 68b:	c3                   	ret
+ 68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 690:	39 c1                	cmp    %eax,%ecx
+ 692:	72 d0                	jb     664 <free+0x24>
+ 694:	eb c2                	jmp    658 <free+0x18>
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6a0:	03 70 04             	add    0x4(%eax),%esi
+ 6a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6a6:	8b 02                	mov    (%edx),%eax
+ 6a8:	8b 00                	mov    (%eax),%eax
+ 6aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 6b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6b3:	39 f1                	cmp    %esi,%ecx
+ 6b5:	75 c8                	jne    67f <free+0x3f>
+    p->s.size += bp->s.size;
+ 6b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6ba:	89 15 bc 0a 00 00    	mov    %edx,0xabc
+    p->s.size += bp->s.size;
+ 6c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6c6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6c8:	5b                   	pop    %ebx
+ 6c9:	5e                   	pop    %esi
+ 6ca:	5f                   	pop    %edi
+ 6cb:	5d                   	pop    %ebp
+ 6cc:	c3                   	ret
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6dc:	8b 15 bc 0a 00 00    	mov    0xabc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6e2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6e5:	c1 ef 03             	shr    $0x3,%edi
+ 6e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6eb:	85 d2                	test   %edx,%edx
+ 6ed:	0f 84 8d 00 00 00    	je     780 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6f5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6f8:	39 f9                	cmp    %edi,%ecx
+ 6fa:	73 64                	jae    760 <malloc+0x90>
+  if(nu < 4096)
+ 6fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 701:	39 df                	cmp    %ebx,%edi
+ 703:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 706:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 70d:	eb 0a                	jmp    719 <malloc+0x49>
+ 70f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 710:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 712:	8b 48 04             	mov    0x4(%eax),%ecx
+ 715:	39 f9                	cmp    %edi,%ecx
+ 717:	73 47                	jae    760 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 719:	89 c2                	mov    %eax,%edx
+ 71b:	39 05 bc 0a 00 00    	cmp    %eax,0xabc
+ 721:	75 ed                	jne    710 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	56                   	push   %esi
+ 727:	e8 5f fc ff ff       	call   38b <sbrk>
+  if(p == (char*)-1)
+ 72c:	83 c4 10             	add    $0x10,%esp
+ 72f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 732:	74 1c                	je     750 <malloc+0x80>
+  hp->s.size = nu;
+ 734:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 737:	83 ec 0c             	sub    $0xc,%esp
+ 73a:	83 c0 08             	add    $0x8,%eax
+ 73d:	50                   	push   %eax
+ 73e:	e8 fd fe ff ff       	call   640 <free>
+  return freep;
+ 743:	8b 15 bc 0a 00 00    	mov    0xabc,%edx
+      if((p = morecore(nunits)) == 0)
+ 749:	83 c4 10             	add    $0x10,%esp
+ 74c:	85 d2                	test   %edx,%edx
+ 74e:	75 c0                	jne    710 <malloc+0x40>
+        return 0;
+  }
+}
+ 750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 753:	31 c0                	xor    %eax,%eax
+}
+ 755:	5b                   	pop    %ebx
+ 756:	5e                   	pop    %esi
+ 757:	5f                   	pop    %edi
+ 758:	5d                   	pop    %ebp
+ 759:	c3                   	ret
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 760:	39 cf                	cmp    %ecx,%edi
+ 762:	74 4c                	je     7b0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 764:	29 f9                	sub    %edi,%ecx
+ 766:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 769:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 76c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 76f:	89 15 bc 0a 00 00    	mov    %edx,0xabc
+}
+ 775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 778:	83 c0 08             	add    $0x8,%eax
+}
+ 77b:	5b                   	pop    %ebx
+ 77c:	5e                   	pop    %esi
+ 77d:	5f                   	pop    %edi
+ 77e:	5d                   	pop    %ebp
+ 77f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 780:	c7 05 bc 0a 00 00 c0 	movl   $0xac0,0xabc
+ 787:	0a 00 00 
+    base.s.size = 0;
+ 78a:	b8 c0 0a 00 00       	mov    $0xac0,%eax
+    base.s.ptr = freep = prevp = &base;
+ 78f:	c7 05 c0 0a 00 00 c0 	movl   $0xac0,0xac0
+ 796:	0a 00 00 
+    base.s.size = 0;
+ 799:	c7 05 c4 0a 00 00 00 	movl   $0x0,0xac4
+ 7a0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7a3:	e9 54 ff ff ff       	jmp    6fc <malloc+0x2c>
+ 7a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7b0:	8b 08                	mov    (%eax),%ecx
+ 7b2:	89 0a                	mov    %ecx,(%edx)
+ 7b4:	eb b9                	jmp    76f <malloc+0x9f>
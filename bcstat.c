@@ -0,0 +1,45 @@
+// Print buffer cache counters.
+// With arguments, run them as a command and print
+// only what that command did to the cache.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "bcstat.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct bcstat a, b;
+  int pid;
+
+  memset(&a, 0, sizeof(a));
+  if(argc > 1){
+    bcstat(&a);
+    pid = fork();
+    if(pid < 0){
+      printf(2, "bcstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[1], argv+1);
+      printf(2, "bcstat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    wait();
+  }
+  if(bcstat(&b) < 0){
+    printf(2, "bcstat: failed\n");
+    exit();
+  }
+  b.hits -= a.hits;
+  b.misses -= a.misses;
+  b.evicts -= a.evicts;
+  b.aheads -= a.aheads;
+  printf(1, "nbuf %d hot %d hits %d misses %d evicts %d aheads %d",
+         b.nbuf, b.nhot, b.hits, b.misses, b.evicts, b.aheads);
+  if(b.hits + b.misses > 0)
+    printf(1, " hit%% %d", b.hits * 100 / (b.hits + b.misses));
+  printf(1, "\n");
+  exit();
+}
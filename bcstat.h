@@ -0,0 +1,9 @@
+// Buffer cache counters, returned by the bcstat system call.
+struct bcstat {
+  uint nbuf;    // buffers in the cache
+  uint nhot;    // buffers in the hot set
+  uint hits;    // lookups found in the cache
+  uint misses;  // lookups that had to read the disk
+  uint evicts;  // cached blocks dropped to make room
+  uint aheads;  // blocks read ahead
+};
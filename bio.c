@@ -1,22 +1,32 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
-// * After changing buffer data, call bwrite to write it to disk.
+// * After changing buffer data, call bwrite to write it to disk,
+//     or bwritev to write several buffers at once, or bawrite
+//     to start the write and let the disk driver release the buffer.
+// * To write a buffer's data to some other block, set b->redir
+//     to that block before writing; the buffer still caches its
+//     own block afterwards.  Use breadfresh to read a block
+//     that may have been written that way.
+// * To overwrite all of a block, call boverwrite, which does
+//     not read the old contents from disk.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
 //
-// The implementation uses two state flags internally:
+// The implementation uses three state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_ASYNC: nobody waits for the disk request on this buffer;
+//     the driver calls bdone() to release it when it finishes.
 
 #include "types.h"
 #include "defs.h"
@@ -25,71 +35,274 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "bcstat.h"
 
-struct {
+#define NBUCKET 127   // hash buckets; prime
+#define BHASH(dev, blockno) (((dev) * 31 + (blockno)) % NBUCKET)
+#define BUCKET(b) (&bcache.bucket[BHASH((b)->dev, (b)->blockno)])
+#define NODEV 0xffffffff  // dev of a buffer holding no block
+#define NHOT (NBUF*3/4)   // most buffers the hot set may keep
+#define NGHOST (NBUF/2)   // recently evicted cold blocks remembered
+
+// The cache is a hash table of buffers keyed on (dev, blockno).
+// Each bucket has its own lock, which protects the chain and the
+// dev, blockno and refcnt of every buffer on it, so lookups on
+// different buckets run in parallel.  There is no global LRU list:
+// a miss recycles a buffer picked by a clock sweep over bcache.buf,
+// using b->used as the reference bit.  The sweep only ever holds
+// one bucket lock at a time.
+//
+// Replacement follows 2Q, so that one pass over a large file
+// cannot flush the inode and bitmap blocks everyone is using.
+// A block enters the cache cold, and cold buffers are evicted in
+// clock order whether or not they were used meanwhile, since a
+// block is usually touched several times in quick succession
+// (bzero, writei, the log) and that says nothing about reuse.
+// An evicted cold block is remembered in a small ghost list; if
+// it is read again while there, it joins the hot set.  The sweep
+// leaves hot buffers alone as long as there are at most NHOT of
+// them, and otherwise ages them with the usual second chance.
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+struct {
+  struct buf buf[NBUF];
+  struct bucket bucket[NBUCKET];
+  uint hand;          // clock hand, an index into buf
+  uint nhot;          // buffers in the hot set
+  struct bcstat stat;
 } bcache;
 
+// Ghost list: (dev, blockno) of the last NGHOST cold buffers
+// evicted, in a ring.
+struct {
+  struct spinlock lock;
+  uint dev[NGHOST];
+  uint blockno[NGHOST];
+  uint next;
+} ghost;
+
+static void
+bucketadd(struct bucket *bk, struct buf *b)
+{
+  b->prev = 0;
+  b->next = bk->head;
+  if(bk->head)
+    bk->head->prev = b;
+  bk->head = b;
+}
+
+static void
+bucketdel(struct bucket *bk, struct buf *b)
+{
+  if(b->prev)
+    b->prev->next = b->next;
+  else
+    bk->head = b->next;
+  if(b->next)
+    b->next->prev = b->prev;
+  b->prev = b->next = 0;
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
+  int i;
 
-  initlock(&bcache.lock, "bcache");
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+    initlock(&bk->lock, "bcache.bucket");
+  initlock(&ghost.lock, "bcache.ghost");
+  for(i = 0; i < NGHOST; i++)
+    ghost.dev[i] = NODEV;
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
+  // Start with every buffer empty.
   for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    b->dev = NODEV;
+    b->blockno = 0;
+    bucketadd(BUCKET(b), b);
   }
 }
 
+// Look for block blockno on device dev in bucket bk.
+// Caller must hold bk->lock.
+static struct buf*
+bfind(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->next)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Remember that cold block (dev, blockno) was evicted.
+static void
+ghostadd(uint dev, uint blockno)
+{
+  acquire(&ghost.lock);
+  ghost.dev[ghost.next] = dev;
+  ghost.blockno[ghost.next] = blockno;
+  ghost.next = (ghost.next + 1) % NGHOST;
+  release(&ghost.lock);
+}
+
+// Was block (dev, blockno) evicted from the cold set recently?
+// If so, forget it and return 1.
+static int
+ghostfind(uint dev, uint blockno)
+{
+  int i;
+
+  acquire(&ghost.lock);
+  for(i = 0; i < NGHOST; i++){
+    if(ghost.dev[i] == dev && ghost.blockno[i] == blockno){
+      ghost.dev[i] = NODEV;
+      release(&ghost.lock);
+      return 1;
+    }
+  }
+  release(&ghost.lock);
+  return 0;
+}
+
+// Take an unused buffer out of the cache, with the clock
+// algorithm: skip buffers in use or pinned by the log, evict the
+// first cold buffer found, and age hot buffers (second chance on
+// b->used) only while the hot set is too big.  If two sweeps find
+// nothing, hot buffers become fair game too.  Returns the buffer
+// unlinked from its bucket, with refcnt 1 so nobody else takes it.
+// If try is set, return 0 rather than panic if every buffer is busy.
+static struct buf*
+bvictim(int try)
+{
+  struct buf *b;
+  struct bucket *bk;
+  int i;
+
+  for(i = 0; i < 4*NBUF; i++){
+    b = &bcache.buf[__sync_fetch_and_add(&bcache.hand, 1) % NBUF];
+    if(b->refcnt != 0)  // unlocked peek, rechecked below
+      continue;
+    bk = BUCKET(b);
+    acquire(&bk->lock);
+    if(b->refcnt != 0 || bk != BUCKET(b)){
+      release(&bk->lock);
+      continue;
+    }
+    if(b->hot){
+      if(bcache.nhot <= NHOT && i < 2*NBUF){
+        release(&bk->lock);  // the hot set fits; leave it be
+        continue;
+      }
+      if(b->used){
+        b->used = 0;
+        release(&bk->lock);
+        continue;
+      }
+      b->hot = 0;
+      __sync_fetch_and_sub(&bcache.nhot, 1);
+    } else if(b->dev != NODEV){
+      ghostadd(b->dev, b->blockno);
+    }
+    if(b->dev != NODEV)
+      __sync_fetch_and_add(&bcache.stat.evicts, 1);
+    bucketdel(bk, b);
+    b->refcnt = 1;
+    release(&bk->lock);
+    return b;
+  }
+  if(try)
+    return 0;
+  panic("bget: no buffers");
+}
+
+// Put a buffer taken by bvictim() back in the cache, empty.
+static void
+bunvictim(struct buf *b)
+{
+  struct bucket *bk;
+
+  b->dev = NODEV;
+  b->blockno = 0;
+  bk = BUCKET(b);
+  acquire(&bk->lock);
+  b->refcnt = 0;
+  bucketadd(bk, b);
+  release(&bk->lock);
+}
+
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
+// For read-ahead (ahead set), return 0 instead if the
+// block is cached already or no buffer is free.
 static struct buf*
-bget(uint dev, uint blockno)
+bget(uint dev, uint blockno, int ahead)
 {
-  struct buf *b;
+  struct buf *b, *victim;
+  struct bucket *bk;
 
-  acquire(&bcache.lock);
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+  acquire(&bk->lock);
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  if((b = bfind(bk, dev, blockno)) != 0){
+    if(ahead){
+      release(&bk->lock);
+      return 0;
     }
+    b->refcnt++;
+    b->used = 1;
+    release(&bk->lock);
+    __sync_fetch_and_add(&bcache.stat.hits, 1);
+    acquiresleep(&b->lock);
+    return b;
   }
+  release(&bk->lock);
 
   // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  // Blocks that log.c has modified but not yet installed
+  // are pinned with bpin(), so their refcnt is not 0.
+  if((victim = bvictim(ahead)) == 0)
+    return 0;
+
+  // Someone may have cached the block while we looked.
+  acquire(&bk->lock);
+  if((b = bfind(bk, dev, blockno)) != 0){
+    if(ahead){
+      release(&bk->lock);
+      bunvictim(victim);
+      return 0;
     }
+    b->refcnt++;
+    b->used = 1;
+    release(&bk->lock);
+    bunvictim(victim);
+    __sync_fetch_and_add(&bcache.stat.hits, 1);
+    acquiresleep(&b->lock);
+    return b;
   }
-  panic("bget: no buffers");
+  b = victim;
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->used = 1;
+  if(ghostfind(dev, blockno)){
+    b->hot = 1;
+    __sync_fetch_and_add(&bcache.nhot, 1);
+  }
+  bucketadd(bk, b);
+  release(&bk->lock);
+  __sync_fetch_and_add(&bcache.stat.misses, 1);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -98,13 +311,54 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if((b->flags & B_VALID) == 0) {
     iderw(b);
   }
   return b;
 }
 
+// Like bread(), but read the block from disk even if it is
+// cached, for blocks that are written around the cache.
+struct buf*
+breadfresh(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno, 0);
+  b->flags &= ~B_VALID;
+  iderw(b);
+  return b;
+}
+
+// Return a locked buf for the indicated block without reading
+// it from disk, for a caller that is about to overwrite all of
+// its data.  Until then the data is garbage.
+struct buf*
+boverwrite(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno, 0);
+  b->flags |= B_VALID;
+  return b;
+}
+
+// Start reading the indicated block into the cache, without
+// waiting for the disk.  Does nothing if the block is cached
+// already or every buffer is busy.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = bget(dev, blockno, 1)) == 0)
+    return;
+  __sync_fetch_and_add(&bcache.stat.aheads, 1);
+  b->flags |= B_ASYNC;
+  iderw(b);  // bdone() releases b when the read finishes
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,29 +369,115 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Write the contents of n locked bufs to disk, letting the
+// disk work on all of them before waiting for any.
+void
+bwritev(struct buf **bufs, int n)
+{
+  struct iogroup g;
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bufs[i]->lock))
+      panic("bwritev");
+    bufs[i]->flags |= B_DIRTY;
+  }
+  g.pending = 0;
+  idesubmit(bufs, n, &g);
+  idewaitgroup(&g);
+}
+
+// Start writing b's contents to disk and return at once; the
+// disk driver releases b when the write is done.  If g is not 0,
+// idewaitgroup(g) waits for the write, along with the others in g.
+void
+bawrite(struct buf *b, struct iogroup *g)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bawrite");
+  b->flags |= B_DIRTY|B_ASYNC;
+  idesubmit(&b, 1, g);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
     panic("brelse");
+  bdone(b);
+}
+
+// Release b on behalf of whoever started an asynchronous
+// (B_ASYNC) request on it.  Called by the disk driver when the
+// request finishes, perhaps from an interrupt handler.
+void
+bdone(struct buf *b)
+{
+  struct bucket *bk;
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  bk = BUCKET(b);
+  acquire(&bk->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  release(&bk->lock);
+}
+
+// Finish the disk request on b, which the driver has synced
+// with the disk: count it done in b's group, waking the waiter,
+// and release b if nobody waits for it.  Called by the disk
+// driver, holding the lock that protects its groups.
+void
+biodone(struct buf *b)
+{
+  struct iogroup *g;
+
+  b->flags |= B_VALID;
+  b->flags &= ~B_DIRTY;
+  b->redir = 0;
+  if((g = b->group) != 0){
+    b->group = 0;
+    if(--g->pending == 0)
+      wakeup(g);
+  }
+  if(b->flags & B_ASYNC){
+    b->flags &= ~B_ASYNC;
+    bdone(b);
   }
-  
-  release(&bcache.lock);
+}
+
+// Keep b in the cache, even when nobody holds it,
+// until a matching bunpin().  Used by the log.
+void
+bpin(struct buf *b)
+{
+  struct bucket *bk;
+
+  bk = BUCKET(b);
+  acquire(&bk->lock);
+  b->refcnt++;
+  release(&bk->lock);
+}
+
+void
+bunpin(struct buf *b)
+{
+  struct bucket *bk;
+
+  bk = BUCKET(b);
+  acquire(&bk->lock);
+  b->refcnt--;
+  release(&bk->lock);
+}
+
+// Copy the cache counters to *st.
+void
+bstat(struct bcstat *st)
+{
+  *st = bcache.stat;
+  st->nbuf = NBUF;
+  st->nhot = bcache.nhot;
 }
 //PAGEBREAK!
 // Blank page.
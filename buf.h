@@ -4,11 +4,24 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
+  int used;          // clock reference bit (see bio.c)
+  int hot;           // in the hot set (see bio.c)
+  struct buf *prev; // hash bucket chain
   struct buf *next;
   struct buf *qnext; // disk queue
+  struct iogroup *group; // requests being waited for together
+  uint redir;        // if not 0, write to this block instead
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // release buffer when the disk is done with it
 
+// The disk block a request on b reads or writes.
+#define BDISKNO(b) ((b)->redir ? (b)->redir : (b)->blockno)
+
+
+// Disk requests that are waited for as a group (see ide.c).
+struct iogroup {
+  int pending;  // requests not yet done; protected by the driver's lock
+};
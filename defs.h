@@ -1,20 +1,34 @@
+struct bcstat;
 struct buf;
 struct context;
 struct file;
 struct inode;
+struct iogroup;
+struct pcidev;
 struct pipe;
 struct proc;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
+struct slabcache;
 struct stat;
 struct superblock;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+struct buf*     breadfresh(uint, uint);
+struct buf*     boverwrite(uint, uint);
 void            brelse(struct buf*);
+void            breadahead(uint, uint);
+void            bdone(struct buf*);
+void            biodone(struct buf*);
 void            bwrite(struct buf*);
+void            bwritev(struct buf**, int);
+void            bawrite(struct buf*, struct iogroup*);
+void            bpin(struct buf*);
+void            bunpin(struct buf*);
+void            bstat(struct bcstat*);
 
 // console.c
 void            consoleinit(void);
@@ -33,13 +47,17 @@ void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filepwrite(struct file*, char*, uint off, int n);
+int             filesplice(struct file*, struct file*, int n);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
+void            dcachedel(struct inode*, char*);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+void            icacheinit(void);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -50,6 +68,7 @@ int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
+void            ireadahead(struct inode*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
@@ -57,9 +76,12 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            idesubmit(struct buf**, int, struct iogroup*);
+void            idewaitgroup(struct iogroup*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
+void            ioapicroute(int irq, int alias, int cpu);
 extern uchar    ioapicid;
 void            ioapicinit(void);
 
@@ -87,19 +109,38 @@ void            log_write(struct buf*);
 void            begin_op();
 void            end_op();
 
+// mmap.c
+int             mmap(struct file*, uint, int, int, uint);
+int             munmap(uint, uint);
+int             vmafault(uint, int);
+int             vmafork(struct proc*, struct proc*);
+void            vmaexit(struct proc*);
+int             vmaoverlap(struct proc*, uint, uint);
+int             vmaprefault(uint, uint, int);
+
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// pci.c
+int             pcifindclass(int, int, struct pcidev*);
+int             pcifindid(int, int, struct pcidev*);
+void            pcienable(struct pcidev*);
+uint            pciread(struct pcidev*, uint);
+void            pciwrite(struct pcidev*, uint, uint);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
 
 // pipe.c
+void            pipeinit(void);
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
+int             pipefill(struct pipe*, struct file*, int);
+int             pipedrain(struct pipe*, struct file*, int);
 
 //PAGEBREAK: 16
 // proc.c
@@ -108,6 +149,7 @@ void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int);
+void            kthread(char*, void(*)(void));
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
@@ -144,6 +186,11 @@ void            releasesleep(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
 
+// slab.c
+void            slabinit(struct slabcache*, char*, uint);
+void*           slaballoc(struct slabcache*);
+void            slabfree(struct slabcache*, void*);
+
 // string.c
 int             memcmp(const void*, const void*, uint);
 void*           memmove(void*, const void*, uint);
@@ -156,6 +203,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argptrw(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -187,9 +235,13 @@ void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
+void            schedswitchuvm(struct proc*, pde_t*);
 void            switchkvm(void);
+void            pgeinit(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+pte_t*          walkpgdir(pde_t*, const void*, int);
+int             mappages(pde_t*, void*, uint, uint, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
\ No newline at end of file
@@ -5,21 +5,33 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
+#include "mmu.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "slab.h"
+
+#define RAMAX 4  // largest read-ahead window, in blocks
 
 struct devsw devsw[NDEV];
+
+// File structures come from a slab cache; NFILE only
+// bounds how many may be open at once.  There is no table
+// lock: the count of open files and each file's ref are
+// updated with atomic instructions, so that processes
+// opening and closing files on different CPUs don't wait
+// for each other.
 struct {
-  struct spinlock lock;
-  struct file file[NFILE];
+  int nfile;               // file structures in use
+  struct slabcache cache;
 } ftable;
 
 void
 fileinit(void)
 {
-  initlock(&ftable.lock, "ftable");
+  slabinit(&ftable.cache, "file", sizeof(struct file));
 }
 
 // Allocate a file structure.
@@ -28,27 +40,25 @@ filealloc(void)
 {
   struct file *f;
 
-  acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
+  if(__sync_add_and_fetch(&ftable.nfile, 1) > NFILE){
+    __sync_fetch_and_sub(&ftable.nfile, 1);
+    return 0;
+  }
+  if((f = slaballoc(&ftable.cache)) == 0){
+    __sync_fetch_and_sub(&ftable.nfile, 1);
+    return 0;
   }
-  release(&ftable.lock);
-  return 0;
+  memset(f, 0, sizeof(*f));
+  f->ref = 1;
+  return f;
 }
 
 // Increment ref count for file f.
 struct file*
 filedup(struct file *f)
 {
-  acquire(&ftable.lock);
-  if(f->ref < 1)
+  if(__sync_fetch_and_add(&f->ref, 1) < 1)
     panic("filedup");
-  f->ref++;
-  release(&ftable.lock);
   return f;
 }
 
@@ -57,18 +67,16 @@ void
 fileclose(struct file *f)
 {
   struct file ff;
+  int r;
 
-  acquire(&ftable.lock);
-  if(f->ref < 1)
-    panic("fileclose");
-  if(--f->ref > 0){
-    release(&ftable.lock);
+  if((r = __sync_sub_and_fetch(&f->ref, 1)) > 0)
     return;
-  }
+  if(r < 0)
+    panic("fileclose");
   ff = *f;
-  f->ref = 0;
   f->type = FD_NONE;
-  release(&ftable.lock);
+  __sync_fetch_and_sub(&ftable.nfile, 1);
+  slabfree(&ftable.cache, f);
 
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
@@ -104,8 +112,20 @@ fileread(struct file *f, char *addr, int n)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
     ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
+    if((r = readi(f->ip, addr, f->off, n)) > 0){
+      // Read ahead while reads are sequential,
+      // doubling the window each time.
+      if(f->off != f->raoff)
+        f->ranblk = 0;
+      else if(f->ranblk == 0)
+        f->ranblk = 1;
+      else if(f->ranblk < RAMAX)
+        f->ranblk *= 2;
       f->off += r;
+      f->raoff = f->off;
+      if(f->ranblk > 0)
+        ireadahead(f->ip, f->off, f->ranblk);
+    }
     iunlock(f->ip);
     return r;
   }
@@ -113,45 +133,100 @@ fileread(struct file *f, char *addr, int n)
 }
 
 //PAGEBREAK!
+// Write n bytes from addr to inode ip at *off, advancing *off.
+static int
+writeinode(struct inode *ip, char *addr, uint *off, int n)
+{
+  int r;
+
+  // write a few blocks at a time to avoid exceeding
+  // the maximum log transaction size, including
+  // i-node, indirect block, allocation blocks,
+  // and 2 blocks of slop for non-aligned writes.
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+  int i = 0;
+  while(i < n){
+    int n1 = n - i;
+    if(n1 > max)
+      n1 = max;
+
+    begin_op();
+    ilock(ip);
+    if ((r = writei(ip, addr + i, *off, n1)) > 0)
+      *off += r;
+    iunlock(ip);
+    end_op();
+
+    if(r < 0)
+      break;
+    i += r;
+    if(r != n1)
+      break;  // the file cannot grow
+  }
+  return i == n ? n : -1;
+}
+
 // Write to file f.
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
-
   if(f->writable == 0)
     return -1;
   if(f->type == FD_PIPE)
     return pipewrite(f->pipe, addr, n);
-  if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_op();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
-      end_op();
-
-      if(r < 0)
-        break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
-    }
-    return i == n ? n : -1;
-  }
+  if(f->type == FD_INODE)
+    return writeinode(f->ip, addr, &f->off, n);
   panic("filewrite");
 }
 
+// Write to file f at offset off, leaving f->off alone.
+int
+filepwrite(struct file *f, char *addr, uint off, int n)
+{
+  if(f->type != FD_INODE)
+    return -1;
+  return writeinode(f->ip, addr, &off, n);
+}
+
+
+// Can f's reads and writes wait for other processes,
+// as a pipe's or a device's can?  The type of an open
+// inode does not change, so it needs no lock.
+static int
+fileblocks(struct file *f)
+{
+  return f->type != FD_INODE || f->ip->type == T_DEV;
+}
+
+// Move up to n bytes from in to out, without a user buffer.
+// One of them must be a pipe.  A regular file is read into, or
+// written from, the pipe's own pages.  Otherwise the data goes
+// through a kernel page, since pipefill() and pipedrain() must
+// not wait for other processes while copying.
+// Returns the number of bytes moved, or -1.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+  char *page;
+  int r;
+
+  if(in->readable == 0 || out->writable == 0)
+    return -1;
+  if(in->type != FD_PIPE && out->type != FD_PIPE)
+    return -1;
+  if(in->type == FD_PIPE && out->type == FD_PIPE && in->pipe == out->pipe)
+    return -1;
+  if(out->type == FD_PIPE && !fileblocks(in))
+    return pipefill(out->pipe, in, n);
+  if(in->type == FD_PIPE && !fileblocks(out))
+    return pipedrain(in->pipe, out, n);
+
+  if((page = kalloc()) == 0)
+    return -1;
+  if((r = fileread(in, page, n < PGSIZE ? n : PGSIZE)) > 0)
+    r = filewrite(out, page, r);
+  kfree(page);
+  return r;
+}
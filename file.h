@@ -6,14 +6,29 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  uint raoff;  // offset at which a sequential read would continue
+  uint ranblk; // read-ahead window, in blocks
 };
 
 
+// An extent of an inode, and the file block it starts at.
+struct bmapcache {
+  uint lbn;
+  uint start;
+  uint len;  // 0 if the entry is unused
+};
+#define NBMAPCACHE 4
+
 // in-memory copy of an inode
 struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *prev; // icache hash chain
+  struct inode *next;
+  struct inode *lprev; // icache LRU list, while ref is 0
+  struct inode *lnext;
+  int claimed;        // ivictim() is reclaiming it; icache.lock
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -22,7 +37,11 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  struct extent ext[NEXTENT];
+  uint extindex;
+
+  struct bmapcache bmc[NBMAPCACHE]; // extents bmap() used lately
+  uint bmcnext;       // bmc entry to replace next
 };
 
 // table mapping major device number to
@@ -20,9 +20,12 @@
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
+#include "slab.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
+#define RUNMAX 8  // most blocks readi() starts reading at once
 static void itrunc(struct inode*);
+static void dcacheinit(void);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb; 
@@ -52,25 +55,92 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+// In-memory summary of the free-block bitmap: the number of
+// free blocks each bitmap block describes, and a cursor just
+// past the last block allocated.  balloc() starts looking at
+// the cursor and skips bitmap blocks with nothing free, so
+// allocation does not slow down as the disk fills, and a file
+// written sequentially gets consecutive blocks.  The counts
+// change only while the bitmap block's buffer is locked.
+static struct {
+  struct spinlock lock;
+  uint cursor;
+  uint nfree[FSSIZE/BPB + 1];
+} bsum;
+
+// Count the free blocks in each bitmap block.
+static void
+bsuminit(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint b, bi;
 
-  bp = 0;
+  initlock(&bsum.lock, "bsum");
+  if((sb.size + BPB - 1) / BPB > NELEM(bsum.nfree))
+    panic("bsuminit: disk too big");
   for(b = 0; b < sb.size; b += BPB){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
-      }
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++)
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+        bsum.nfree[b/BPB]++;
+    brelse(bp);
+  }
+}
+
+// Find a clear bit at or after bit start in bitmap block bp that
+// stands for a block below sb.size, a word at a time.  Returns
+// the bit, or -1.
+static int
+bmapscan(struct buf *bp, uint b0, uint start)
+{
+  uint *w, word;
+  int i, bi;
+
+  w = (uint*)bp->data;
+  for(i = start/32; i < BPB/32; i++){
+    word = w[i];
+    if(i == start/32)
+      word |= (1U << (start % 32)) - 1;  // ignore bits before start
+    if(word == 0xffffffff)
+      continue;
+    bi = i*32 + __builtin_ctz(~word);
+    return b0 + bi < sb.size ? bi : -1;
+  }
+  return -1;
+}
+
+// Allocate a zeroed disk block: the first free one at or after
+// goal, or after the cursor if goal is 0.
+static uint
+balloc(uint dev, uint goal)
+{
+  uint b0, n, cursor, start;
+  int i, bi;
+  struct buf *bp;
+
+  n = (sb.size + BPB - 1) / BPB;
+  acquire(&bsum.lock);
+  cursor = goal > 0 && goal < sb.size ? goal : bsum.cursor;
+  release(&bsum.lock);
+
+  // Try the cursor's bitmap block from the cursor on, then the
+  // others, then the cursor's block again from its beginning.
+  for(i = 0; i <= n; i++){
+    b0 = ((cursor / BPB + i) % n) * BPB;
+    start = i == 0 ? cursor % BPB : 0;
+    if(bsum.nfree[b0/BPB] == 0)  // unlocked peek
+      continue;
+    bp = bread(dev, BBLOCK(b0, sb));
+    if((bi = bmapscan(bp, b0, start)) >= 0){
+      bp->data[bi/8] |= 1 << (bi % 8);  // Mark block in use.
+      log_write(bp);
+      acquire(&bsum.lock);
+      bsum.nfree[b0/BPB]--;
+      bsum.cursor = b0 + bi + 1 < sb.size ? b0 + bi + 1 : 0;
+      release(&bsum.lock);
+      brelse(bp);
+      bzero(dev, b0 + bi);
+      return b0 + bi;
     }
     brelse(bp);
   }
@@ -91,6 +161,9 @@ bfree(int dev, uint b)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
   log_write(bp);
+  acquire(&bsum.lock);
+  bsum.nfree[b/BPB]++;
+  release(&bsum.lock);
   brelse(bp);
 }
 
@@ -120,7 +193,7 @@ bfree(int dev, uint b)
 //   the reference and link counts have fallen to zero.
 //
 // * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
+//   may be reused if ip->ref is zero. Otherwise ip->ref tracks
 //   the number of in-memory pointers to the entry (open
 //   files and current directories). iget() finds or
 //   creates a cache entry and increments its ref; iput()
@@ -130,7 +203,8 @@ bfree(int dev, uint b)
 //   cache entry is only correct when ip->valid is 1.
 //   ilock() reads the inode from
 //   the disk and sets ip->valid, while iput() clears
-//   ip->valid if ip->ref has fallen to zero.
+//   ip->valid if it frees the inode on disk, and iget()
+//   clears it when it reuses the entry for another inode.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
@@ -154,38 +228,68 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// The cache is a hash table keyed on (dev, inum), like the
+// buffer cache.  Each bucket's spin-lock protects its chain and
+// the ip->ref, ip->dev and ip->inum of every entry on it, so
+// iget() on different buckets runs in parallel.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
+//
+// Cache entries are allocated from a slab cache as iget()
+// needs them, up to NINODE of them.  An entry whose ref drops
+// to zero stays cached, and valid, on an LRU list, so that
+// opening the same files again needs no disk reads; when the
+// cache is full, iget() reuses the least recently used one.
+// The icache.lock spin-lock protects the LRU list, ninode and
+// ip->claimed.
+// It is taken after a bucket lock, never before.
+
+#define NIHASH 61  // hash buckets; prime
+#define IBUCKET(dev, inum) (&icache.bucket[((dev)*31 + (inum)) % NIHASH])
+
+struct ibucket {
+  struct spinlock lock;
+  struct inode *head;
+};
 
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  int ninode;              // entries allocated
+  struct inode *lru;       // unreferenced entries, most recent first
+  struct inode *lrutail;
+  struct ibucket bucket[NIHASH];
+  struct slabcache cache;
 } icache;
 
+// Set up the in-memory inode cache.
+// Called from main() before the first iget().
 void
-iinit(int dev)
+icacheinit(void)
 {
-  int i = 0;
-  
+  struct ibucket *bk;
+
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  for(bk = icache.bucket; bk < icache.bucket+NIHASH; bk++)
+    initlock(&bk->lock, "icache.bucket");
+  slabinit(&icache.cache, "inode", sizeof(struct inode));
+}
 
+void
+iinit(int dev)
+{
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
           sb.bmapstart);
+  bsuminit(dev);
+  dcacheinit();
 }
 
 static struct inode* iget(uint dev, uint inum);
+static void dcachepurge(uint dev, uint dir);
 
 //PAGEBREAK!
 // Allocate an inode on device dev.
@@ -230,43 +334,194 @@ iupdate(struct inode *ip)
   dip->minor = ip->minor;
   dip->nlink = ip->nlink;
   dip->size = ip->size;
-  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+  memmove(dip->ext, ip->ext, sizeof(ip->ext));
+  dip->extindex = ip->extindex;
   log_write(bp);
   brelse(bp);
 }
 
-// Find the inode with number inum on device dev
-// and return the in-memory copy. Does not lock
-// the inode and does not read it from disk.
+// Put ip on the LRU list: at the front, or at the back
+// if it is not worth keeping.  An entry that ivictim() has
+// claimed stays off the list; ivictim() will take it.
+// Caller must hold icache.lock.
+static void
+lruadd(struct inode *ip, int keep)
+{
+  if(ip->claimed)
+    return;
+  if(keep){
+    ip->lprev = 0;
+    ip->lnext = icache.lru;
+    if(icache.lru)
+      icache.lru->lprev = ip;
+    else
+      icache.lrutail = ip;
+    icache.lru = ip;
+  } else {
+    ip->lnext = 0;
+    ip->lprev = icache.lrutail;
+    if(icache.lrutail)
+      icache.lrutail->lnext = ip;
+    else
+      icache.lru = ip;
+    icache.lrutail = ip;
+  }
+}
+
+// Take ip off the LRU list, if it is on it.
+// Caller must hold icache.lock.
+static void
+lrudel(struct inode *ip)
+{
+  if(ip->lprev == 0 && icache.lru != ip)
+    return;
+  if(ip->lprev)
+    ip->lprev->lnext = ip->lnext;
+  else
+    icache.lru = ip->lnext;
+  if(ip->lnext)
+    ip->lnext->lprev = ip->lprev;
+  else
+    icache.lrutail = ip->lprev;
+  ip->lprev = ip->lnext = 0;
+}
+
+static void
+ibucketadd(struct ibucket *bk, struct inode *ip)
+{
+  ip->prev = 0;
+  ip->next = bk->head;
+  if(bk->head)
+    bk->head->prev = ip;
+  bk->head = ip;
+}
+
+static void
+ibucketdel(struct ibucket *bk, struct inode *ip)
+{
+  if(ip->prev == 0 && bk->head != ip)
+    panic("ibucketdel");
+  if(ip->prev)
+    ip->prev->next = ip->next;
+  else
+    bk->head = ip->next;
+  if(ip->next)
+    ip->next->prev = ip->prev;
+  ip->prev = ip->next = 0;
+}
+
+// Look for inode inum of dev in bucket bk.
+// Caller must hold bk->lock.
 static struct inode*
-iget(uint dev, uint inum)
+ifind(struct ibucket *bk, uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip;
 
-  acquire(&icache.lock);
+  for(ip = bk->head; ip; ip = ip->next)
+    if(ip->dev == dev && ip->inum == inum)
+      return ip;
+  return 0;
+}
 
-  // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+// Return an entry that is on no bucket and no list: a new one
+// if the cache has room, else the least recently used one.
+static struct inode*
+ivictim(void)
+{
+  struct inode *ip;
+  struct ibucket *bk;
+  int busy;
+
+  for(;;){
+    acquire(&icache.lock);
+    if(icache.ninode < NINODE && (ip = slaballoc(&icache.cache)) != 0){
+      icache.ninode++;
       release(&icache.lock);
+      memset(ip, 0, sizeof(*ip));
+      initsleeplock(&ip->lock, "inode");
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
+    if((ip = icache.lrutail) == 0)
+      panic("iget: no inodes");
+    lrudel(ip);
+    ip->claimed = 1;  // nobody else may take it, or rename it
+    release(&icache.lock);
+
+    // Someone may have taken a reference to ip meanwhile.
+    // If they dropped it again, it is still ours.
+    bk = IBUCKET(ip->dev, ip->inum);
+    acquire(&bk->lock);
+    busy = ip->ref != 0;
+    if(!busy)
+      ibucketdel(bk, ip);
+    acquire(&icache.lock);
+    ip->claimed = 0;  // a busy ip goes on the LRU list in iput()
+    release(&icache.lock);
+    release(&bk->lock);
+    if(!busy)
+      return ip;
   }
+}
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
+// Give back an entry returned by ivictim() but not used.
+static void
+iunvictim(struct inode *ip)
+{
+  acquire(&icache.lock);
+  icache.ninode--;
+  slabfree(&icache.cache, ip);
+  release(&icache.lock);
+}
 
-  ip = empty;
+// Take a reference to ip, which is cached in bk.
+// Caller must hold bk->lock.
+static void
+iref(struct inode *ip)
+{
+  if(ip->ref++ == 0){
+    acquire(&icache.lock);
+    lrudel(ip);
+    release(&icache.lock);
+  }
+}
+
+// Find the inode with number inum on device dev
+// and return the in-memory copy. Does not lock
+// the inode and does not read it from disk.
+static struct inode*
+iget(uint dev, uint inum)
+{
+  struct inode *ip, *victim;
+  struct ibucket *bk;
+
+  bk = IBUCKET(dev, inum);
+  acquire(&bk->lock);
+
+  // Is the inode already cached?
+  if((ip = ifind(bk, dev, inum)) != 0){
+    iref(ip);
+    release(&bk->lock);
+    return ip;
+  }
+  release(&bk->lock);
+
+  // Get a cache entry, then check that nobody
+  // else cached the inode while we looked.
+  victim = ivictim();
+  acquire(&bk->lock);
+  if((ip = ifind(bk, dev, inum)) != 0){
+    iref(ip);
+    release(&bk->lock);
+    iunvictim(victim);
+    return ip;
+  }
+  ip = victim;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
-  release(&icache.lock);
+  ibucketadd(bk, ip);
+  release(&bk->lock);
 
   return ip;
 }
@@ -276,9 +531,12 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
+  struct ibucket *bk;
+
+  bk = IBUCKET(ip->dev, ip->inum);
+  acquire(&bk->lock);
   ip->ref++;
-  release(&icache.lock);
+  release(&bk->lock);
   return ip;
 }
 
@@ -303,7 +561,9 @@ ilock(struct inode *ip)
     ip->minor = dip->minor;
     ip->nlink = dip->nlink;
     ip->size = dip->size;
-    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+    memmove(ip->ext, dip->ext, sizeof(ip->ext));
+    ip->extindex = dip->extindex;
+    memset(ip->bmc, 0, sizeof(ip->bmc));
     brelse(bp);
     ip->valid = 1;
     if(ip->type == 0)
@@ -322,8 +582,8 @@ iunlock(struct inode *ip)
 }
 
 // Drop a reference to an in-memory inode.
-// If that was the last reference, the inode cache entry can
-// be recycled.
+// If that was the last reference, the inode cache entry
+// goes on the LRU list, to be reused when the cache is full.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 // All calls to iput() must be inside a transaction in
@@ -331,13 +591,18 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  struct ibucket *bk;
+
+  bk = IBUCKET(ip->dev, ip->inum);
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
+    acquire(&bk->lock);
     int r = ip->ref;
-    release(&icache.lock);
+    release(&bk->lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
+      if(ip->type == T_DIR)
+        dcachepurge(ip->dev, ip->inum);
       itrunc(ip);
       ip->type = 0;
       iupdate(ip);
@@ -346,9 +611,14 @@ iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  release(&icache.lock);
+  acquire(&bk->lock);
+  if(--ip->ref == 0){
+    // A freed inode is the first to reuse.
+    acquire(&icache.lock);
+    lruadd(ip, ip->valid);
+    release(&icache.lock);
+  }
+  release(&bk->lock);
 }
 
 // Common idiom: unlock, then put.
@@ -362,41 +632,163 @@ iunlockput(struct inode *ip)
 //PAGEBREAK!
 // Inode content
 //
-// The content (data) associated with each inode is stored
-// in blocks on the disk. The first NDIRECT block numbers
-// are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
-
-// Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// The content (data) associated with each inode is stored in
+// extents, runs of consecutive disk blocks.  The first NEXTENT
+// extents are listed in ip->ext[].  The rest are kept in extent
+// blocks of NIEXTENT each, listed in the index block
+// ip->extindex along with the file block each one starts at,
+// so that finding a block needs at most two reads however big
+// the file.  Files have no holes, so a file only grows at its
+// end, and it does so by extending its last extent whenever the
+// disk block after it is free.
+// There is no fixed limit on a file's size: it can grow until
+// the disk is full or its extents run out, at which point
+// bmap() returns 0 and writei() stops short.
+//
+// Each in-memory inode also caches the last few extents bmap()
+// looked up, so that random access within them does not read
+// the index or the extent blocks again.
+
+// Look for file block bn in the n extents at e, which map the
+// file from block *lbnp on.  Returns the index of the extent
+// holding bn, setting *lbnp to its first block, or else the
+// index of the first unused extent, setting *lbnp past the last.
 static uint
-bmap(struct inode *ip, uint bn)
+extscan(struct extent *e, uint n, uint bn, uint *lbnp)
 {
-  uint addr, *a;
-  struct buf *bp;
+  uint i;
 
-  if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
-    return addr;
+  for(i = 0; i < n && e[i].len > 0; i++){
+    if(bn < *lbnp + e[i].len)
+      break;
+    *lbnp += e[i].len;
   }
-  bn -= NDIRECT;
+  return i;
+}
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
-    bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
+// Look up block bn in ip's extent cache.
+static uint
+bmcget(struct inode *ip, uint bn, uint *run)
+{
+  struct bmapcache *c;
+
+  for(c = ip->bmc; c < &ip->bmc[NBMAPCACHE]; c++){
+    if(c->len > 0 && bn >= c->lbn && bn - c->lbn < c->len){
+      *run = c->len - (bn - c->lbn);
+      return c->start + (bn - c->lbn);
     }
-    brelse(bp);
+  }
+  return 0;
+}
+
+static void
+bmcput(struct inode *ip, uint lbn, struct extent *e)
+{
+  struct bmapcache *c;
+
+  c = &ip->bmc[ip->bmcnext++ % NBMAPCACHE];
+  c->lbn = lbn;
+  c->start = e->start;
+  c->len = e->len;
+}
+
+// Return the disk block address of the nth block in inode ip,
+// and set *run to the number of blocks of the same extent from
+// there on, which follow it on disk.  If bn is the block just
+// past the end of the file, bmap allocates it.  Returns 0 if
+// the file has no room for another extent.
+static uint
+bmap(struct inode *ip, uint bn, uint *run)
+{
+  struct buf *ib, *lb;
+  struct extidx *idx;
+  struct extent *ev, *last;
+  uint lbn, n, i, j, addr, goal;
+
+  if((addr = bmcget(ip, bn, run)) != 0)
     return addr;
+
+  // Search the inode's extents, then the extent block for bn.
+  ib = lb = 0;
+  idx = 0;
+  j = 0;
+  lbn = 0;
+  ev = ip->ext;
+  n = NEXTENT;
+  i = extscan(ev, n, bn, &lbn);
+  if(i == n && ip->extindex){
+    ib = bread(ip->dev, ip->extindex);
+    idx = (struct extidx*)ib->data;
+    while(j+1 < NEXTIDX && idx[j+1].block && idx[j+1].lbn <= bn)
+      j++;
+    lb = bread(ip->dev, idx[j].block);
+    lbn = idx[j].lbn;
+    ev = (struct extent*)lb->data;
+    n = NIEXTENT;
+    i = extscan(ev, n, bn, &lbn);
+  }
+  if(i < n && ev[i].len > 0){
+    addr = ev[i].start + (bn - lbn);
+    *run = ev[i].len - (bn - lbn);
+    bmcput(ip, lbn, &ev[i]);
+    goto out;
+  }
+  if(bn != lbn)
+    panic("bmap: out of range");
+
+  // Append a block, preferably the one after the last extent.
+  last = i > 0 ? &ev[i-1] : 0;
+  goal = last ? last->start + last->len : 0;
+  addr = balloc(ip->dev, goal);
+  *run = 1;
+  if(last && addr == goal){
+    last->len++;
+  } else if(i < n){
+    ev[i].start = addr;
+    ev[i].len = 1;
+  } else {
+    // Start a new extent block, and the index if need be.
+    if(ib == 0){
+      ip->extindex = balloc(ip->dev, 0);
+      ib = bread(ip->dev, ip->extindex);
+      idx = (struct extidx*)ib->data;
+    } else if(++j == NEXTIDX){
+      bfree(ip->dev, addr);
+      addr = 0;
+      *run = 0;
+      goto out;
+    }
+    idx[j].lbn = bn;
+    idx[j].block = balloc(ip->dev, 0);
+    log_write(ib);
+    if(lb)
+      brelse(lb);
+    lb = bread(ip->dev, idx[j].block);
+    ev = (struct extent*)lb->data;
+    ev[0].start = addr;
+    ev[0].len = 1;
   }
+  if(lb)
+    log_write(lb);
+
+out:
+  if(lb)
+    brelse(lb);
+  if(ib)
+    brelse(ib);
+  return addr;
+}
+
+// Free the blocks of the n extents at e.
+static void
+extfree(uint dev, struct extent *e, uint n)
+{
+  uint i, j;
 
-  panic("bmap: out of range");
+  for(i = 0; i < n && e[i].len > 0; i++){
+    for(j = 0; j < e[i].len; j++)
+      bfree(dev, e[i].start + j);
+  }
 }
 
 // Truncate inode (discard contents).
@@ -407,28 +799,27 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
-
-  for(i = 0; i < NDIRECT; i++){
-    if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
-      ip->addrs[i] = 0;
+  struct buf *ib, *lb;
+  struct extidx *idx;
+  uint j;
+
+  extfree(ip->dev, ip->ext, NEXTENT);
+  memset(ip->ext, 0, sizeof(ip->ext));
+
+  if(ip->extindex){
+    ib = bread(ip->dev, ip->extindex);
+    idx = (struct extidx*)ib->data;
+    for(j = 0; j < NEXTIDX && idx[j].block; j++){
+      lb = bread(ip->dev, idx[j].block);
+      extfree(ip->dev, (struct extent*)lb->data, NIEXTENT);
+      brelse(lb);
+      bfree(ip->dev, idx[j].block);
     }
+    brelse(ib);
+    bfree(ip->dev, ip->extindex);
+    ip->extindex = 0;
   }
-
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
-    }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
-  }
+  memset(ip->bmc, 0, sizeof(ip->bmc));
 
   ip->size = 0;
   iupdate(ip);
@@ -452,7 +843,7 @@ stati(struct inode *ip, struct stat *st)
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr, run, ahead, i;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -466,8 +857,19 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
-  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+  // Look up each extent once, not each block.  Start the disk
+  // on several blocks of a run at a time, so that they arrive
+  // together instead of one bread() after another.
+  run = ahead = 0;
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m, addr++, run--, ahead--){
+    if(run == 0)
+      addr = bmap(ip, off/BSIZE, &run);
+    if(ahead == 0){
+      ahead = min(run, min(RUNMAX, (off%BSIZE + n - tot + BSIZE-1) / BSIZE));
+      for(i = 0; ahead > 1 && i < ahead; i++)
+        breadahead(ip->dev, addr + i);
+    }
+    bp = bread(ip->dev, addr);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
@@ -475,13 +877,32 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   return n;
 }
 
+// Start reading up to n blocks of ip, beginning with the first
+// block at or after offset off, into the buffer cache, without
+// waiting for the disk.  Caller must hold ip->lock.
+void
+ireadahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, nblock, addr, run;
+
+  if(ip->type == T_DEV)
+    return;
+  nblock = (ip->size + BSIZE - 1) / BSIZE;
+  run = 0;
+  for(bn = (off + BSIZE - 1) / BSIZE; bn < nblock && n > 0; bn++, n--, addr++, run--){
+    if(run == 0)
+      addr = bmap(ip, bn, &run);
+    breadahead(ip->dev, addr);
+  }
+}
+
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr, run;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -492,22 +913,26 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
-    return -1;
 
-  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+  run = 0;
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m, addr++, run--){
+    if(run == 0 && (addr = bmap(ip, off/BSIZE, &run)) == 0)
+      break;  // out of extents
     m = min(n - tot, BSIZE - off%BSIZE);
+    if(m == BSIZE)
+      bp = boverwrite(ip->dev, addr);  // no need to read it first
+    else
+      bp = bread(ip->dev, addr);
     memmove(bp->data + off%BSIZE, src, m);
     log_write(bp);
     brelse(bp);
   }
 
-  if(n > 0 && off > ip->size){
+  if(tot > 0 && off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
-  return n;
+  return tot > 0 || n == 0 ? tot : -1;
 }
 
 //PAGEBREAK!
@@ -519,31 +944,311 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Directory entry cache.
+//
+// The dcache remembers the results of recent dirlookup() calls:
+// for a name in a directory, the inode number and offset of its
+// entry, or that there is no such entry (inum 0).  Entries for a
+// directory are only added or changed while the directory is
+// locked, by dirlookup(), dirlink() and dcachedel(), so they
+// always agree with the directory's contents.  When the space
+// runs out, entries are recycled round-robin.
+
+#define NDHASH 61
+
+struct dentry {
+  uint dev;
+  uint dir;             // inum of the directory
+  char name[DIRSIZ];
+  uint inum;            // 0 if dir has no entry called name
+  uint off;             // byte offset of the entry in dir
+  struct dentry *next;  // hash chain
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry ent[NDCACHE];
+  struct dentry *hash[NDHASH];
+  uint hand;            // next entry to recycle
+} dcache;
+
+static void
+dcacheinit(void)
+{
+  initlock(&dcache.lock, "dcache");
+}
+
+static uint
+dhash(uint dev, uint dir, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dir;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return h % NDHASH;
+}
+
+// Find the dcache entry for name in dir.
+// Caller must hold dcache.lock.
+static struct dentry*
+dfind(uint dev, uint dir, char *name)
+{
+  struct dentry *d;
+
+  for(d = dcache.hash[dhash(dev, dir, name)]; d; d = d->next)
+    if(d->dev == dev && d->dir == dir && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Take d off its hash chain.  Caller must hold dcache.lock.
+static void
+dunhash(struct dentry *d)
+{
+  struct dentry **pp;
+
+  for(pp = &dcache.hash[dhash(d->dev, d->dir, d->name)]; *pp; pp = &(*pp)->next){
+    if(*pp == d){
+      *pp = d->next;
+      break;
+    }
+  }
+  d->dir = 0;
+}
+
+// Record that name in dp is inode inum, at offset off,
+// or that there is no such name if inum is 0.
+// Caller must hold dp->lock.
+static void
+dcacheput(struct inode *dp, char *name, uint inum, uint off)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) == 0){
+    d = &dcache.ent[dcache.hand++ % NDCACHE];
+    if(d->dir != 0)
+      dunhash(d);
+    d->dev = dp->dev;
+    d->dir = dp->inum;
+    strncpy(d->name, name, DIRSIZ);
+    d->next = dcache.hash[dhash(d->dev, d->dir, d->name)];
+    dcache.hash[dhash(d->dev, d->dir, d->name)] = d;
+  }
+  d->inum = inum;
+  d->off = off;
+  release(&dcache.lock);
+}
+
+// Record that name is no longer in dp.
+// Caller must hold dp->lock.
+void
+dcachedel(struct inode *dp, char *name)
+{
+  dcacheput(dp, name, 0, 0);
+}
+
+// Forget everything about directory dir, which is being freed.
+static void
+dcachepurge(uint dev, uint dir)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.ent; d < &dcache.ent[NDCACHE]; d++)
+    if(d->dir == dir && d->dev == dev)
+      dunhash(d);
+  release(&dcache.lock);
+}
+
+// Directories are hash tables, so that a lookup reads a single
+// block however big the directory is.  A name belongs in block
+// dirbucket(name, n) of a directory of n blocks; the directory
+// grows a block at a time by linear hashing, splitting one
+// block's names between it and the new block.  If a name's
+// block is still full, the name goes wherever there is room,
+// and the block's header is marked D_OVERFLOW so that lookups
+// that miss in it search the whole directory.
+
+static uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;  // FNV-1a
+  for(i = 0; i < DIRSIZ && name[i]; i++){
+    h ^= (uchar)name[i];
+    h *= 16777619;
+  }
+  return h;
+}
+
+// The block of a directory of n blocks where name belongs.
+static uint
+dirbucket(char *name, uint n)
+{
+  uint h, m;
+
+  h = dirhash(name);
+  for(m = 1; m < n; m <<= 1)
+    ;
+  if((h & (m-1)) < n)
+    return h & (m-1);
+  return h & (m/2 - 1);
+}
+
+// Read block b of directory dp.
+static struct buf*
+dirblock(struct inode *dp, uint b)
+{
+  uint run;
+
+  return bread(dp->dev, bmap(dp, b, &run));
+}
+
+// Look for name in block b of dp.  If found, set *poff to
+// the byte offset of its entry and return its inum.
+// Otherwise return 0.  If overflow is not 0, set *overflow
+// from the block's header.
+static uint
+dirsearch(struct inode *dp, uint b, char *name, uint *poff, int *overflow)
+{
+  struct buf *bp;
+  struct dirent *de;
+  uint i, inum;
+
+  bp = dirblock(dp, b);
+  de = (struct dirent*)bp->data;
+  inum = 0;
+  for(i = 1; i < DPB; i++){
+    if(de[i].inum != 0 && namecmp(name, de[i].name) == 0){
+      // entry matches path element
+      *poff = b*BSIZE + i*sizeof(*de);
+      inum = de[i].inum;
+      break;
+    }
+  }
+  if(overflow)
+    *overflow = de[0].name[0] & D_OVERFLOW;
+  brelse(bp);
+  return inum;
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off, inum;
-  struct dirent de;
+  uint off, inum, n, b, home;
+  int overflow;
+  struct dentry *d;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlookup read");
-    if(de.inum == 0)
-      continue;
-    if(namecmp(name, de.name) == 0){
-      // entry matches path element
-      if(poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
-    }
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) != 0){
+    inum = d->inum;
+    off = d->off;
+    release(&dcache.lock);
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+  release(&dcache.lock);
+
+  inum = 0;
+  n = dp->size / BSIZE;
+  if(n > 0){
+    home = dirbucket(name, n);
+    inum = dirsearch(dp, home, name, &off, &overflow);
+    // A name that did not fit in its block may be in any other.
+    for(b = 0; inum == 0 && overflow && b < n; b++)
+      if(b != home)
+        inum = dirsearch(dp, b, name, &off, 0);
   }
+  if(inum == 0){
+    dcacheput(dp, name, 0, 0);
+    return 0;
+  }
+  if(poff)
+    *poff = off;
+  dcacheput(dp, name, inum, off);
+  return iget(dp->dev, inum);
+}
+
+// Put (name, inum) in a free entry of block b of dp.
+// Returns the entry's byte offset, or -1 if b is full.
+// If mark is set, mark b as overflowed if it is full.
+static int
+dirput(struct inode *dp, uint b, char *name, uint inum, int mark)
+{
+  struct buf *bp;
+  struct dirent *de;
+  int i;
 
+  bp = dirblock(dp, b);
+  de = (struct dirent*)bp->data;
+  for(i = 1; i < DPB; i++)
+    if(de[i].inum == 0)
+      break;
+  if(i < DPB){
+    memset(&de[i], 0, sizeof(de[i]));
+    strncpy(de[i].name, name, DIRSIZ);
+    de[i].inum = inum;
+    log_write(bp);
+  } else if(mark && !(de[0].name[0] & D_OVERFLOW)){
+    de[0].name[0] |= D_OVERFLOW;
+    log_write(bp);
+  }
+  brelse(bp);
+  return i < DPB ? b*BSIZE + i*sizeof(*de) : -1;
+}
+
+// Add a block to directory dp.  Unless dp was empty, split the
+// block that linear hashing says is next between it and the new
+// block.  Returns -1 if dp cannot grow.
+static int
+dirsplit(struct inode *dp)
+{
+  struct buf *ob, *nb;
+  struct dirent *od, *nd;
+  uint n, m, s, i, j, run;
+
+  n = dp->size / BSIZE;
+  if(bmap(dp, n, &run) == 0)  // allocates a zeroed block
+    return -1;
+  dp->size += BSIZE;
+  iupdate(dp);
+  if(n == 0)
+    return 0;
+
+  for(m = 1; m < n+1; m <<= 1)
+    ;
+  s = n - m/2;
+  ob = dirblock(dp, s);
+  nb = dirblock(dp, n);
+  od = (struct dirent*)ob->data;
+  nd = (struct dirent*)nb->data;
+  nd[0].name[0] = od[0].name[0];  // names moved on may be anywhere
+  j = 1;
+  for(i = 1; i < DPB; i++){
+    if(od[i].inum != 0 && dirbucket(od[i].name, n+1) == n){
+      nd[j] = od[i];
+      memset(&od[i], 0, sizeof(od[i]));
+      dcacheput(dp, nd[j].name, nd[j].inum, n*BSIZE + j*sizeof(*nd));
+      j++;
+    }
+  }
+  log_write(ob);
+  log_write(nb);
+  brelse(nb);
+  brelse(ob);
   return 0;
 }
 
@@ -552,7 +1257,7 @@ int
 dirlink(struct inode *dp, char *name, uint inum)
 {
   int off;
-  struct dirent de;
+  uint b, n;
   struct inode *ip;
 
   // Check that name is not present.
@@ -561,18 +1266,23 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
-  // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
+  // Try the name's block, then its block after a split,
+  // then any block.
+  n = dp->size / BSIZE;
+  off = -1;
+  if(n > 0)
+    off = dirput(dp, dirbucket(name, n), name, inum, 0);
+  if(off < 0){
+    if(dirsplit(dp) < 0)
+      return -1;
+    n++;
+    off = dirput(dp, dirbucket(name, n), name, inum, 1);
   }
-
-  strncpy(de.name, name, DIRSIZ);
-  de.inum = inum;
-  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+  for(b = 0; off < 0 && b < n; b++)
+    off = dirput(dp, b, name, inum, 0);
+  if(off < 0)
     panic("dirlink");
+  dcacheput(dp, name, inum, off);
 
   return 0;
 }
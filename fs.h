@@ -21,9 +21,25 @@ struct superblock {
   uint bmapstart;    // Block number of first free map block
 };
 
-#define NDIRECT 12
-#define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+// A run of len consecutive data blocks starting at block start.
+// A file's extents map its blocks in order: the first extent
+// holds the file's first len blocks, the next one the blocks
+// after those, and so on.  An extent with len 0 ends the list.
+struct extent {
+  uint start;
+  uint len;
+};
+
+// An entry of a file's extent index block: the extent block
+// that holds the file's extents from file block lbn on.
+struct extidx {
+  uint lbn;
+  uint block;
+};
+
+#define NEXTENT 6                                 // extents in the inode
+#define NIEXTENT (BSIZE / sizeof(struct extent))  // per extent block
+#define NEXTIDX (BSIZE / sizeof(struct extidx))   // extent blocks per file
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +48,8 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  struct extent ext[NEXTENT];  // First extents
+  uint extindex;        // Index of the blocks holding the rest
 };
 
 // Inodes per block.
@@ -55,3 +72,10 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// A directory is a hash table with a block of dirents per bucket
+// (see fs.c).  The first dirent of each block is a header with
+// inum 0, so that programs reading the directory skip it.
+#define DPB (BSIZE / sizeof(struct dirent))  // dirents per block
+#define D_OVERFLOW 0x1  // header name[0]: some names that hash to
+                        // this block are in other blocks
+
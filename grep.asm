@@ -0,0 +1,1612 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 b1 05 00 00       	call   60b <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 b5 05 00 00       	call   623 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 b8 0a 00 00       	push   $0xab8
+  7f:	6a 01                	push   $0x1
+  81:	e8 ea 06 00 00       	call   770 <printf>
+      exit();
+  86:	e8 58 05 00 00       	call   5e3 <exit>
+  }
+  exit();
+  8b:	e8 53 05 00 00       	call   5e3 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 98 0a 00 00       	push   $0xa98
+  97:	6a 02                	push   $0x2
+  99:	e8 d2 06 00 00       	call   770 <printf>
+    exit();
+  9e:	e8 40 05 00 00       	call   5e3 <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 31 05 00 00       	call   5e3 <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 c0 0e 00 00    	lea    0xec0(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 ce 03 00 00       	call   5fb <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf c0 0e 00 00       	mov    $0xec0,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 c0 0e 00 00 00 	movb   $0x0,0xec0(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 25 02 00 00       	call   480 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 4c 03 00 00       	call   603 <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff c0 0e 00 00    	cmp    $0xec0,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d c0 0e 00 00       	sub    $0xec0,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 c0 0e 00 00       	push   $0xec0
+ 31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4c9:	31 db                	xor    %ebx,%ebx
+{
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 01                	push   $0x1
+ 4d5:	56                   	push   %esi
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 1e 01 00 00       	call   5fb <read>
+    if(cc < 1)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ef:	3c 0a                	cmp    $0xa,%al
+ 4f1:	74 10                	je     503 <gets+0x43>
+ 4f3:	3c 0d                	cmp    $0xd,%al
+ 4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4f7:	89 df                	mov    %ebx,%edi
+ 4f9:	83 c3 01             	add    $0x1,%ebx
+ 4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4ff:	7c cf                	jl     4d0 <gets+0x10>
+ 501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50d:	5b                   	pop    %ebx
+ 50e:	5e                   	pop    %esi
+ 50f:	5f                   	pop    %edi
+ 510:	5d                   	pop    %ebp
+ 511:	c3                   	ret
+ 512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	6a 00                	push   $0x0
+ 52a:	ff 75 08             	push   0x8(%ebp)
+ 52d:	e8 f1 00 00 00       	call   623 <open>
+  if(fd < 0)
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	85 c0                	test   %eax,%eax
+ 537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 539:	83 ec 08             	sub    $0x8,%esp
+ 53c:	ff 75 0c             	push   0xc(%ebp)
+ 53f:	89 c3                	mov    %eax,%ebx
+ 541:	50                   	push   %eax
+ 542:	e8 f4 00 00 00       	call   63b <fstat>
+  close(fd);
+ 547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 54c:	e8 ba 00 00 00       	call   60b <close>
+  return r;
+ 551:	83 c4 10             	add    $0x10,%esp
+}
+ 554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 557:	89 f0                	mov    %esi,%eax
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb ed                	jmp    554 <stat+0x34>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 577:	0f be 02             	movsbl (%edx),%eax
+ 57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 585:	77 1e                	ja     5a5 <atoi+0x35>
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 590:	83 c2 01             	add    $0x1,%edx
+ 593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 59a:	0f be 02             	movsbl (%edx),%eax
+ 59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5a0:	80 fb 09             	cmp    $0x9,%bl
+ 5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	89 c8                	mov    %ecx,%eax
+ 5aa:	c9                   	leave
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+
+000005db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <exit>:
+SYSCALL(exit)
+ 5e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <wait>:
+SYSCALL(wait)
+ 5eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <pipe>:
+SYSCALL(pipe)
+ 5f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <read>:
+SYSCALL(read)
+ 5fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <write>:
+SYSCALL(write)
+ 603:	b8 10 00 00 00       	mov    $0x10,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <close>:
+SYSCALL(close)
+ 60b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <kill>:
+SYSCALL(kill)
+ 613:	b8 06 00 00 00       	mov    $0x6,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <exec>:
+SYSCALL(exec)
+ 61b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <open>:
+SYSCALL(open)
+ 623:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <mknod>:
+SYSCALL(mknod)
+ 62b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <unlink>:
+SYSCALL(unlink)
+ 633:	b8 12 00 00 00       	mov    $0x12,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <fstat>:
+SYSCALL(fstat)
+ 63b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <link>:
+SYSCALL(link)
+ 643:	b8 13 00 00 00       	mov    $0x13,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <mkdir>:
+SYSCALL(mkdir)
+ 64b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <chdir>:
+SYSCALL(chdir)
+ 653:	b8 09 00 00 00       	mov    $0x9,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <dup>:
+SYSCALL(dup)
+ 65b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getpid>:
+SYSCALL(getpid)
+ 663:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <sbrk>:
+SYSCALL(sbrk)
+ 66b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <sleep>:
+SYSCALL(sleep)
+ 673:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <uptime>:
+SYSCALL(uptime)
+ 67b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <printinfo>:
+SYSCALL(printinfo)
+ 683:	b8 16 00 00 00       	mov    $0x16,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <sched_policy>:
+SYSCALL(sched_policy)
+ 68b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <exec_time>:
+SYSCALL(exec_time)
+ 693:	b8 18 00 00 00       	mov    $0x18,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <deadline>:
+SYSCALL(deadline)
+ 69b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <rate>:
+SYSCALL(rate)
+ 6a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <mmap>:
+SYSCALL(mmap)
+ 6ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <munmap>:
+SYSCALL(munmap)
+ 6b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <bcstat>:
+SYSCALL(bcstat)
+ 6bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <splice>:
+SYSCALL(splice)
+ 6c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+ 6cb:	66 90                	xchg   %ax,%ax
+ 6cd:	66 90                	xchg   %ax,%ax
+ 6cf:	90                   	nop
+
+000006d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6d8:	89 d1                	mov    %edx,%ecx
+{
+ 6da:	83 ec 3c             	sub    $0x3c,%esp
+ 6dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6e0:	85 d2                	test   %edx,%edx
+ 6e2:	0f 89 80 00 00 00    	jns    768 <printint+0x98>
+ 6e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6ec:	74 7a                	je     768 <printint+0x98>
+    x = -xx;
+ 6ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6f8:	31 f6                	xor    %esi,%esi
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 700:	89 c8                	mov    %ecx,%eax
+ 702:	31 d2                	xor    %edx,%edx
+ 704:	89 f7                	mov    %esi,%edi
+ 706:	f7 f3                	div    %ebx
+ 708:	8d 76 01             	lea    0x1(%esi),%esi
+ 70b:	0f b6 92 30 0b 00 00 	movzbl 0xb30(%edx),%edx
+ 712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 716:	89 ca                	mov    %ecx,%edx
+ 718:	89 c1                	mov    %eax,%ecx
+ 71a:	39 da                	cmp    %ebx,%edx
+ 71c:	73 e2                	jae    700 <printint+0x30>
+  if(neg)
+ 71e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 721:	85 c0                	test   %eax,%eax
+ 723:	74 07                	je     72c <printint+0x5c>
+    buf[i++] = '-';
+ 725:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 72a:	89 f7                	mov    %esi,%edi
+ 72c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 72f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 732:	01 df                	add    %ebx,%edi
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 738:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 741:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 744:	6a 01                	push   $0x1
+ 746:	50                   	push   %eax
+ 747:	56                   	push   %esi
+ 748:	e8 b6 fe ff ff       	call   603 <write>
+  while(--i >= 0)
+ 74d:	89 f8                	mov    %edi,%eax
+ 74f:	83 c4 10             	add    $0x10,%esp
+ 752:	83 ef 01             	sub    $0x1,%edi
+ 755:	39 d8                	cmp    %ebx,%eax
+ 757:	75 df                	jne    738 <printint+0x68>
+}
+ 759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 75c:	5b                   	pop    %ebx
+ 75d:	5e                   	pop    %esi
+ 75e:	5f                   	pop    %edi
+ 75f:	5d                   	pop    %ebp
+ 760:	c3                   	ret
+ 761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 768:	31 c0                	xor    %eax,%eax
+ 76a:	eb 89                	jmp    6f5 <printint+0x25>
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000770 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 779:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 77c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 77f:	0f b6 1e             	movzbl (%esi),%ebx
+ 782:	83 c6 01             	add    $0x1,%esi
+ 785:	84 db                	test   %bl,%bl
+ 787:	74 67                	je     7f0 <printf+0x80>
+ 789:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 78c:	31 d2                	xor    %edx,%edx
+ 78e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 791:	eb 34                	jmp    7c7 <printf+0x57>
+ 793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 797:	90                   	nop
+ 798:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 79b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7a0:	83 f8 25             	cmp    $0x25,%eax
+ 7a3:	74 18                	je     7bd <printf+0x4d>
+  write(fd, &c, 1);
+ 7a5:	83 ec 04             	sub    $0x4,%esp
+ 7a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ae:	6a 01                	push   $0x1
+ 7b0:	50                   	push   %eax
+ 7b1:	57                   	push   %edi
+ 7b2:	e8 4c fe ff ff       	call   603 <write>
+ 7b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c0:	83 c6 01             	add    $0x1,%esi
+ 7c3:	84 db                	test   %bl,%bl
+ 7c5:	74 29                	je     7f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ca:	85 d2                	test   %edx,%edx
+ 7cc:	74 ca                	je     798 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ce:	83 fa 25             	cmp    $0x25,%edx
+ 7d1:	75 ea                	jne    7bd <printf+0x4d>
+      if(c == 'd'){
+ 7d3:	83 f8 25             	cmp    $0x25,%eax
+ 7d6:	0f 84 24 01 00 00    	je     900 <printf+0x190>
+ 7dc:	83 e8 63             	sub    $0x63,%eax
+ 7df:	83 f8 15             	cmp    $0x15,%eax
+ 7e2:	77 1c                	ja     800 <printf+0x90>
+ 7e4:	ff 24 85 d8 0a 00 00 	jmp    *0xad8(,%eax,4)
+ 7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7f3:	5b                   	pop    %ebx
+ 7f4:	5e                   	pop    %esi
+ 7f5:	5f                   	pop    %edi
+ 7f6:	5d                   	pop    %ebp
+ 7f7:	c3                   	ret
+ 7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 806:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 80a:	6a 01                	push   $0x1
+ 80c:	52                   	push   %edx
+ 80d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 810:	57                   	push   %edi
+ 811:	e8 ed fd ff ff       	call   603 <write>
+ 816:	83 c4 0c             	add    $0xc,%esp
+ 819:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 81c:	6a 01                	push   $0x1
+ 81e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 821:	52                   	push   %edx
+ 822:	57                   	push   %edi
+ 823:	e8 db fd ff ff       	call   603 <write>
+        putc(fd, c);
+ 828:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 82b:	31 d2                	xor    %edx,%edx
+ 82d:	eb 8e                	jmp    7bd <printf+0x4d>
+ 82f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 00                	push   $0x0
+ 83f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 841:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 844:	e8 87 fe ff ff       	call   6d0 <printint>
+        ap++;
+ 849:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 84c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 67 ff ff ff       	jmp    7bd <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 860:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 863:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 865:	83 c0 04             	add    $0x4,%eax
+ 868:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 86b:	85 db                	test   %ebx,%ebx
+ 86d:	0f 84 9d 00 00 00    	je     910 <printf+0x1a0>
+        while(*s != 0){
+ 873:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 876:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 878:	84 c0                	test   %al,%al
+ 87a:	0f 84 3d ff ff ff    	je     7bd <printf+0x4d>
+ 880:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 883:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 886:	89 de                	mov    %ebx,%esi
+ 888:	89 d3                	mov    %edx,%ebx
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 896:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 899:	6a 01                	push   $0x1
+ 89b:	53                   	push   %ebx
+ 89c:	57                   	push   %edi
+ 89d:	e8 61 fd ff ff       	call   603 <write>
+        while(*s != 0){
+ 8a2:	0f b6 06             	movzbl (%esi),%eax
+ 8a5:	83 c4 10             	add    $0x10,%esp
+ 8a8:	84 c0                	test   %al,%al
+ 8aa:	75 e4                	jne    890 <printf+0x120>
+      state = 0;
+ 8ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 07 ff ff ff       	jmp    7bd <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8cb:	8b 13                	mov    (%ebx),%edx
+ 8cd:	6a 01                	push   $0x1
+ 8cf:	e9 6b ff ff ff       	jmp    83f <printf+0xcf>
+ 8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8db:	83 ec 04             	sub    $0x4,%esp
+ 8de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	52                   	push   %edx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 11 fd ff ff       	call   603 <write>
+        ap++;
+ 8f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8f8:	31 d2                	xor    %edx,%edx
+ 8fa:	e9 be fe ff ff       	jmp    7bd <printf+0x4d>
+ 8ff:	90                   	nop
+  write(fd, &c, 1);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 906:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 909:	6a 01                	push   $0x1
+ 90b:	e9 11 ff ff ff       	jmp    821 <printf+0xb1>
+ 910:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 915:	bb ce 0a 00 00       	mov    $0xace,%ebx
+ 91a:	e9 61 ff ff ff       	jmp    880 <printf+0x110>
+ 91f:	90                   	nop
+
+00000920 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 920:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 921:	a1 c0 12 00 00       	mov    0x12c0,%eax
+{
+ 926:	89 e5                	mov    %esp,%ebp
+ 928:	57                   	push   %edi
+ 929:	56                   	push   %esi
+ 92a:	53                   	push   %ebx
+ 92b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 92e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 938:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 93a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 93c:	39 ca                	cmp    %ecx,%edx
+ 93e:	73 30                	jae    970 <free+0x50>
+ 940:	39 c1                	cmp    %eax,%ecx
+ 942:	72 04                	jb     948 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 944:	39 c2                	cmp    %eax,%edx
+ 946:	72 f0                	jb     938 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 948:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 94b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 94e:	39 f8                	cmp    %edi,%eax
+ 950:	74 2e                	je     980 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 952:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 955:	8b 42 04             	mov    0x4(%edx),%eax
+ 958:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 95b:	39 f1                	cmp    %esi,%ecx
+ 95d:	74 38                	je     997 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 95f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 961:	5b                   	pop    %ebx
+  freep = p;
+ 962:	89 15 c0 12 00 00    	mov    %edx,0x12c0
+}
+ 968:	5e                   	pop    %esi
+ 969:	5f                   	pop    %edi
+ 96a:	5d                   	pop    %ebp
+ 96b:	c3                   	ret
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 970:	39 c1                	cmp    %eax,%ecx
+ 972:	72 d0                	jb     944 <free+0x24>
+ 974:	eb c2                	jmp    938 <free+0x18>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 980:	03 70 04             	add    0x4(%eax),%esi
+ 983:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 986:	8b 02                	mov    (%edx),%eax
+ 988:	8b 00                	mov    (%eax),%eax
+ 98a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 98d:	8b 42 04             	mov    0x4(%edx),%eax
+ 990:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 993:	39 f1                	cmp    %esi,%ecx
+ 995:	75 c8                	jne    95f <free+0x3f>
+    p->s.size += bp->s.size;
+ 997:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 99a:	89 15 c0 12 00 00    	mov    %edx,0x12c0
+    p->s.size += bp->s.size;
+ 9a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9a8:	5b                   	pop    %ebx
+ 9a9:	5e                   	pop    %esi
+ 9aa:	5f                   	pop    %edi
+ 9ab:	5d                   	pop    %ebp
+ 9ac:	c3                   	ret
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9bc:	8b 15 c0 12 00 00    	mov    0x12c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9c5:	c1 ef 03             	shr    $0x3,%edi
+ 9c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9cb:	85 d2                	test   %edx,%edx
+ 9cd:	0f 84 8d 00 00 00    	je     a60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9d8:	39 f9                	cmp    %edi,%ecx
+ 9da:	73 64                	jae    a40 <malloc+0x90>
+  if(nu < 4096)
+ 9dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9e1:	39 df                	cmp    %ebx,%edi
+ 9e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9ed:	eb 0a                	jmp    9f9 <malloc+0x49>
+ 9ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9f5:	39 f9                	cmp    %edi,%ecx
+ 9f7:	73 47                	jae    a40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9f9:	89 c2                	mov    %eax,%edx
+ 9fb:	39 05 c0 12 00 00    	cmp    %eax,0x12c0
+ a01:	75 ed                	jne    9f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	56                   	push   %esi
+ a07:	e8 5f fc ff ff       	call   66b <sbrk>
+  if(p == (char*)-1)
+ a0c:	83 c4 10             	add    $0x10,%esp
+ a0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a12:	74 1c                	je     a30 <malloc+0x80>
+  hp->s.size = nu;
+ a14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a17:	83 ec 0c             	sub    $0xc,%esp
+ a1a:	83 c0 08             	add    $0x8,%eax
+ a1d:	50                   	push   %eax
+ a1e:	e8 fd fe ff ff       	call   920 <free>
+  return freep;
+ a23:	8b 15 c0 12 00 00    	mov    0x12c0,%edx
+      if((p = morecore(nunits)) == 0)
+ a29:	83 c4 10             	add    $0x10,%esp
+ a2c:	85 d2                	test   %edx,%edx
+ a2e:	75 c0                	jne    9f0 <malloc+0x40>
+        return 0;
+  }
+}
+ a30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a33:	31 c0                	xor    %eax,%eax
+}
+ a35:	5b                   	pop    %ebx
+ a36:	5e                   	pop    %esi
+ a37:	5f                   	pop    %edi
+ a38:	5d                   	pop    %ebp
+ a39:	c3                   	ret
+ a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a40:	39 cf                	cmp    %ecx,%edi
+ a42:	74 4c                	je     a90 <malloc+0xe0>
+        p->s.size -= nunits;
+ a44:	29 f9                	sub    %edi,%ecx
+ a46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a4f:	89 15 c0 12 00 00    	mov    %edx,0x12c0
+}
+ a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a58:	83 c0 08             	add    $0x8,%eax
+}
+ a5b:	5b                   	pop    %ebx
+ a5c:	5e                   	pop    %esi
+ a5d:	5f                   	pop    %edi
+ a5e:	5d                   	pop    %ebp
+ a5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a60:	c7 05 c0 12 00 00 c4 	movl   $0x12c4,0x12c0
+ a67:	12 00 00 
+    base.s.size = 0;
+ a6a:	b8 c4 12 00 00       	mov    $0x12c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ a6f:	c7 05 c4 12 00 00 c4 	movl   $0x12c4,0x12c4
+ a76:	12 00 00 
+    base.s.size = 0;
+ a79:	c7 05 c8 12 00 00 00 	movl   $0x0,0x12c8
+ a80:	00 00 00 
+    if(p->s.size >= nunits){
+ a83:	e9 54 ff ff ff       	jmp    9dc <malloc+0x2c>
+ a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a90:	8b 08                	mov    (%eax),%ecx
+ a92:	89 0a                	mov    %ecx,(%edx)
+ a94:	eb b9                	jmp    a4f <malloc+0x9f>
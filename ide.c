@@ -1,4 +1,8 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code.
+//
+// Transfers use bus-master DMA if the PCI IDE controller
+// supports it (the PIIX that QEMU emulates does), and
+// PIO through port 0x1f0 otherwise.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +16,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,15 +28,52 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMULT 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+#define IDE_MULT      8   // sectors per READ/WRITE MULTIPLE command
+#define IDE_DMAMAX    32  // sectors per DMA command
+
+// Bus-master DMA registers, primary channel, at idebm.
+#define BM_CMD        0   // command
+#define BM_CMD_START  0x1 //   start transfer
+#define BM_CMD_READ   0x8 //   transfer into memory
+#define BM_STATUS     2   // status; write 1s to clear ERR, INTR
+#define BM_ST_ERR     0x2
+#define BM_ST_INTR    0x4
+#define BM_PRDT       4   // physical address of PRD table
+
+// A physical region descriptor: one piece of a DMA transfer,
+// which must not cross a 64KB boundary.
+struct prd {
+  uint addr;
+  ushort len;      // bytes
+  ushort flags;
+};
+#define PRD_EOT 0x8000  // last descriptor in table
+
+#define NPRD (2*IDE_DMAMAX)  // each block may be split in two
+
+// idequeue points to the bufs now being read/written to the disk:
+// the first idenrun of them, which are consecutive blocks, are
+// transferred by a single command.  The rest of the queue is the
+// elevator: it is kept in C-LOOK order, ascending block numbers
+// from idehead, the last block the disk was asked for, and then
+// wrapping around to the lowest block.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenrun;
+static uint idehead;
 
 static int havedisk1;
+static int idemult[2];  // sectors per multiple command, per disk; 0 if none
+static ushort idebm;    // bus-master registers; 0 if no DMA
+static struct prd prdt[NPRD] __attribute__((__aligned__(sizeof(struct prd)*NPRD)));
+static int idesetmult(int);
+static void idedmainit(void);
 static void idestart(struct buf*);
 
 // Wait for IDE disk to become ready.
@@ -65,38 +107,159 @@ ideinit(void)
     }
   }
 
+  idemult[0] = idesetmult(0);
+  if(havedisk1)
+    idemult[1] = idesetmult(1);
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  idedmainit();
+}
+
+// Look for a bus-master capable PCI IDE controller (class 1,
+// subclass 1, programming interface bit 7), and if there is
+// one, do transfers by DMA.
+static void
+idedmainit(void)
+{
+  struct pcidev d;
+
+  if(pcifindclass(0x01, 0x01, &d) < 0 || (d.progif & 0x80) == 0)
+    return;
+  if((d.bar[4] & PCI_BAR_IO) == 0)
+    return;
+  pcienable(&d);
+  idebm = d.bar[4] & ~3;
+  outb(idebm + BM_CMD, 0);
+  outb(idebm + BM_STATUS, BM_ST_ERR | BM_ST_INTR);
+  outl(idebm + BM_PRDT, V2P(prdt));
+}
+
+// Fill in prdt for a transfer of the data of n queued bufs,
+// starting with b.
+static void
+idedmaprep(struct buf *b, int n)
+{
+  struct buf *c;
+  struct prd *p;
+  uint pa, len, m;
+
+  p = prdt;
+  for(c = b; n > 0; c = c->qnext, n--){
+    pa = V2P(c->data);
+    for(len = BSIZE; len > 0; len -= m, pa += m, p++){
+      m = 0x10000 - (pa & 0xffff);
+      if(m > len)
+        m = len;
+      p->addr = pa;
+      p->len = m;
+      p->flags = 0;
+    }
+  }
+  p[-1].flags = PRD_EOT;
+}
+
+// Put disk d in multiple mode, so that READ/WRITE MULTIPLE move
+// up to IDE_MULT sectors per interrupt.  Returns that count,
+// or 0 if the disk refused.
+static int
+idesetmult(int d)
+{
+  outb(0x1f6, 0xe0 | (d<<4));
+  idewait(0);
+  outb(0x3f6, 2);  // no interrupt; idewait() reads the status
+  outb(0x1f2, IDE_MULT);
+  outb(0x1f7, IDE_CMD_SETMULT);
+  if(idewait(1) < 0)
+    return 0;
+  return IDE_MULT;
+}
+
+// Position of b in the C-LOOK sweep that starts after idehead.
+static uint
+ideorder(struct buf *b)
+{
+  uint key;
+
+  key = (b->dev&1)*FSSIZE + BDISKNO(b);
+  return key > idehead ? key : key + 2*FSSIZE;
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Insert b into the elevator.  Caller must hold idelock.
+static void
+ideinsert(struct buf *b)
+{
+  struct buf **pp;
+  int i;
+
+  pp = &idequeue;
+  for(i = 0; i < idenrun; i++)  // skip the active command
+    pp = &(*pp)->qnext;
+  while(*pp && ideorder(*pp) <= ideorder(b))
+    pp = &(*pp)->qnext;
+  b->qnext = *pp;
+  *pp = b;
+}
+
+// Start the request for b, merged with the requests after it in
+// the queue for the following blocks, if they go the same way
+// and the disk can take them in one DMA or multiple-sector
+// command.  Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *c;
+  int n, mult;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  if(BDISKNO(b) >= FSSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
+  int sector = BDISKNO(b) * sector_per_block;
   int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
   int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
   if (sector_per_block > 7) panic("idestart");
 
+  n = 1;
+  mult = idebm ? IDE_DMAMAX : idemult[b->dev&1];
+  for(c = b->qnext; c && (n+1)*sector_per_block <= mult; c = c->qnext){
+    if(c->dev != b->dev || BDISKNO(c) != BDISKNO(b) + n ||
+       (c->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+    n++;
+  }
+  if(idebm){
+    read_cmd = IDE_CMD_RDDMA;
+    write_cmd = IDE_CMD_WRDMA;
+    idedmaprep(b, n);
+    outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_CMD_READ);
+    outb(idebm + BM_STATUS, BM_ST_ERR | BM_ST_INTR);
+  } else if(mult > 0){
+    read_cmd = IDE_CMD_RDMUL;
+    write_cmd = IDE_CMD_WRMUL;
+  }
+  idenrun = n;
+  idehead = (b->dev&1)*FSSIZE + BDISKNO(b) + n - 1;
+
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, n*sector_per_block);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
   if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    for(c = b; n > 0 && !idebm; c = c->qnext, n--)
+      outsl(0x1f0, c->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
+  if(idebm)
+    outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_CMD_START);
 }
 
 // Interrupt handler.
@@ -104,24 +267,45 @@ void
 ideintr(void)
 {
   struct buf *b;
+  int pioread, st;
 
-  // First queued buffer is the active request.
+  // The first idenrun queued buffers are the active request.
   acquire(&idelock);
 
   if((b = idequeue) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(idebm){
+    // Stop the DMA engine.  If the transfer failed, fall
+    // back to PIO and start the same request again.
+    st = inb(idebm + BM_STATUS);
+    outb(idebm + BM_CMD, 0);
+    outb(idebm + BM_STATUS, BM_ST_ERR | BM_ST_INTR);
+    if(idewait(1) < 0 || (st & BM_ST_ERR)){
+      cprintf("ide: DMA failed, using PIO\n");
+      idebm = 0;
+      idestart(b);
+      release(&idelock);
+      return;
+    }
+    pioread = 0;  // data is already in place
+  } else
+    pioread = !(b->flags & B_DIRTY) && idewait(1) >= 0;
+
+  for(; idenrun > 0; idenrun--){
+    b = idequeue;
+    idequeue = b->qnext;
+
+    // Read data if needed.
+    if(pioread)
+      insl(0x1f0, b->data, BSIZE/4);
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    // Wake the process waiting for this buf's group,
+    // or release the buf if nobody is waiting.
+    biodone(b);
+  }
 
   // Start disk on next buf in queue.
   if(idequeue != 0)
@@ -131,38 +315,71 @@ ideintr(void)
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Queue n locked bufs for the disk and return without waiting.
+// Each buf is synced as iderw() describes.  If g is not 0, it
+// counts the requests still pending, and idewaitgroup(g) waits
+// until they are all done; otherwise each buf must be B_ASYNC.
 void
-iderw(struct buf *b)
+idesubmit(struct buf **bufs, int n, struct iogroup *g)
 {
-  struct buf **pp;
+  struct buf *b;
+  int i, idle;
 
-  if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
-  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
-  if(b->dev != 0 && !havedisk1)
-    panic("iderw: ide disk 1 not present");
+  if(n <= 0)
+    return;
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  // Add the bufs to idequeue.
+  idle = (idequeue == 0);
+  for(i = 0; i < n; i++){
+    b = bufs[i];
+    if(!holdingsleep(&b->lock))
+      panic("iderw: buf not locked");
+    if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("iderw: nothing to do");
+    if(b->dev != 0 && !havedisk1)
+      panic("iderw: ide disk 1 not present");
+    if(g == 0 && (b->flags & B_ASYNC) == 0)
+      panic("idesubmit: nobody waits");
+    b->group = g;
+    if(g)
+      g->pending++;
+    ideinsert(b);  //DOC:insert-queue
+  }
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
-
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
-    sleep(b, &idelock);
-  }
+  if(idle)
+    idestart(idequeue);
 
+  release(&idelock);
+}
 
+// Wait for all the requests counted in g to finish.
+void
+idewaitgroup(struct iogroup *g)
+{
+  acquire(&idelock);
+  while(g->pending > 0)
+    sleep(g, &idelock);
   release(&idelock);
 }
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return at once; ideintr() will release
+// the buf with bdone() when the request is done.
+void
+iderw(struct buf *b)
+{
+  struct iogroup g;
+
+  if(b->flags & B_ASYNC){
+    idesubmit(&b, 1, 0);
+    return;
+  }
+  g.pending = 0;
+  idesubmit(&b, 1, &g);
+  idewaitgroup(&g);
+}
@@ -73,3 +73,12 @@ ioapicenable(int irq, int cpunum)
   ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
   ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
 }
+
+// Like ioapicenable, but deliver irq on the vector of IRQ alias,
+// for devices whose IRQ is only known at run time (PCI).
+void
+ioapicroute(int irq, int alias, int cpunum)
+{
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + alias);
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+}
@@ -9,29 +9,52 @@
 // Simple logging that allows concurrent FS system calls.
 //
 // A log transaction contains the updates of multiple FS system
-// calls. The logging system only commits when there are
-// no FS system calls active. Thus there is never
-// any reasoning required about whether a commit might
-// write an uncommitted system call's updates to disk.
+// calls. A transaction only commits when none of its FS system
+// calls are active. Thus there is never any reasoning required
+// about whether a commit might write an uncommitted system
+// call's updates to disk.
+//
+// There are two transactions in memory.  New FS system calls
+// join the open one.  When its last system call ends, that
+// process closes it: it locks the transaction's buffers and
+// commits it, and a new transaction opens at once, so other
+// system calls carry on while the commit waits for the disk.
+// They wait only if they need a block that is being committed.
+// If the open transaction ends while another is committing, the
+// committer commits it next, grouping all the system calls that
+// ran meanwhile into one commit.  A small transaction that had
+// company waits up to COMMITDELAY ticks for more system calls
+// to join before it closes.
+//
+// Committing only makes a transaction durable: its blocks are
+// appended to the log after those of the transactions before
+// it, and the header is rewritten to cover them.  The flusher
+// kernel thread installs committed blocks at their home
+// locations in the background and then drops them from the log.
+// Until then they stay pinned in the buffer cache.
 //
 // A system call should call begin_op()/end_op() to mark
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until the flusher has made room.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
-//   block A
-//   block B
-//   block C
+//   header block, containing the first slot in use, the number
+//     of slots in use, and the block # held by each slot
+//   slot 0
+//   slot 1
 //   ...
-// Log appends are synchronous.
+// The slots in use hold committed blocks, oldest first.  A block
+// may be in more than one of them; the last one is current.
+// When the flusher empties the log, the next commit starts
+// again at slot 0.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
 struct logheader {
+  int start;
   int n;
   int block[LOGSIZE];
 };
@@ -41,14 +64,25 @@ struct log {
   int start;
   int size;
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int nops;        // FS sys calls that joined the open transaction.
+  int delayed;     // the open transaction has waited for company.
+  int closing;     // closing the open transaction, please wait.
+  int committing;  // in commit().
   int dev;
-  struct logheader lh;
+  struct logheader lh;    // the open transaction
+  struct logheader clh;   // the committing transaction
+  struct logheader dh;    // committed, not yet installed; on disk
+  struct buf *buf[LOGSIZE]; // clh's blocks, locked by the committer
+  struct sleeplock headlock; // held to append to the log or
+                             // to rewrite the header
 };
 struct log log;
 
+#define COMMITDELAY 1  // ticks a small transaction waits for company
+
 static void recover_from_log(void);
 static void commit();
+static void flusher(void);
 
 void
 initlog(int dev)
@@ -58,27 +92,56 @@ initlog(int dev)
 
   struct superblock sb;
   initlock(&log.lock, "log");
+  initsleeplock(&log.headlock, "loghead");
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
   log.dev = dev;
+  if (log.size < LOGSIZE+1)
+    panic("initlog: log too small");
   recover_from_log();
+  kthread("flusher", flusher);
+}
+
+// Log slots, including those reserved by transactions
+// not yet committed.  Caller must hold log.lock.
+static int
+logused(void)
+{
+  return log.dh.start + log.dh.n + log.clh.n + log.lh.n;
+}
+
+// Is the block in log slot s logged again before slot end?
+static int
+superseded(int s, int end)
+{
+  int i;
+
+  for (i = s+1; i < end; i++) {
+    if (log.dh.block[i] == log.dh.block[s])
+      return 1;
+  }
+  return 0;
 }
 
 // Copy committed blocks from log to their home location
 static void
-install_trans(void)
+recover_trans(void)
 {
-  int tail;
+  struct iogroup g;
+  struct buf *lbuf;
+  int s, end;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
+  g.pending = 0;
+  end = log.dh.start + log.dh.n;
+  for (s = log.dh.start; s < end; s++) {
+    if (superseded(s, end))
+      continue;
+    lbuf = bread(log.dev, log.start+s+1); // read log block
+    lbuf->redir = log.dh.block[s];        // write it to its home
+    bawrite(lbuf, &g);
   }
+  idewaitgroup(&g);
 }
 
 // Read the log header from disk into the in-memory log header
@@ -88,25 +151,29 @@ read_head(void)
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *lh = (struct logheader *) (buf->data);
   int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  log.dh.start = lh->start;
+  log.dh.n = lh->n;
+  if (log.dh.start < 0 || log.dh.n < 0 || log.dh.start + log.dh.n > LOGSIZE)
+    panic("read_head: bad log");
+  for (i = log.dh.start; i < log.dh.start + log.dh.n; i++) {
+    log.dh.block[i] = lh->block[i];
   }
   brelse(buf);
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
+// Write the in-memory log header to disk, covering n slots from
+// log.dh.start.  This is the true point at which a transaction
+// commits.  Caller must hold log.headlock.
 static void
-write_head(void)
+write_head(int n)
 {
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  hb->start = log.dh.start;
+  hb->n = n;
+  for (i = log.dh.start; i < log.dh.start + n; i++) {
+    hb->block[i] = log.dh.block[i];
   }
   bwrite(buf);
   brelse(buf);
@@ -116,9 +183,10 @@ static void
 recover_from_log(void)
 {
   read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  recover_trans(); // if committed, copy from log to disk
+  log.dh.start = 0;
+  log.dh.n = 0;
+  write_head(0); // clear the log
 }
 
 // called at the start of each FS system call.
@@ -127,82 +195,239 @@ begin_op(void)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.closing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
+    } else if(logused() + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+      // this op might exhaust log space; wait for the flusher.
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      log.nops += 1;
       release(&log.lock);
       break;
     }
   }
 }
 
-// called at the end of each FS system call.
-// commits if this was the last outstanding operation.
-void
-end_op(void)
+// Sleep for n clock ticks.
+static void
+delay(uint n)
 {
-  int do_commit = 0;
+  uint ticks0;
 
-  acquire(&log.lock);
-  log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
+  acquire(&tickslock);
+  ticks0 = ticks;
+  while(ticks - ticks0 < n)
+    sleep(&ticks, &tickslock);
+  release(&tickslock);
+}
+
+// Can the open transaction be closed now?
+// Caller must hold log.lock.
+static int
+closable(void)
+{
+  return log.outstanding == 0 && log.lh.n > 0 &&
+         !log.closing && !log.committing;
+}
+
+// Close the open transaction and commit it, then any transaction
+// that became ready meanwhile.  Called and returns with log.lock
+// held, but releases it while committing.
+static void
+closeandcommit(void)
+{
+  int i;
+
+  while(closable()){
+    // Make the open transaction the committing one, and lock
+    // its buffers before any new FS system call can touch them.
+    log.closing = 1;
+    log.clh = log.lh;
+    log.lh.n = 0;
+    log.nops = 0;
+    log.delayed = 0;
+    release(&log.lock);
+    for (i = 0; i < log.clh.n; i++)
+      log.buf[i] = bread(log.dev, log.clh.block[i]);
+
+    acquire(&log.lock);
+    log.closing = 0;
     log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
     wakeup(&log);
-  }
-  release(&log.lock);
+    release(&log.lock);
 
-  if(do_commit){
     // call commit w/o holding locks, since not allowed
     // to sleep with locks.
     commit();
+
     acquire(&log.lock);
     log.committing = 0;
     wakeup(&log);
+  }
+}
+
+// called at the end of each FS system call.
+// commits if this was the last outstanding operation.
+void
+end_op(void)
+{
+  acquire(&log.lock);
+  log.outstanding -= 1;
+  if(log.outstanding < 0)
+    panic("end_op");
+  // begin_op() may be waiting for log space,
+  // and decrementing log.outstanding has decreased
+  // the amount of reserved space.
+  wakeup(&log);
+
+  if(log.outstanding == 0 && log.lh.n == 0)
+    log.nops = 0;  // nothing was written
+
+  // Give a small transaction that had company
+  // a moment to collect more system calls.
+  if(closable() && !log.delayed && log.nops > 1 && log.lh.n < LOGSIZE/2){
+    log.delayed = 1;
     release(&log.lock);
+    delay(COMMITDELAY);
+    acquire(&log.lock);
   }
+
+  closeandcommit();
+  release(&log.lock);
 }
 
-// Copy modified blocks from cache to log.
+// Write modified blocks straight from the cache to the log,
+// from slot tail on.  The slots are contiguous, so the disk
+// driver merges the writes into as few commands as it can.
 static void
-write_log(void)
+write_log(int tail)
 {
-  int tail;
+  int i;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
-  }
+  for (i = 0; i < log.clh.n; i++)
+    log.buf[i]->redir = log.start+tail+i+1;
+  bwritev(log.buf, log.clh.n);
 }
 
+// Append the committing transaction to the log and make it
+// durable.  Its buffers stay pinned until the flusher has
+// installed them.
 static void
 commit()
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+  int tail, n, i;
+
+  n = log.clh.n;
+  acquiresleep(&log.headlock);
+  tail = log.dh.start + log.dh.n;
+  write_log(tail);  // Write modified blocks from cache to log
+  for (i = 0; i < n; i++)
+    log.dh.block[tail+i] = log.clh.block[i];
+  write_head(log.dh.n + n);  // Write header to disk -- the real commit
+  acquire(&log.lock);
+  log.dh.n += n;
+  log.clh.n = 0;
+  wakeup(&log.dh);  // something for the flusher to install
+  release(&log.lock);
+  releasesleep(&log.headlock);
+
+  for (i = 0; i < n; i++)
+    brelse(log.buf[i]);
+}
+
+// Is block b logged after slot end, or in a transaction
+// that is not committed?  Caller must hold log.lock.
+static int
+relogged(uint b, int end)
+{
+  int i;
+
+  for (i = end; i < log.dh.start + log.dh.n; i++)
+    if (log.dh.block[i] == b)
+      return 1;
+  for (i = 0; i < log.clh.n; i++)
+    if (log.clh.block[i] == b)
+      return 1;
+  for (i = 0; i < log.lh.n; i++)
+    if (log.lh.block[i] == b)
+      return 1;
+  return 0;
+}
+
+// Install the blocks committed in log slots [start, end) at
+// their home locations, each at its latest version among them,
+// and unpin them.  A block that nobody has logged since is
+// written from the cache.  Otherwise the cache holds a newer
+// version that may not be durable yet, so the block is
+// written from its log slot instead.
+static void
+install_trans(int start, int end)
+{
+  struct iogroup g;
+  struct buf *b, *home[LOGSIZE];
+  int s, i, n, newer;
+
+  g.pending = 0;
+  n = 0;
+  for (s = start; s < end; s++) {
+    if (superseded(s, end))
+      continue;
+    b = bread(log.dev, log.dh.block[s]); // pinned, so cached
+    home[n++] = b;
+    acquire(&log.lock);
+    newer = relogged(b->blockno, end);
+    release(&log.lock);
+    if (newer) {
+      brelse(b);
+      b = breadfresh(log.dev, log.start+s+1); // read log block
+      b->redir = log.dh.block[s];        // write it to its home
+    }
+    bawrite(b, &g);
+  }
+  idewaitgroup(&g);
+
+  // Drop the pin that each slot holds on its block.
+  for (s = start; s < end; s++) {
+    for (i = 0; log.dh.block[s] != home[i]->blockno; i++)
+      ;
+    bunpin(home[i]);
+  }
+}
+
+// The flusher kernel thread.  Install whatever is committed,
+// then drop it from the log to make room.
+static void
+flusher(void)
+{
+  int start, end;
+
+  for (;;) {
+    acquire(&log.lock);
+    while (log.dh.n == 0)
+      sleep(&log.dh, &log.lock);
+    start = log.dh.start;
+    end = start + log.dh.n;
+    release(&log.lock);
+
+    install_trans(start, end);
+
+    acquiresleep(&log.headlock);
+    acquire(&log.lock);
+    log.dh.n -= end - start;
+    log.dh.start = log.dh.n > 0 ? end : 0;
+    release(&log.lock);
+    write_head(log.dh.n);  // Erase the installed blocks from the log
+    releasesleep(&log.headlock);
+
+    acquire(&log.lock);
+    wakeup(&log);  // begin_op() may be waiting for log space
+    release(&log.lock);
   }
 }
 
 // Caller has modified b->data and is done with the buffer.
-// Record the block number and pin in the cache with B_DIRTY.
+// Record the block number and pin the buffer in the cache.
 // commit()/write_log() will do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
@@ -215,20 +440,20 @@ log_write(struct buf *b)
 {
   int i;
 
+  acquire(&log.lock);
   if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
-  acquire(&log.lock);
   for (i = 0; i < log.lh.n; i++) {
     if (log.lh.block[i] == b->blockno)   // log absorbtion
       break;
   }
   log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
+  if (i == log.lh.n) {
+    bpin(b);  // keep it cached until installed
     log.lh.n++;
-  b->flags |= B_DIRTY; // prevent eviction
+  }
   release(&log.lock);
 }
-
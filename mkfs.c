@@ -15,14 +15,14 @@
 #define static_assert(a, b) do { switch (0) case 0: case (a): ; } while (0)
 #endif
 
-#define NINODES 200
+#define NINODES 500
 
 // Disk layout:
 // [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+int nlog = LOGSIZE+1;  // header and LOGSIZE data blocks
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -40,6 +40,7 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void dirinsert(uint dino, char *name, uint inum);
 
 // convert to intel byte order
 ushort
@@ -68,11 +69,8 @@ int
 main(int argc, char *argv[])
 {
   int i, cc, fd;
-  uint rootino, inum, off;
-  struct dirent de;
+  uint rootino, inum;
   char buf[BSIZE];
-  struct dinode din;
-
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
@@ -117,15 +115,8 @@ main(int argc, char *argv[])
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
-
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  dirinsert(rootino, ".", rootino);
+  dirinsert(rootino, "..", rootino);
 
   for(i = 2; i < argc; i++){
     assert(index(argv[i], '/') == 0);
@@ -144,10 +135,7 @@ main(int argc, char *argv[])
 
     inum = ialloc(T_FILE);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    dirinsert(rootino, argv[i], inum);
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -155,13 +143,6 @@ main(int argc, char *argv[])
     close(fd);
   }
 
-  // fix size of root inode dir
-  rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
-
   balloc(freeblock);
 
   exit(0);
@@ -252,6 +233,52 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// All the extents a file can have, in order.
+#define MAXEXT (NEXTENT + NEXTIDX*NIEXTENT)
+
+// Read din's extents into ext[], and the blocks of its extent
+// index and extent blocks into idx[].
+void
+rextents(struct dinode *din, struct extent *ext, struct extidx *idx)
+{
+  uint j;
+
+  bzero(ext, MAXEXT*sizeof(struct extent));
+  bzero(idx, NEXTIDX*sizeof(struct extidx));
+  memmove(ext, din->ext, sizeof(din->ext));
+  if(xint(din->extindex) == 0)
+    return;
+  rsect(xint(din->extindex), (char*)idx);
+  for(j = 0; j < NEXTIDX && xint(idx[j].block) != 0; j++)
+    rsect(xint(idx[j].block), (char*)&ext[NEXTENT + j*NIEXTENT]);
+}
+
+// Write ext[] back to din and its extent blocks, allocating
+// the extent blocks and their index as needed.
+void
+wextents(struct dinode *din, struct extent *ext, struct extidx *idx)
+{
+  uint i, j, lbn;
+
+  memmove(din->ext, ext, sizeof(din->ext));
+  lbn = 0;
+  for(i = 0; i < NEXTENT; i++)
+    lbn += xint(ext[i].len);
+  for(j = 0; j < NEXTIDX && xint(ext[NEXTENT + j*NIEXTENT].len) > 0; j++){
+    if(xint(din->extindex) == 0)
+      din->extindex = xint(freeblock++);
+    if(xint(idx[j].block) == 0){
+      idx[j].block = xint(freeblock++);
+      idx[j].lbn = xint(lbn);
+    }
+    wsect(xint(idx[j].block), (char*)&ext[NEXTENT + j*NIEXTENT]);
+    for(i = 0; i < NIEXTENT; i++)
+      lbn += xint(ext[NEXTENT + j*NIEXTENT + i].len);
+  }
+  if(xint(din->extindex) != 0)
+    wsect(xint(din->extindex), (char*)idx);
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -259,30 +286,36 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
-  uint x;
+  static struct extent ext[MAXEXT];
+  static struct extidx idx[NEXTIDX];
+  uint i, nb, x;
 
   rinode(inum, &din);
   off = xint(din.size);
+  rextents(&din, ext, idx);
   // printf("append inum %d at off %d sz %d\n", inum, off, n);
   while(n > 0){
     fbn = off / BSIZE;
-    assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-      }
-      x = xint(din.addrs[fbn]);
-    } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
+    x = 0;
+    nb = 0;
+    for(i = 0; i < MAXEXT && xint(ext[i].len) > 0; i++){
+      if(fbn < nb + xint(ext[i].len)){
+        x = xint(ext[i].start) + fbn - nb;
+        break;
       }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+      nb += xint(ext[i].len);
+    }
+    if(x == 0){
+      // Append a block, extending the last extent if it can.
+      assert(fbn == nb);
+      if(i > 0 && xint(ext[i-1].start) + xint(ext[i-1].len) == freeblock){
+        ext[i-1].len = xint(xint(ext[i-1].len) + 1);
+      } else {
+        assert(i < MAXEXT);
+        ext[i].start = xint(freeblock);
+        ext[i].len = xint(1);
       }
-      x = xint(indirect[fbn-NDIRECT]);
+      x = freeblock++;
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
@@ -292,6 +325,127 @@ iappend(uint inum, void *xp, int n)
     off += n1;
     p += n1;
   }
+  wextents(&din, ext, idx);
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Directories are hash tables of blocks, as in fs.c;
+// dirhash() and dirbucket() must match the kernel's.
+
+uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;  // FNV-1a
+  for(i = 0; i < DIRSIZ && name[i]; i++){
+    h ^= (uchar)name[i];
+    h *= 16777619;
+  }
+  return h;
+}
+
+uint
+dirbucket(char *name, uint n)
+{
+  uint h, m;
+
+  h = dirhash(name);
+  for(m = 1; m < n; m <<= 1)
+    ;
+  if((h & (m-1)) < n)
+    return h & (m-1);
+  return h & (m/2 - 1);
+}
+
+// Return the disk block holding block fbn of inode inum.
+uint
+fileblock(uint inum, uint fbn)
+{
+  struct dinode din;
+  static struct extent ext[MAXEXT];
+  static struct extidx idx[NEXTIDX];
+  uint i, nb;
+
+  rinode(inum, &din);
+  rextents(&din, ext, idx);
+  nb = 0;
+  for(i = 0; i < MAXEXT && xint(ext[i].len) > 0; i++){
+    if(fbn < nb + xint(ext[i].len))
+      return xint(ext[i].start) + fbn - nb;
+    nb += xint(ext[i].len);
+  }
+  assert(0);
+  return 0;
+}
+
+// Put (name, inum) in a free entry of block b of directory dino.
+// Returns 0, or -1 if the block is full, marking it overflowed
+// if mark is set.
+int
+dirput(uint dino, uint b, char *name, uint inum, int mark)
+{
+  struct dirent de[DPB];
+  uint bn, i;
+
+  bn = fileblock(dino, b);
+  rsect(bn, (char*)de);
+  for(i = 1; i < DPB; i++){
+    if(de[i].inum == 0){
+      bzero(&de[i], sizeof(de[i]));
+      strncpy(de[i].name, name, DIRSIZ);
+      de[i].inum = xshort(inum);
+      wsect(bn, (char*)de);
+      return 0;
+    }
+  }
+  if(mark){
+    de[0].name[0] |= D_OVERFLOW;
+    wsect(bn, (char*)de);
+  }
+  return -1;
+}
+
+void
+dirinsert(uint dino, char *name, uint inum)
+{
+  struct dinode din;
+  struct dirent od[DPB], nd[DPB];
+  char zero[BSIZE];
+  uint n, m, s, i, j, b;
+
+  rinode(dino, &din);
+  n = xint(din.size) / BSIZE;
+  if(n > 0 && dirput(dino, dirbucket(name, n), name, inum, 0) == 0)
+    return;
+
+  // Add a block, splitting the next block's names with it.
+  bzero(zero, sizeof(zero));
+  iappend(dino, zero, BSIZE);
+  if(n > 0){
+    for(m = 1; m < n+1; m <<= 1)
+      ;
+    s = n - m/2;
+    rsect(fileblock(dino, s), (char*)od);
+    bzero(nd, sizeof(nd));
+    nd[0] = od[0];
+    j = 1;
+    for(i = 1; i < DPB; i++){
+      if(od[i].inum != 0 && dirbucket(od[i].name, n+1) == n){
+        nd[j++] = od[i];
+        bzero(&od[i], sizeof(od[i]));
+      }
+    }
+    wsect(fileblock(dino, s), (char*)od);
+    wsect(fileblock(dino, n), (char*)nd);
+  }
+  n++;
+  if(dirput(dino, dirbucket(name, n), name, inum, 1) == 0)
+    return;
+  for(b = 0; b < n; b++)
+    if(dirput(dino, b, name, inum, 0) == 0)
+      return;
+  assert(0);
+}
@@ -0,0 +1,304 @@
+// Memory-mapped files.
+//
+// mmap() records a region of the address space (a vma) that is
+// backed by an open file, but maps no pages.  The first access to
+// each page faults (see trap.c), and vmafault() fills a fresh page
+// from the file with readi(), straight out of the buffer cache.
+//
+// MAP_PRIVATE pages are never written back.  MAP_SHARED pages that
+// the process has dirtied (PTE_D) are written back to the file,
+// through the log, when they are unmapped by munmap(), exec() or
+// exit().  There is no page cache, so processes that map the same
+// file see each other's stores only after such a writeback.
+//
+// Regions are placed top-down from KERNBASE; growproc() refuses
+// to grow the heap into them.  The kernel does not take page
+// faults on user memory, so argptr() faults in any mapped pages
+// a system call is about to touch (see vmaprefault()).
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "stat.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "fs.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
+#include "fcntl.h"
+
+// Return the vma of p containing va, or 0.
+static struct vma*
+findvma(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->f && va >= v->addr && va < v->addr + v->len)
+      return v;
+  return 0;
+}
+
+// Does any vma of p overlap [start, end)?
+int
+vmaoverlap(struct proc *p, uint start, uint end)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->f && start < v->addr + v->len && v->addr < end)
+      return 1;
+  return 0;
+}
+
+// Map len bytes of f, starting at file offset off,
+// into the current process.  Returns the address, or -1.
+int
+mmap(struct file *f, uint len, int prot, int flags, uint off)
+{
+  struct proc *curproc = myproc();
+  struct vma *v, *free;
+  uint start, end;
+
+  if(f->type != FD_INODE || len == 0 || off % PGSIZE != 0)
+    return -1;
+  if(flags != MAP_SHARED && flags != MAP_PRIVATE)
+    return -1;
+  if((prot & PROT_READ) && !f->readable)
+    return -1;
+  if((prot & PROT_WRITE) && flags == MAP_SHARED && !f->writable)
+    return -1;
+  ilock(f->ip);
+  if(f->ip->type != T_FILE){
+    iunlock(f->ip);
+    return -1;
+  }
+  iunlock(f->ip);
+
+  free = 0;
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+    if(v->f == 0){
+      free = v;
+      break;
+    }
+  if(free == 0)
+    return -1;
+
+  // Find the highest gap below KERNBASE that fits.
+  len = PGROUNDUP(len);
+  end = KERNBASE;
+  for(;;){
+    if(len > end || end - len < PGROUNDUP(curproc->sz))
+      return -1;
+    start = end - len;
+    for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+      if(v->f && start < v->addr + v->len && v->addr < end)
+        break;
+    if(v == &curproc->vma[NVMA])
+      break;
+    end = v->addr;
+  }
+
+  free->addr = start;
+  free->len = len;
+  free->prot = prot;
+  free->flags = flags;
+  free->off = off;
+  free->f = filedup(f);
+  return start;
+}
+
+// Write the page at kernel address mem, which maps file
+// offset off of v, back to the file.  Only the part that lies
+// within the file is written; mappings never extend a file.
+static void
+writeback(struct vma *v, char *mem, uint off)
+{
+  struct inode *ip = v->f->ip;
+  uint n;
+
+  ilock(ip);
+  n = off < ip->size ? ip->size - off : 0;
+  iunlock(ip);
+  if(n > PGSIZE)
+    n = PGSIZE;
+  if(n > 0)
+    filepwrite(v->f, mem, off, n);
+}
+
+// Unmap [start, end) of v from p's page table, writing back
+// dirty MAP_SHARED pages and freeing the memory.
+static void
+unmappages(struct proc *p, struct vma *v, uint start, uint end)
+{
+  pte_t *pte;
+  uint a;
+  char *mem;
+
+  for(a = start; a < end; a += PGSIZE){
+    if((pte = walkpgdir(p->pgdir, (char*)a, 0)) == 0 || (*pte & PTE_P) == 0)
+      continue;
+    mem = P2V(PTE_ADDR(*pte));
+    if(v->flags == MAP_SHARED && (*pte & PTE_D))
+      writeback(v, mem, v->off + (a - v->addr));
+    kfree(mem);
+    *pte = 0;
+  }
+  if(p == myproc())
+    lcr3(V2P(p->pgdir));  // flush stale TLB entries
+}
+
+// Remove [addr, addr+len) from the current process's mappings.
+// The range must lie within a single mapped region.
+int
+munmap(uint addr, uint len)
+{
+  struct proc *curproc = myproc();
+  struct vma *v, *w;
+  uint end;
+
+  if(addr % PGSIZE != 0 || len == 0)
+    return -1;
+  end = addr + PGROUNDUP(len);
+  if((v = findvma(curproc, addr)) == 0 || end > v->addr + v->len || end < addr)
+    return -1;
+
+  if(addr > v->addr && end < v->addr + v->len){
+    // A hole in the middle: split off the tail first.
+    for(w = curproc->vma; w < &curproc->vma[NVMA]; w++)
+      if(w->f == 0)
+        break;
+    if(w == &curproc->vma[NVMA])
+      return -1;
+    *w = *v;
+    w->addr = end;
+    w->len = v->addr + v->len - end;
+    w->off = v->off + (end - v->addr);
+    filedup(w->f);
+    v->len = end - v->addr;
+  }
+
+  unmappages(curproc, v, addr, end);
+  if(addr == v->addr && end == v->addr + v->len){
+    fileclose(v->f);
+    v->f = 0;
+  } else if(addr == v->addr){
+    v->off += end - addr;
+    v->len -= end - addr;
+    v->addr = end;
+  } else
+    v->len = addr - v->addr;
+  return 0;
+}
+
+// Unmap every region of p, as on exit() or exec().
+void
+vmaexit(struct proc *p)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->f == 0)
+      continue;
+    unmappages(p, v, v->addr, v->addr + v->len);
+    fileclose(v->f);
+    v->f = 0;
+  }
+}
+
+// Give the fork child np copies of p's regions, including
+// copies of the pages already faulted in.
+int
+vmafork(struct proc *np, struct proc *p)
+{
+  struct vma *v;
+  pte_t *pte;
+  uint a;
+  char *mem;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->f == 0)
+      continue;
+    np->vma[v - p->vma] = *v;
+    filedup(v->f);
+    for(a = v->addr; a < v->addr + v->len; a += PGSIZE){
+      if((pte = walkpgdir(p->pgdir, (char*)a, 0)) == 0 || (*pte & PTE_P) == 0)
+        continue;
+      if((mem = kalloc()) == 0)
+        return -1;
+      memmove(mem, P2V(PTE_ADDR(*pte)), PGSIZE);
+      if(mappages(np->pgdir, (char*)a, PGSIZE, V2P(mem), PTE_FLAGS(*pte)) < 0){
+        kfree(mem);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+// Handle a page fault at va in the current process.
+// Returns 0 if va is in a mapped region and the page
+// has been filled in, -1 if the fault is a real error.
+int
+vmafault(uint va, int write)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  pte_t *pte;
+  char *mem;
+  uint a;
+  int perm;
+
+  if((v = findvma(curproc, va)) == 0)
+    return -1;
+  if(write && !(v->prot & PROT_WRITE))
+    return -1;
+  a = PGROUNDDOWN(va);
+  if((pte = walkpgdir(curproc->pgdir, (char*)a, 0)) != 0 && (*pte & PTE_P))
+    return -1;  // present, so a protection fault
+
+  if((mem = kalloc()) == 0)
+    return -1;
+  memset(mem, 0, PGSIZE);
+  ilock(v->f->ip);
+  readi(v->f->ip, mem, v->off + (a - v->addr), PGSIZE);
+  iunlock(v->f->ip);
+  perm = PTE_U;
+  if(v->prot & PROT_WRITE)
+    perm |= PTE_W;
+  if(mappages(curproc->pgdir, (char*)a, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Check that [addr, addr+n) lies within one mapped region of
+// the current process, writable if write is set, and fault in
+// every page of it.  Returns 0 on success, -1 otherwise.
+int
+vmaprefault(uint addr, uint n, int write)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  pte_t *pte;
+  uint a;
+
+  if((v = findvma(curproc, addr)) == 0)
+    return -1;
+  if(addr + n < addr || addr + n > v->addr + v->len)
+    return -1;
+  if(write && !(v->prot & PROT_WRITE))
+    return -1;
+  for(a = PGROUNDDOWN(addr); a < addr + n; a += PGSIZE){
+    pte = walkpgdir(curproc->pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_P))
+      continue;
+    if(vmafault(a, write) < 0)
+      return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,111 @@
+// Minimal PCI support: find a device on bus 0 and read or
+// write its configuration space, using configuration
+// mechanism #1 (I/O ports 0xCF8 and 0xCFC).
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+#include "pci.h"
+
+#define CONFADDR 0xcf8
+#define CONFDATA 0xcfc
+
+static uint
+confread(uint bus, uint dev, uint func, uint off)
+{
+  outl(CONFADDR, 0x80000000 | bus<<16 | dev<<11 | func<<8 | (off & 0xfc));
+  return inl(CONFDATA);
+}
+
+static void
+confwrite(uint bus, uint dev, uint func, uint off, uint v)
+{
+  outl(CONFADDR, 0x80000000 | bus<<16 | dev<<11 | func<<8 | (off & 0xfc));
+  outl(CONFDATA, v);
+}
+
+// Read the 32-bit configuration register at off.
+uint
+pciread(struct pcidev *d, uint off)
+{
+  return confread(d->bus, d->dev, d->func, off);
+}
+
+// Write the 32-bit configuration register at off.
+void
+pciwrite(struct pcidev *d, uint off, uint v)
+{
+  confwrite(d->bus, d->dev, d->func, off, v);
+}
+
+// Let d respond to I/O and memory accesses and master the bus.
+void
+pcienable(struct pcidev *d)
+{
+  uint cmd;
+
+  cmd = pciread(d, PCI_COMMAND);
+  cmd |= PCI_CMD_IO | PCI_CMD_MEM | PCI_CMD_MASTER;
+  pciwrite(d, PCI_COMMAND, cmd & 0xffff);  // don't clear status bits
+}
+
+// Scan bus 0 for the first function for which match(d, a, b)
+// returns true, and fill in *d.  Returns 0, or -1 if none.
+static int
+pcifind(struct pcidev *d, int (*match)(struct pcidev*, int, int), int a, int b)
+{
+  uint dev, func, nfunc, id, class, i;
+
+  d->bus = 0;
+  for(dev = 0; dev < 32; dev++){
+    nfunc = 1;
+    for(func = 0; func < nfunc; func++){
+      id = confread(0, dev, func, 0x00);
+      if((id & 0xffff) == 0xffff)
+        continue;
+      if(func == 0 && (confread(0, dev, 0, 0x0c) & 0x800000))
+        nfunc = 8;  // multi-function device
+      class = confread(0, dev, func, 0x08);
+      d->dev = dev;
+      d->func = func;
+      d->vendor = id & 0xffff;
+      d->device = id >> 16;
+      d->class = class >> 24;
+      d->subclass = class >> 16;
+      d->progif = class >> 8;
+      if(!match(d, a, b))
+        continue;
+      for(i = 0; i < 6; i++)
+        d->bar[i] = pciread(d, PCI_BAR0 + 4*i);
+      d->irq = pciread(d, PCI_INTLINE);
+      return 0;
+    }
+  }
+  return -1;
+}
+
+static int
+matchclass(struct pcidev *d, int class, int subclass)
+{
+  return d->class == class && d->subclass == subclass;
+}
+
+static int
+matchid(struct pcidev *d, int vendor, int device)
+{
+  return d->vendor == vendor && d->device == device;
+}
+
+// Find the first function of the given class and subclass.
+int
+pcifindclass(int class, int subclass, struct pcidev *d)
+{
+  return pcifind(d, matchclass, class, subclass);
+}
+
+// Find the first function with the given vendor and device IDs.
+int
+pcifindid(int vendor, int device, struct pcidev *d)
+{
+  return pcifind(d, matchid, vendor, device);
+}
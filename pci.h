@@ -0,0 +1,19 @@
+// PCI configuration space.
+
+#define PCI_COMMAND     0x04  // command register (16 bits)
+#define PCI_CMD_IO      0x1   //   respond to I/O space accesses
+#define PCI_CMD_MEM     0x2   //   respond to memory space accesses
+#define PCI_CMD_MASTER  0x4   //   may act as bus master (DMA)
+#define PCI_BAR0        0x10  // base address registers, 6 of them
+#define PCI_INTLINE     0x3c  // interrupt line
+
+#define PCI_BAR_IO      0x1   // BAR is an I/O port range
+
+// A function found on the bus by pcifind*().
+struct pcidev {
+  uint bus, dev, func;
+  ushort vendor, device;
+  uchar class, subclass, progif;
+  uchar irq;    // interrupt line, as set up by the BIOS
+  uint bar[6];  // base address registers, as is
+};
@@ -7,34 +7,80 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "slab.h"
 
-#define PIPESIZE 512
+#define PIPEPAGES 4
+#define PIPESIZE (PIPEPAGES*PGSIZE)  // a power of two, for nread/nwrite wrap
+#define min(a, b) ((a) < (b) ? (a) : (b))
 
+// The data is a ring of PIPESIZE bytes spread over PIPEPAGES
+// separately allocated pages.  Readers and writers copy as
+// much as they can at a time, up to the end of a page, and
+// only wake each other when the pipe stops being full or empty,
+// since nobody sleeps otherwise.
+//
+// pipefill() and pipedrain() let splice() read a file straight
+// into the pipe's pages, or write a file straight from them.
+// They copy without holding p->lock, so while one does, it sets
+// wbusy, or rbusy, and other writers, or readers, wait for it.
+// splice() only uses them with files whose I/O cannot block
+// for long, and nobody waits for a pipe with a turn held.
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
+  uint wbusy;     // a writer is copying without p->lock
+  uint rbusy;     // a reader is copying without p->lock
+  char *data[PIPEPAGES];
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
 };
 
+// struct pipe is much smaller than a page,
+// so pipes come from their own slab cache;
+// their data pages come from kalloc().
+static struct slabcache pipecache;
+
+void
+pipeinit(void)
+{
+  slabinit(&pipecache, "pipe", sizeof(struct pipe));
+}
+
+static void
+pipefree(struct pipe *p)
+{
+  int i;
+
+  for(i = 0; i < PIPEPAGES; i++)
+    if(p->data[i])
+      kfree(p->data[i]);
+  slabfree(&pipecache, p);
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
   struct pipe *p;
+  int i;
 
   p = 0;
   *f0 = *f1 = 0;
   if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
     goto bad;
-  if((p = (struct pipe*)kalloc()) == 0)
+  if((p = (struct pipe*)slaballoc(&pipecache)) == 0)
     goto bad;
+  memset(p->data, 0, sizeof(p->data));
+  for(i = 0; i < PIPEPAGES; i++)
+    if((p->data[i] = kalloc()) == 0)
+      goto bad;
   p->readopen = 1;
   p->writeopen = 1;
   p->nwrite = 0;
   p->nread = 0;
   initlock(&p->lock, "pipe");
+  p->wbusy = 0;
+  p->rbusy = 0;
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
   (*f0)->writable = 0;
@@ -48,7 +94,7 @@ pipealloc(struct file **f0, struct file **f1)
 //PAGEBREAK: 20
  bad:
   if(p)
-    kfree((char*)p);
+    pipefree(p);
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -69,7 +115,7 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
-    kfree((char*)p);
+    pipefree(p);
   } else
     release(&p->lock);
 }
@@ -78,21 +124,26 @@ pipeclose(struct pipe *p, int writable)
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, m;
+  uint off;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+  for(i = 0; i < n; i += m){
+    while(p->nwrite == p->nread + PIPESIZE || p->wbusy){  //DOC: pipewrite-full
       if(p->readopen == 0 || myproc()->killed){
         release(&p->lock);
         return -1;
       }
-      wakeup(&p->nread);
-      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+      sleep(p->wbusy ? &p->wbusy : &p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    if(p->nread == p->nwrite)
+      wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+    off = p->nwrite % PIPESIZE;
+    m = min(n - i, PIPESIZE - (p->nwrite - p->nread));
+    m = min(m, PGSIZE - off%PGSIZE);
+    memmove(p->data[off/PGSIZE] + off%PGSIZE, addr + i, m);
+    p->nwrite += m;
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
   return n;
 }
@@ -100,22 +151,109 @@ pipewrite(struct pipe *p, char *addr, int n)
 int
 piperead(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, m;
+  uint off;
 
   acquire(&p->lock);
-  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+  while((p->nread == p->nwrite && p->writeopen) || p->rbusy){  //DOC: pipe-empty
     if(myproc()->killed){
       release(&p->lock);
       return -1;
     }
-    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+    sleep(p->rbusy ? &p->rbusy : &p->nread, &p->lock); //DOC: piperead-sleep
+  }
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+    if(p->nwrite == p->nread + PIPESIZE)
+      wakeup(&p->nwrite);  //DOC: piperead-wakeup
+    off = p->nread % PIPESIZE;
+    m = min(n - i, p->nwrite - p->nread);
+    m = min(m, PGSIZE - off%PGSIZE);
+    memmove(addr + i, p->data[off/PGSIZE] + off%PGSIZE, m);
+    p->nread += m;
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
+  release(&p->lock);
+  return i;
+}
+
+//PAGEBREAK: 40
+// Fill p with up to n bytes read from f, reading them straight
+// into p's pages.  Stops early at the end of f.  f must be a
+// file whose reads do not wait for other processes.
+int
+pipefill(struct pipe *p, struct file *f, int n)
+{
+  int i, m;
+  uint off;
+
+  acquire(&p->lock);
+  m = 0;
+  for(i = 0; i < n; i += m){
+    while(p->nwrite == p->nread + PIPESIZE || p->wbusy){
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        return -1;
+      }
+      sleep(p->wbusy ? &p->wbusy : &p->nwrite, &p->lock);
+    }
+    off = p->nwrite % PIPESIZE;
+    m = min(n - i, PIPESIZE - (p->nwrite - p->nread));
+    m = min(m, PGSIZE - off%PGSIZE);
+
+    // Readers stay out of [nwrite, nread+PIPESIZE),
+    // and wbusy keeps other writers out.
+    p->wbusy = 1;
+    release(&p->lock);
+    m = fileread(f, p->data[off/PGSIZE] + off%PGSIZE, m);
+    acquire(&p->lock);
+    p->wbusy = 0;
+    wakeup(&p->wbusy);
+    if(m <= 0)
+      break;
     if(p->nread == p->nwrite)
+      wakeup(&p->nread);
+    p->nwrite += m;
+  }
+  release(&p->lock);
+  return i > 0 || m == 0 ? i : -1;
+}
+
+// Drain up to n bytes from p into f, writing them straight
+// from p's pages.  Waits for data only if p is empty.  f must
+// be a file whose writes do not wait for other processes.
+int
+pipedrain(struct pipe *p, struct file *f, int n)
+{
+  int i, m;
+  uint off;
+
+  acquire(&p->lock);
+  while((p->nread == p->nwrite && p->writeopen) || p->rbusy){
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(p->rbusy ? &p->rbusy : &p->nread, &p->lock);
+  }
+  m = 0;
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){
+    off = p->nread % PIPESIZE;
+    m = min(n - i, p->nwrite - p->nread);
+    m = min(m, PGSIZE - off%PGSIZE);
+
+    // Writers stay out of [nread, nwrite),
+    // and rbusy keeps other readers out.
+    p->rbusy = 1;
+    release(&p->lock);
+    m = filewrite(f, p->data[off/PGSIZE] + off%PGSIZE, m);
+    acquire(&p->lock);
+    p->rbusy = 0;
+    wakeup(&p->rbusy);
+    if(m <= 0)
       break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+    if(p->nwrite == p->nread + PIPESIZE)
+      wakeup(&p->nwrite);
+    p->nread += m;
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
-  return i;
+  return i > 0 || m == 0 ? i : -1;
 }
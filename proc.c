@@ -6,10 +6,23 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
-
+#include "slab.h"
+
+// Process structures come from a slab cache, up to NPROC of them.
+// Live processes (any state but UNUSED) are on the procs list;
+// exited ones go on the free list so allocproc() is O(1).
+// RUNNABLE processes are also on the run queue, in the order
+// they became runnable, which is what scheduler() walks.
+// All of these are protected by ptable.lock.
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  int nproc;               // proc structures allocated
+  struct proc *procs;      // live processes
+  struct proc *free;       // UNUSED processes
+  struct proc *runq;       // head of run queue
+  struct proc *runqtail;
+  int nrunnable;           // length of run queue
+  struct slabcache cache;
 } ptable;
 
 static struct proc *initproc;
@@ -22,11 +35,76 @@ extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static void kthreadret(void);
 
 void
 pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+  slabinit(&ptable.cache, "proc", sizeof(struct proc));
+}
+
+// Append p to the run queue.
+static void
+runqadd(struct proc *p)
+{
+  p->rqnext = 0;
+  p->rqprev = ptable.runqtail;
+  if(ptable.runqtail)
+    ptable.runqtail->rqnext = p;
+  else
+    ptable.runq = p;
+  ptable.runqtail = p;
+  ptable.nrunnable++;
+}
+
+// Remove p from the run queue.
+static void
+runqdel(struct proc *p)
+{
+  if(p->rqprev)
+    p->rqprev->rqnext = p->rqnext;
+  else
+    ptable.runq = p->rqnext;
+  if(p->rqnext)
+    p->rqnext->rqprev = p->rqprev;
+  else
+    ptable.runqtail = p->rqprev;
+  p->rqnext = p->rqprev = 0;
+  ptable.nrunnable--;
+}
+
+// Change p->state, keeping the run queue in step.
+// Caller must hold ptable.lock.
+static void
+setstate(struct proc *p, enum procstate state)
+{
+  if(p->state == RUNNABLE && state != RUNNABLE)
+    runqdel(p);
+  else if(p->state != RUNNABLE && state == RUNNABLE)
+    runqadd(p);
+  p->state = state;
+}
+
+// Take p off the list of live processes and put it
+// on the free list.  Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p)
+{
+  setstate(p, UNUSED);
+  if(p->prev)
+    p->prev->next = p->next;
+  else
+    ptable.procs = p->next;
+  if(p->next)
+    p->next->prev = p->prev;
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->prev = 0;
+  p->next = ptable.free;
+  ptable.free = p;
 }
 
 // Must be called with interrupts disabled
@@ -69,7 +147,8 @@ myproc(void) {
 }
 
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
+// Take an UNUSED proc from the free list, or allocate
+// a new one if there are fewer than NPROC.
 // If found, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
@@ -81,14 +160,22 @@ allocproc(void)
 
   acquire(&ptable.lock);
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-
-  release(&ptable.lock);
-  return 0;
+  if((p = ptable.free) != 0)
+    ptable.free = p->next;
+  else if(ptable.nproc < NPROC && (p = slaballoc(&ptable.cache)) != 0){
+    memset(p, 0, sizeof(*p));
+    ptable.nproc++;
+  }
+  if(p == 0){
+    release(&ptable.lock);
+    return 0;
+  }
 
-found:
+  p->prev = 0;
+  p->next = ptable.procs;
+  if(ptable.procs)
+    ptable.procs->prev = p;
+  ptable.procs = p;
   p->state = EMBRYO;
   p->pid = nextpid++;
   p->priority = 1;
@@ -101,7 +188,9 @@ found:
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -156,8 +245,28 @@ userinit(void)
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
 
-  p->state = RUNNABLE;
+  setstate(p, RUNNABLE);
+
+  release(&ptable.lock);
+}
+
+// Start a kernel thread, a process with no user half that runs
+// fn in the kernel.  fn must never return.
+void
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kthread");
+  // kthreadret() "returns" to fn, not to trapret (see allocproc).
+  *(uint*)((char*)p->context + sizeof *p->context) = (uint)fn;
+  p->context->eip = (uint)kthreadret;
+  p->parent = initproc;
+  safestrcpy(p->name, name, sizeof(p->name));
 
+  acquire(&ptable.lock);
+  setstate(p, RUNNABLE);
   release(&ptable.lock);
 }
 
@@ -171,6 +280,8 @@ growproc(int n)
 
   sz = curproc->sz;
   if(n > 0){
+    if(vmaoverlap(curproc, PGROUNDUP(sz), PGROUNDUP(sz + n)))
+      return -1;
     if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
   } else if(n < 0){
@@ -201,10 +312,26 @@ fork(void)
   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
     kfree(np->kstack);
     np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
     return -1;
   }
   np->sz = curproc->sz;
+  if(vmafork(np, curproc) < 0){
+    for(i = 0; i < NVMA; i++)
+      if(np->vma[i].f){
+        fileclose(np->vma[i].f);
+        np->vma[i].f = 0;
+      }
+    freevm(np->pgdir);
+    kfree(np->kstack);
+    np->kstack = 0;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
   np->parent = curproc;
   *np->tf = *curproc->tf;
 
@@ -212,8 +339,9 @@ fork(void)
   np->tf->eax = 0;
 
   for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
+    if(curproc->ofmap[i/32] & (1U << (i % 32)))
       np->ofile[i] = filedup(curproc->ofile[i]);
+  memmove(np->ofmap, curproc->ofmap, sizeof(np->ofmap));
   np->cwd = idup(curproc->cwd);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
@@ -222,7 +350,7 @@ fork(void)
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
+  setstate(np, RUNNABLE);
 
   release(&ptable.lock);
 
@@ -242,13 +370,17 @@ exit(void)
   if(curproc == initproc)
     panic("init exiting");
 
+  // Write back and drop memory-mapped files.
+  vmaexit(curproc);
+
   // Close all open files.
   for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd]){
+    if(curproc->ofmap[fd/32] & (1U << (fd % 32))){
       fileclose(curproc->ofile[fd]);
       curproc->ofile[fd] = 0;
     }
   }
+  memset(curproc->ofmap, 0, sizeof(curproc->ofmap));
 
   begin_op();
   iput(curproc->cwd);
@@ -261,7 +393,7 @@ exit(void)
   wakeup1(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.procs; p; p = p->next){
     if(p->parent == curproc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
@@ -270,7 +402,7 @@ exit(void)
   }
 
   // Jump into the scheduler, never to return.
-  curproc->state = ZOMBIE;
+  setstate(curproc, ZOMBIE);
   sched();
   panic("zombie exit");
 }
@@ -288,7 +420,7 @@ wait(void)
   for(;;){
     // Scan through table looking for exited children.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.procs; p; p = p->next){
       if(p->parent != curproc)
         continue;
       havekids = 1;
@@ -298,11 +430,7 @@ wait(void)
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -332,29 +460,30 @@ scheduler(void)
 {
   struct proc *p, *p1;
   struct cpu *c = mycpu();
+  pde_t *loaded;
   c->proc = 0;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
+    // The kernel half of every page table is the same, so while
+    // ptable.lock is held the scheduler stays on the page table of
+    // whichever process ran last instead of reloading kpgdir.
+    loaded = 0;
     struct proc *highP;
     int policy_to_use = -1;
+    int n;
     // uint ticks_consumed;
-    // Loop over process table looking for process to run.
+    // Make one pass over the run queue looking for process to run.
     acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
+    for(n = ptable.nrunnable; n > 0 && (p = ptable.runq) != 0; n--){
       // Switch to chosen process.  It is the process's job
       // to release ptable.lock and then reacquire it
       // before jumping back to us.
       highP = p;
       policy_to_use = p->sched_policy;
       if (policy_to_use == 0) {
-        for(p1 = ptable.proc; p1 < &ptable.proc[NPROC]; p1++){
-          if(p1->state != RUNNABLE)
-            continue;
+        for(p1 = ptable.runq; p1; p1 = p1->rqnext){
           if(p1->deadline <= highP->deadline){
             if(p1->deadline == highP->deadline) {
               if (p1->pid < highP ->pid) {
@@ -369,9 +498,7 @@ scheduler(void)
         highP->elapsed_time += 1;
         // cprintf("Process Execution Time: %d\n", highP->execution_time);
       } else if (policy_to_use == 1) {
-        for(p1 = ptable.proc; p1 < &ptable.proc[NPROC]; p1++){
-          if(p1->state != RUNNABLE)
-            continue;
+        for(p1 = ptable.runq; p1; p1 = p1->rqnext){
           if(p1->priority <= highP->priority){
             if(p1->priority == highP->priority) {
               if (p1->pid < highP ->pid) {
@@ -390,11 +517,11 @@ scheduler(void)
       p = highP;
       // ticks_consumed = ticks;
       c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
+      schedswitchuvm(p, loaded);
+      setstate(p, RUNNING);
 
       swtch(&(c->scheduler), p->context);
-      switchkvm();
+      loaded = p->pgdir;
 
       // Process is done running for now.
       // It should have changed its p->state before coming back.
@@ -406,6 +533,10 @@ scheduler(void)
       // cprintf("PID - %d, Exec Time - %d, State - %s", p->pid, p->execution_time, p->state);
       c->proc = 0;
     }
+    // Once ptable.lock is released, wait() or exec() may free the
+    // page table we are on, so go back to kpgdir before idling.
+    if(loaded)
+      switchkvm();
     release(&ptable.lock);
 
   }
@@ -442,7 +573,7 @@ void
 yield(void)
 {
   acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  setstate(myproc(), RUNNABLE);
   sched();
   release(&ptable.lock);
 }
@@ -460,14 +591,23 @@ forkret(void)
     // Some initialization functions must be run in the context
     // of a regular process (e.g., they call sleep), and thus cannot
     // be run from main().
+    // Recover the log before iinit() looks at the bitmap.
     first = 0;
-    iinit(ROOTDEV);
     initlog(ROOTDEV);
+    iinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
 }
 
+// A kernel thread's very first scheduling will swtch here.
+static void
+kthreadret(void)
+{
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
@@ -493,7 +633,7 @@ sleep(void *chan, struct spinlock *lk)
   }
   // Go to sleep.
   p->chan = chan;
-  p->state = SLEEPING;
+  setstate(p, SLEEPING);
 
   sched();
 
@@ -515,9 +655,9 @@ wakeup1(void *chan)
 {
   struct proc *p;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.procs; p; p = p->next)
     if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+      setstate(p, RUNNABLE);
 }
 
 // Wake up all processes sleeping on chan.
@@ -538,12 +678,12 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.procs; p; p = p->next){
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+        setstate(p, RUNNABLE);
       release(&ptable.lock);
       return 0;
     }
@@ -572,7 +712,7 @@ procdump(void)
   char *state;
   uint pc[10];
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.procs; p; p = p->next){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
@@ -597,7 +737,7 @@ printinfo(void)
   sti();
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.procs; p; p = p->next){
     if(p->state == SLEEPING)
       cprintf("Process State - SLEEPING, Process Name - %s, Process Id - %d, Policy - %d, Exec time - %d, Deadline - %d\n",p->name,p->pid,p->sched_policy, p->execution_time, p->deadline);
     else if(p->state == RUNNING)
@@ -610,6 +750,27 @@ printinfo(void)
   return 22;
 }
 
+// Rate-monotonic utilization bound n*(2^(1/n) - 1) for n tasks,
+// in thousandths, indexed by n.
+static int rmbounds[] = {
+  0,
+  1000, 828, 779, 756, 743, 734, 728, 724, 720, 717, 715, 713, 711,
+  710, 709, 708, 707, 706, 705, 705, 704, 704, 703, 703, 702, 702,
+  702, 701, 701, 701, 700, 700, 700, 700, 700, 699, 699, 699, 699,
+  699, 699, 698, 698, 698, 698, 698, 698, 698, 698, 697, 697, 697,
+  697, 697, 697, 697, 697, 697, 697, 697, 697, 697, 696,
+};
+
+// Schedulable utilization (in thousandths) of n RM tasks.
+// Outside the table, the last entry's bound is used.
+static int
+rmbound(int n)
+{
+  if(n >= 1 && n < NELEM(rmbounds))
+    return rmbounds[n];
+  return 696;
+}
+
 int 
 sched_policy(int pid, int policy)
 {
@@ -621,14 +782,14 @@ sched_policy(int pid, int policy)
   sti();
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.procs; p; p = p->next){
     if(p->pid == pid){
       if (policy == 0) {
         utf_edf += (p->execution_time * 100)/p->deadline;
         if (utf_edf >= 100) {
           utf_edf -= (p->execution_time*100)/p->deadline;
           p->killed = 1;
-          p->state = ZOMBIE;
+          setstate(p, ZOMBIE);
           check = 1;
 
         } else {
@@ -639,137 +800,9 @@ sched_policy(int pid, int policy)
       if (policy == 1) {
         int curr_utf_rm = p->execution_time * p->rate * 10;
         int tempChk = utf_rm + curr_utf_rm;
-        int chk_lproc = 0;
+        int chk_lproc;
         // cprintf("lproc - %d, pid - %d\n", lproc, p->pid);
-        if (lproc == 1) {
-          chk_lproc = 1000;
-        } else if (lproc == 2) {
-          chk_lproc = 828;
-        } else if (lproc == 3) {
-          chk_lproc = 779;
-        } else if (lproc == 4) {
-          chk_lproc = 756;
-        } else if (lproc == 5) {
-          chk_lproc = 743;
-        } else if (lproc == 6) {
-          chk_lproc = 734;
-        } else if (lproc == 7) {
-          chk_lproc = 728;
-        } else if (lproc == 8) {
-          chk_lproc = 724;
-        } else if (lproc == 9) {
-          chk_lproc = 720;
-        } else if (lproc == 10) {
-          chk_lproc = 717;
-        } else if (lproc == 11) {
-          chk_lproc = 715;
-        } else if (lproc == 12) {
-          chk_lproc = 713;
-        } else if (lproc == 13) {
-          chk_lproc = 711;
-        } else if (lproc == 14) {
-          chk_lproc = 710;
-        } else if (lproc == 15) {
-          chk_lproc = 709;
-        } else if (lproc == 16) {
-          chk_lproc = 708;
-        } else if (lproc == 17) {
-          chk_lproc = 707;
-        } else if (lproc == 18) {
-          chk_lproc = 706;
-        } else if (lproc == 19) {
-          chk_lproc = 705;
-        } else if (lproc == 20) {
-          chk_lproc = 705;
-        } else if (lproc == 21) {
-          chk_lproc = 704;
-        } else if (lproc == 22) {
-          chk_lproc = 704;
-        } else if (lproc == 23) {
-          chk_lproc = 703;
-        } else if (lproc == 24) {
-          chk_lproc = 703;
-        } else if (lproc == 25) {
-          chk_lproc = 702;
-        } else if (lproc == 26) {
-          chk_lproc = 702;
-        } else if (lproc == 27) {
-          chk_lproc = 702;
-        } else if (lproc == 28) {
-          chk_lproc = 701;
-        } else if (lproc == 29) {
-          chk_lproc = 701;
-        } else if (lproc == 30) {
-          chk_lproc = 701;
-        } else if (lproc == 31) {
-          chk_lproc = 700;
-        } else if (lproc == 32) {
-          chk_lproc = 700;
-        } else if (lproc == 33) {
-          chk_lproc = 700;
-        } else if (lproc == 34) {
-          chk_lproc = 700;
-        } else if (lproc == 35) {
-          chk_lproc = 700;
-        } else if (lproc == 36) {
-          chk_lproc = 699;
-        } else if (lproc == 37) {
-          chk_lproc = 699;
-        } else if (lproc == 38) {
-          chk_lproc = 699;
-        } else if (lproc == 39) {
-          chk_lproc = 699;
-        } else if (lproc == 40) {
-          chk_lproc = 699;
-        } else if (lproc == 41) {
-          chk_lproc = 699;
-        } else if (lproc == 42) {
-          chk_lproc = 698;
-        } else if (lproc == 43) {
-          chk_lproc = 698;
-        } else if (lproc == 44) {
-          chk_lproc = 698;
-        } else if (lproc == 45) {
-          chk_lproc = 698;
-        } else if (lproc == 46) {
-          chk_lproc = 698;
-        } else if (lproc == 47) {
-          chk_lproc = 698;
-        } else if (lproc == 48) {
-          chk_lproc = 698;
-        } else if (lproc == 49) {
-          chk_lproc = 698;
-        } else if (lproc == 50) {
-          chk_lproc = 697;
-        } else if (lproc == 51) {
-          chk_lproc = 697;
-        } else if (lproc == 52) {
-          chk_lproc = 697;
-        } else if (lproc == 53) {
-          chk_lproc = 697;
-        } else if (lproc == 54) {
-          chk_lproc = 697;
-        } else if (lproc == 55) {
-          chk_lproc = 697;
-        } else if (lproc == 56) {
-          chk_lproc = 697;
-        } else if (lproc == 57) {
-          chk_lproc = 697;
-        } else if (lproc == 58) {
-          chk_lproc = 697;
-        } else if (lproc == 59) {
-          chk_lproc = 697;
-        } else if (lproc == 60) {
-          chk_lproc = 697;
-        } else if (lproc == 61) {
-          chk_lproc = 697;
-        } else if (lproc == 62) {
-          chk_lproc = 697;
-        } else if (lproc == 63) {
-          chk_lproc = 696;
-        } else {
-          chk_lproc = 696;
-        }
+        chk_lproc = rmbound(lproc);
         if (tempChk <= chk_lproc) {
           utf_rm += curr_utf_rm;
           p->arrival_time = ticks;
@@ -778,7 +811,7 @@ sched_policy(int pid, int policy)
         } else {
           // cprintf("Pid - %d, tempchk - %d, check_lproc - %d", p->pid, tempChk, chk_lproc);
           p->killed = 1;
-          p->state = ZOMBIE;
+          setstate(p, ZOMBIE);
           check = 1;
         }
       }
@@ -800,7 +833,7 @@ exec_time(int pid, int time)
   int found = 0;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.procs; p; p = p->next){
     if(p->pid == pid){
       found = 1;
       p->execution_time = time;
@@ -822,7 +855,7 @@ deadline(int pid, int deadline)
   int found = 0;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.procs; p; p = p->next){
     if(p->pid == pid){
       found = 1;
       p->deadline = deadline;
@@ -844,7 +877,7 @@ rate(int pid, int rate)
   int found = 0;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.procs; p; p = p->next){
     if(p->pid == pid){
       found = 1;
       p->rate = rate;
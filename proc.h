@@ -32,10 +32,24 @@ struct context {
   uint eip;
 };
 
+// A region of the address space mapped from a file (see mmap.c).
+struct vma {
+  uint addr;                   // Start, page-aligned
+  uint len;                    // Length, a multiple of PGSIZE
+  int prot;                    // PROT_READ|PROT_WRITE
+  int flags;                   // MAP_SHARED or MAP_PRIVATE
+  struct file *f;              // Mapped file, or 0 if slot unused
+  uint off;                    // File offset of addr
+};
+
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
 struct proc {
+  struct proc *next;           // ptable list: live procs, or free list
+  struct proc *prev;
+  struct proc *rqnext;         // run queue, if RUNNABLE
+  struct proc *rqprev;
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
@@ -47,7 +61,9 @@ struct proc {
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
+  uint ofmap[NOFILE/32];       // Bit fd set if ofile[fd] is in use
   struct inode *cwd;           // Current directory
+  struct vma vma[NVMA];        // Memory-mapped files
   char name[16];               // Process name (debugging)
   int priority;                // Priority of the process
   int deadline;                // Process deadline
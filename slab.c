@@ -0,0 +1,212 @@
+// Slab allocator for kernel objects smaller than a page.
+//
+// A slab cache hands out fixed-size objects carved out of
+// 4096-byte pages obtained from kalloc().  Each page (a slab)
+// starts with a struct slab header, followed by as many objects
+// as fit.  Slabs with at least one free object are kept on the
+// cache's partial list; a slab whose objects are all free again
+// is returned to kalloc().
+//
+// Each CPU also keeps a small magazine of free objects per cache.
+// slaballoc() and slabfree() only need to take the cache lock
+// when their CPU's magazine is empty or full, in which case
+// they move half a magazine's worth of objects at once.
+//
+// Interface:
+// * slabinit(c, name, size) prepares a statically allocated cache.
+// * slaballoc(c) returns an uninitialized object, or 0.
+// * slabfree(c, obj) gives the object back.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "slab.h"
+
+struct object {
+  struct object *next;
+};
+
+struct slab {
+  struct slab *next;     // partial list
+  struct slab *prev;
+  struct slabcache *cache;
+  uint inuse;            // objects handed out (incl. magazines)
+  struct object *free;   // free objects in this slab
+};
+
+#define SLABHDR  ((sizeof(struct slab) + 7) & ~7)
+
+void
+slabinit(struct slabcache *c, char *name, uint size)
+{
+  size = (size + 7) & ~7;
+  if(size < sizeof(struct object) || size > PGSIZE - SLABHDR)
+    panic("slabinit");
+  initlock(&c->lock, name);
+  c->name = name;
+  c->size = size;
+  c->perslab = (PGSIZE - SLABHDR) / size;
+  c->partial = 0;
+  c->nslab = 0;
+  memset(c->mag, 0, sizeof(c->mag));
+}
+
+// Carve a fresh page into objects.
+// Called without c->lock held.
+static struct slab*
+newslab(struct slabcache *c)
+{
+  struct slab *s;
+  struct object *o;
+  char *p;
+  uint i;
+
+  if((p = kalloc()) == 0)
+    return 0;
+  s = (struct slab*)p;
+  s->cache = c;
+  s->inuse = 0;
+  s->free = 0;
+  s->prev = s->next = 0;
+  for(i = c->perslab; i > 0; i--){
+    o = (struct object*)(p + SLABHDR + (i-1)*c->size);
+    o->next = s->free;
+    s->free = o;
+  }
+  return s;
+}
+
+static void
+unlinkslab(struct slabcache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+  s->prev = s->next = 0;
+}
+
+static void
+linkslab(struct slabcache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(c->partial)
+    c->partial->prev = s;
+  c->partial = s;
+}
+
+// Take one object from the partial slabs.
+// Caller must hold c->lock.
+static void*
+getobj(struct slabcache *c)
+{
+  struct slab *s;
+  struct object *o;
+
+  if((s = c->partial) == 0)
+    return 0;
+  o = s->free;
+  s->free = o->next;
+  s->inuse++;
+  if(s->free == 0)
+    unlinkslab(c, s);  // full slabs are not on any list
+  return o;
+}
+
+// Return one object to its slab, freeing the slab's page
+// if it no longer has objects in use.
+// Caller must hold c->lock.
+static void
+putobj(struct slabcache *c, void *v)
+{
+  struct slab *s;
+  struct object *o;
+
+  s = (struct slab*)PGROUNDDOWN((uint)v);
+  if(s->cache != c || s->inuse == 0)
+    panic("slabfree");
+  o = (struct object*)v;
+  if(s->free == 0)
+    linkslab(c, s);
+  o->next = s->free;
+  s->free = o;
+  if(--s->inuse == 0){
+    unlinkslab(c, s);
+    c->nslab--;
+    kfree((char*)s);
+  }
+}
+
+// Allocate one object from cache c.
+// Returns 0 if the memory cannot be allocated.
+void*
+slaballoc(struct slabcache *c)
+{
+  struct magazine *m;
+  struct slab *s;
+  void *v;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n > 0){
+    v = m->obj[--m->n];
+    popcli();
+    return v;
+  }
+  popcli();
+
+  acquire(&c->lock);
+  if(c->partial == 0){
+    release(&c->lock);
+    if((s = newslab(c)) == 0)
+      return 0;
+    acquire(&c->lock);
+    linkslab(c, s);
+    c->nslab++;
+  }
+  v = getobj(c);
+
+  // Refill this CPU's magazine while we hold the lock.
+  pushcli();
+  m = &c->mag[cpuid()];
+  while(m->n < MAGSIZE/2 && c->partial)
+    m->obj[m->n++] = getobj(c);
+  popcli();
+  release(&c->lock);
+  return v;
+}
+
+// Free an object that was returned by slaballoc(c).
+void
+slabfree(struct slabcache *c, void *v)
+{
+  struct magazine *m;
+
+  if(v == 0 || PGROUNDDOWN((uint)v) + SLABHDR > (uint)v)
+    panic("slabfree");
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n < MAGSIZE){
+    m->obj[m->n++] = v;
+    popcli();
+    return;
+  }
+  popcli();
+
+  // Magazine full: give half of it back to the slabs.
+  acquire(&c->lock);
+  pushcli();
+  m = &c->mag[cpuid()];
+  while(m->n > MAGSIZE/2)
+    putobj(c, m->obj[--m->n]);
+  popcli();
+  putobj(c, v);
+  release(&c->lock);
+}
@@ -0,0 +1,18 @@
+#define MAGSIZE 8  // objects per per-CPU magazine
+
+// Per-CPU stash of free objects.
+struct magazine {
+  int n;
+  void *obj[MAGSIZE];
+};
+
+// A cache of equal-sized kernel objects (see slab.c).
+struct slabcache {
+  struct spinlock lock;
+  char *name;
+  uint size;              // object size, rounded up to 8 bytes
+  uint perslab;           // objects per page
+  struct slab *partial;   // slabs with free objects
+  uint nslab;             // pages currently in use
+  struct magazine mag[NCPU];
+};
@@ -25,6 +25,23 @@ fetchint(uint addr, int *ip)
   return 0;
 }
 
+// Like fetchstr(), for a string in a memory-mapped region,
+// whose pages are faulted in one at a time as the scan reaches
+// them, since the kernel cannot take page faults.
+static int
+fetchmappedstr(uint addr, char **pp)
+{
+  char *s;
+
+  *pp = (char*)addr;
+  for(s = *pp; ; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) && vmaprefault((uint)s, 1, 0) < 0)
+      return -1;
+    if(*s == 0)
+      return s - *pp;
+  }
+}
+
 // Fetch the nul-terminated string at addr from the current process.
 // Doesn't actually copy the string - just sets *pp to point at it.
 // Returns length of string, not including nul.
@@ -35,7 +52,7 @@ fetchstr(uint addr, char **pp)
   struct proc *curproc = myproc();
 
   if(addr >= curproc->sz)
-    return -1;
+    return fetchmappedstr(addr, pp);
   *pp = (char*)addr;
   ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
@@ -52,6 +69,24 @@ argint(int n, int *ip)
   return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
 }
 
+// Check a pointer to a block of memory of size bytes that the
+// kernel is about to read (or, if write is set, write).  Memory-mapped
+// pages are faulted in here, since the kernel cannot take page faults.
+static int
+checkptr(int i, char **pp, int size, int write)
+{
+  struct proc *curproc = myproc();
+
+  if(size < 0)
+    return -1;
+  if((uint)i >= curproc->sz || (uint)i+size > curproc->sz){
+    if(vmaprefault((uint)i, size, write) < 0)
+      return -1;
+  }
+  *pp = (char*)i;
+  return 0;
+}
+
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
 // lies within the process address space.
@@ -59,14 +94,21 @@ int
 argptr(int n, char **pp, int size)
 {
   int i;
-  struct proc *curproc = myproc();
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  return checkptr(i, pp, size, 0);
+}
+
+// Like argptr, for memory the kernel will write to.
+int
+argptrw(int n, char **pp, int size)
+{
+  int i;
+
+  if(argint(n, &i) < 0)
     return -1;
-  *pp = (char*)i;
-  return 0;
+  return checkptr(i, pp, size, 1);
 }
 
 // Fetch the nth word-sized system call argument as a string pointer.
@@ -108,6 +150,10 @@ extern int sys_sched_policy(void);
 extern int sys_exec_time(void);
 extern int sys_deadline(void);
 extern int sys_rate(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_bcstat(void);
+extern int sys_splice(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -136,6 +182,10 @@ static int (*syscalls[])(void) = {
 [SYS_exec_time]       sys_exec_time,
 [SYS_deadline]        sys_deadline,
 [SYS_rate]            sys_rate,  
+[SYS_mmap]            sys_mmap,
+[SYS_munmap]          sys_munmap,
+[SYS_bcstat]          sys_bcstat,
+[SYS_splice]          sys_splice,
 };
 
 void
@@ -25,3 +25,7 @@
 #define SYS_exec_time      24
 #define SYS_deadline       25
 #define SYS_rate           26
+#define SYS_mmap           27
+#define SYS_munmap         28
+#define SYS_bcstat         29
+#define SYS_splice         30
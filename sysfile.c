@@ -15,6 +15,7 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "bcstat.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -35,16 +36,18 @@ argfd(int n, int *pfd, struct file **pf)
   return 0;
 }
 
-// Allocate a file descriptor for the given file.
+// Allocate the lowest free file descriptor for the given file.
 // Takes over file reference from caller on success.
 static int
 fdalloc(struct file *f)
 {
-  int fd;
+  int i, fd;
   struct proc *curproc = myproc();
 
-  for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd] == 0){
+  for(i = 0; i < NOFILE/32; i++){
+    if(curproc->ofmap[i] != ~0U){
+      fd = i*32 + __builtin_ctz(~curproc->ofmap[i]);
+      curproc->ofmap[i] |= 1U << (fd % 32);
       curproc->ofile[fd] = f;
       return fd;
     }
@@ -52,6 +55,16 @@ fdalloc(struct file *f)
   return -1;
 }
 
+// Free file descriptor fd, leaving its file to the caller.
+static void
+fdfree(int fd)
+{
+  struct proc *curproc = myproc();
+
+  curproc->ofile[fd] = 0;
+  curproc->ofmap[fd / 32] &= ~(1U << (fd % 32));
+}
+
 int
 sys_dup(void)
 {
@@ -73,7 +86,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -98,7 +111,7 @@ sys_close(void)
 
   if(argfd(0, &fd, &f) < 0)
     return -1;
-  myproc()->ofile[fd] = 0;
+  fdfree(fd);
   fileclose(f);
   return 0;
 }
@@ -109,7 +122,7 @@ sys_fstat(void)
   struct file *f;
   struct stat *st;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argptrw(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
   return filestat(f, st);
 }
@@ -171,10 +184,10 @@ isdirempty(struct inode *dp)
   int off;
   struct dirent de;
 
-  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+  for(off=0; off<dp->size; off+=sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("isdirempty: readi");
-    if(de.inum != 0)
+    if(de.inum != 0 && namecmp(de.name, ".") != 0 && namecmp(de.name, "..") != 0)
       return 0;
   }
   return 1;
@@ -218,6 +231,7 @@ sys_unlink(void)
   memset(&de, 0, sizeof(de));
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
+  dcachedel(dp, name);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -426,14 +440,14 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
     if(fd0 >= 0)
-      myproc()->ofile[fd0] = 0;
+      fdfree(fd0);
     fileclose(rf);
     fileclose(wf);
     return -1;
@@ -442,3 +456,53 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+int
+sys_mmap(void)
+{
+  struct file *f;
+  int addr, len, prot, flags, off;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || argint(2, &prot) < 0 ||
+     argint(3, &flags) < 0 || argfd(4, 0, &f) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(addr != 0 || len <= 0 || off < 0)
+    return -1;
+  return mmap(f, len, prot, flags, off);
+}
+
+// Move up to n bytes from fdin to fdout, at least one of
+// which must be a pipe, without copying through user memory.
+int
+sys_splice(void)
+{
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0)
+    return -1;
+  if(n < 0)
+    return -1;
+  return filesplice(in, out, n);
+}
+
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || len <= 0)
+    return -1;
+  return munmap(addr, len);
+}
+
+int
+sys_bcstat(void)
+{
+  struct bcstat *st;
+
+  if(argptrw(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  bstat(st);
+  return 0;
+}
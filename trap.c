@@ -78,6 +78,13 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // A first touch of a memory-mapped page?
+    if(myproc() && (tf->cs&3) == DPL_USER &&
+       vmafault(rcr2(), tf->err & FEC_WR) == 0)
+      break;
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -1,5 +1,6 @@
 struct stat;
 struct rtcdate;
+struct bcstat;
 
 // system calls
 int fork(void);
@@ -28,6 +29,10 @@ int sched_policy(int pid, int policy);
 int exec_time(int pid, int time);
 int deadline(int pid, int p_deadline);
 int rate(int pid, int p_rate);
+void* mmap(void*, int, int, int, int, int);
+int munmap(void*, int);
+int bcstat(struct bcstat*);
+int splice(int, int, int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -0,0 +1,8457 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 9c 64 00 00       	push   $0x649c
+      16:	6a 01                	push   $0x1
+      18:	e8 a3 4c 00 00       	call   4cc0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 b0 64 00 00       	push   $0x64b0
+      26:	e8 48 4b 00 00       	call   4b73 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 30 6e 00 00       	push   $0x6e30
+      39:	6a 01                	push   $0x1
+      3b:	e8 80 4c 00 00       	call   4cc0 <printf>
+    exit();
+      40:	e8 ee 4a 00 00       	call   4b33 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 b0 64 00 00       	push   $0x64b0
+      51:	e8 1d 4b 00 00       	call   4b73 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 fd 4a 00 00       	call   4b5b <close>
+
+  argptest();
+      5e:	e8 ad 43 00 00       	call   4410 <argptest>
+  createdelete();
+      63:	e8 58 17 00 00       	call   17c0 <createdelete>
+  linkunlink();
+      68:	e8 f3 1f 00 00       	call   2060 <linkunlink>
+  concreate();
+      6d:	e8 ee 1c 00 00       	call   1d60 <concreate>
+  fourfiles();
+      72:	e8 49 15 00 00       	call   15c0 <fourfiles>
+  sharedfd();
+      77:	e8 84 13 00 00       	call   1400 <sharedfd>
+
+  bigargtest();
+      7c:	e8 4f 40 00 00       	call   40d0 <bigargtest>
+  bigwrite();
+      81:	e8 fa 28 00 00       	call   2980 <bigwrite>
+  bigargtest();
+      86:	e8 45 40 00 00       	call   40d0 <bigargtest>
+  bsstest();
+      8b:	e8 d0 3f 00 00       	call   4060 <bsstest>
+  sbrktest();
+      90:	e8 cb 3a 00 00       	call   3b60 <sbrktest>
+  validatetest();
+      95:	e8 16 3f 00 00       	call   3fb0 <validatetest>
+
+  opentest();
+      9a:	e8 81 03 00 00       	call   420 <opentest>
+  writetest();
+      9f:	e8 0c 04 00 00       	call   4b0 <writetest>
+  writetest1();
+      a4:	e8 e7 05 00 00       	call   690 <writetest1>
+  createtest();
+      a9:	e8 b2 07 00 00       	call   860 <createtest>
+
+  openiputtest();
+      ae:	e8 6d 02 00 00       	call   320 <openiputtest>
+  exitiputtest();
+      b3:	e8 68 01 00 00       	call   220 <exitiputtest>
+  iputtest();
+      b8:	e8 83 00 00 00       	call   140 <iputtest>
+
+  mem();
+      bd:	e8 6e 12 00 00       	call   1330 <mem>
+  pipe1();
+      c2:	e8 79 09 00 00       	call   a40 <pipe1>
+  pipebench();
+      c7:	e8 14 0b 00 00       	call   be0 <pipebench>
+  splicetest();
+      cc:	e8 bf 0c 00 00       	call   d90 <splicetest>
+  fdtest();
+      d1:	e8 6a 0f 00 00       	call   1040 <fdtest>
+  preempt();
+      d6:	e8 75 10 00 00       	call   1150 <preempt>
+  exitwait();
+      db:	e8 d0 11 00 00       	call   12b0 <exitwait>
+
+  rmdot();
+      e0:	e8 2b 35 00 00       	call   3610 <rmdot>
+  fourteen();
+      e5:	e8 e6 33 00 00       	call   34d0 <fourteen>
+  bigfile();
+      ea:	e8 71 29 00 00       	call   2a60 <bigfile>
+  fragfile();
+      ef:	e8 ec 31 00 00       	call   32e0 <fragfile>
+  dcachetest();
+      f4:	e8 37 2b 00 00       	call   2c30 <dcachetest>
+  hashdir();
+      f9:	e8 d2 2c 00 00       	call   2dd0 <hashdir>
+  icachetest();
+      fe:	e8 ed 2e 00 00       	call   2ff0 <icachetest>
+  subdir();
+     103:	e8 98 21 00 00       	call   22a0 <subdir>
+  linktest();
+     108:	e8 43 1a 00 00       	call   1b50 <linktest>
+  unlinkread();
+     10d:	e8 ae 18 00 00       	call   19c0 <unlinkread>
+  dirfile();
+     112:	e8 79 36 00 00       	call   3790 <dirfile>
+  iref();
+     117:	e8 74 38 00 00       	call   3990 <iref>
+  forktest();
+     11c:	e8 8f 39 00 00       	call   3ab0 <forktest>
+  bigdir(); // slow
+     121:	e8 4a 20 00 00       	call   2170 <bigdir>
+
+  uio();
+     126:	e8 75 42 00 00       	call   43a0 <uio>
+
+  mmaptest();
+     12b:	e8 b0 44 00 00       	call   45e0 <mmaptest>
+  bcachetest();
+     130:	e8 4b 43 00 00       	call   4480 <bcachetest>
+
+  exectest();
+     135:	e8 b6 08 00 00       	call   9f0 <exectest>
+
+  exit();
+     13a:	e8 f4 49 00 00       	call   4b33 <exit>
+     13f:	90                   	nop
+
+00000140 <iputtest>:
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     146:	68 6e 50 00 00       	push   $0x506e
+     14b:	ff 35 38 79 00 00    	push   0x7938
+     151:	e8 6a 4b 00 00       	call   4cc0 <printf>
+  if(mkdir("iputdir") < 0){
+     156:	c7 04 24 01 50 00 00 	movl   $0x5001,(%esp)
+     15d:	e8 39 4a 00 00       	call   4b9b <mkdir>
+     162:	83 c4 10             	add    $0x10,%esp
+     165:	85 c0                	test   %eax,%eax
+     167:	78 58                	js     1c1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	68 01 50 00 00       	push   $0x5001
+     171:	e8 2d 4a 00 00       	call   4ba3 <chdir>
+     176:	83 c4 10             	add    $0x10,%esp
+     179:	85 c0                	test   %eax,%eax
+     17b:	0f 88 85 00 00 00    	js     206 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     181:	83 ec 0c             	sub    $0xc,%esp
+     184:	68 fe 4f 00 00       	push   $0x4ffe
+     189:	e8 f5 49 00 00       	call   4b83 <unlink>
+     18e:	83 c4 10             	add    $0x10,%esp
+     191:	85 c0                	test   %eax,%eax
+     193:	78 5a                	js     1ef <iputtest+0xaf>
+  if(chdir("/") < 0){
+     195:	83 ec 0c             	sub    $0xc,%esp
+     198:	68 23 50 00 00       	push   $0x5023
+     19d:	e8 01 4a 00 00       	call   4ba3 <chdir>
+     1a2:	83 c4 10             	add    $0x10,%esp
+     1a5:	85 c0                	test   %eax,%eax
+     1a7:	78 2f                	js     1d8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     1a9:	83 ec 08             	sub    $0x8,%esp
+     1ac:	68 97 50 00 00       	push   $0x5097
+     1b1:	ff 35 38 79 00 00    	push   0x7938
+     1b7:	e8 04 4b 00 00       	call   4cc0 <printf>
+}
+     1bc:	83 c4 10             	add    $0x10,%esp
+     1bf:	c9                   	leave
+     1c0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1c1:	50                   	push   %eax
+     1c2:	50                   	push   %eax
+     1c3:	68 d5 5d 00 00       	push   $0x5dd5
+     1c8:	ff 35 38 79 00 00    	push   0x7938
+     1ce:	e8 ed 4a 00 00       	call   4cc0 <printf>
+    exit();
+     1d3:	e8 5b 49 00 00       	call   4b33 <exit>
+    printf(stdout, "chdir / failed\n");
+     1d8:	50                   	push   %eax
+     1d9:	50                   	push   %eax
+     1da:	68 25 50 00 00       	push   $0x5025
+     1df:	ff 35 38 79 00 00    	push   0x7938
+     1e5:	e8 d6 4a 00 00       	call   4cc0 <printf>
+    exit();
+     1ea:	e8 44 49 00 00       	call   4b33 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1ef:	52                   	push   %edx
+     1f0:	52                   	push   %edx
+     1f1:	68 09 50 00 00       	push   $0x5009
+     1f6:	ff 35 38 79 00 00    	push   0x7938
+     1fc:	e8 bf 4a 00 00       	call   4cc0 <printf>
+    exit();
+     201:	e8 2d 49 00 00       	call   4b33 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     206:	51                   	push   %ecx
+     207:	51                   	push   %ecx
+     208:	68 e8 4f 00 00       	push   $0x4fe8
+     20d:	ff 35 38 79 00 00    	push   0x7938
+     213:	e8 a8 4a 00 00       	call   4cc0 <printf>
+    exit();
+     218:	e8 16 49 00 00       	call   4b33 <exit>
+     21d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000220 <exitiputtest>:
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     226:	68 35 50 00 00       	push   $0x5035
+     22b:	ff 35 38 79 00 00    	push   0x7938
+     231:	e8 8a 4a 00 00       	call   4cc0 <printf>
+  pid = fork();
+     236:	e8 f0 48 00 00       	call   4b2b <fork>
+  if(pid < 0){
+     23b:	83 c4 10             	add    $0x10,%esp
+     23e:	85 c0                	test   %eax,%eax
+     240:	0f 88 8a 00 00 00    	js     2d0 <exitiputtest+0xb0>
+  if(pid == 0){
+     246:	75 50                	jne    298 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     248:	83 ec 0c             	sub    $0xc,%esp
+     24b:	68 01 50 00 00       	push   $0x5001
+     250:	e8 46 49 00 00       	call   4b9b <mkdir>
+     255:	83 c4 10             	add    $0x10,%esp
+     258:	85 c0                	test   %eax,%eax
+     25a:	0f 88 87 00 00 00    	js     2e7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     260:	83 ec 0c             	sub    $0xc,%esp
+     263:	68 01 50 00 00       	push   $0x5001
+     268:	e8 36 49 00 00       	call   4ba3 <chdir>
+     26d:	83 c4 10             	add    $0x10,%esp
+     270:	85 c0                	test   %eax,%eax
+     272:	0f 88 86 00 00 00    	js     2fe <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     278:	83 ec 0c             	sub    $0xc,%esp
+     27b:	68 fe 4f 00 00       	push   $0x4ffe
+     280:	e8 fe 48 00 00       	call   4b83 <unlink>
+     285:	83 c4 10             	add    $0x10,%esp
+     288:	85 c0                	test   %eax,%eax
+     28a:	78 2c                	js     2b8 <exitiputtest+0x98>
+    exit();
+     28c:	e8 a2 48 00 00       	call   4b33 <exit>
+     291:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     298:	e8 9e 48 00 00       	call   4b3b <wait>
+  printf(stdout, "exitiput test ok\n");
+     29d:	83 ec 08             	sub    $0x8,%esp
+     2a0:	68 58 50 00 00       	push   $0x5058
+     2a5:	ff 35 38 79 00 00    	push   0x7938
+     2ab:	e8 10 4a 00 00       	call   4cc0 <printf>
+}
+     2b0:	83 c4 10             	add    $0x10,%esp
+     2b3:	c9                   	leave
+     2b4:	c3                   	ret
+     2b5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2b8:	83 ec 08             	sub    $0x8,%esp
+     2bb:	68 09 50 00 00       	push   $0x5009
+     2c0:	ff 35 38 79 00 00    	push   0x7938
+     2c6:	e8 f5 49 00 00       	call   4cc0 <printf>
+      exit();
+     2cb:	e8 63 48 00 00       	call   4b33 <exit>
+    printf(stdout, "fork failed\n");
+     2d0:	51                   	push   %ecx
+     2d1:	51                   	push   %ecx
+     2d2:	68 25 54 00 00       	push   $0x5425
+     2d7:	ff 35 38 79 00 00    	push   0x7938
+     2dd:	e8 de 49 00 00       	call   4cc0 <printf>
+    exit();
+     2e2:	e8 4c 48 00 00       	call   4b33 <exit>
+      printf(stdout, "mkdir failed\n");
+     2e7:	52                   	push   %edx
+     2e8:	52                   	push   %edx
+     2e9:	68 d5 5d 00 00       	push   $0x5dd5
+     2ee:	ff 35 38 79 00 00    	push   0x7938
+     2f4:	e8 c7 49 00 00       	call   4cc0 <printf>
+      exit();
+     2f9:	e8 35 48 00 00       	call   4b33 <exit>
+      printf(stdout, "child chdir failed\n");
+     2fe:	50                   	push   %eax
+     2ff:	50                   	push   %eax
+     300:	68 44 50 00 00       	push   $0x5044
+     305:	ff 35 38 79 00 00    	push   0x7938
+     30b:	e8 b0 49 00 00       	call   4cc0 <printf>
+      exit();
+     310:	e8 1e 48 00 00       	call   4b33 <exit>
+     315:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <openiputtest>:
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     326:	68 6a 50 00 00       	push   $0x506a
+     32b:	ff 35 38 79 00 00    	push   0x7938
+     331:	e8 8a 49 00 00       	call   4cc0 <printf>
+  if(mkdir("oidir") < 0){
+     336:	c7 04 24 79 50 00 00 	movl   $0x5079,(%esp)
+     33d:	e8 59 48 00 00       	call   4b9b <mkdir>
+     342:	83 c4 10             	add    $0x10,%esp
+     345:	85 c0                	test   %eax,%eax
+     347:	0f 88 9f 00 00 00    	js     3ec <openiputtest+0xcc>
+  pid = fork();
+     34d:	e8 d9 47 00 00       	call   4b2b <fork>
+  if(pid < 0){
+     352:	85 c0                	test   %eax,%eax
+     354:	78 7f                	js     3d5 <openiputtest+0xb5>
+  if(pid == 0){
+     356:	75 38                	jne    390 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     358:	83 ec 08             	sub    $0x8,%esp
+     35b:	6a 02                	push   $0x2
+     35d:	68 79 50 00 00       	push   $0x5079
+     362:	e8 0c 48 00 00       	call   4b73 <open>
+    if(fd >= 0){
+     367:	83 c4 10             	add    $0x10,%esp
+     36a:	85 c0                	test   %eax,%eax
+     36c:	78 62                	js     3d0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     36e:	83 ec 08             	sub    $0x8,%esp
+     371:	68 d0 64 00 00       	push   $0x64d0
+     376:	ff 35 38 79 00 00    	push   0x7938
+     37c:	e8 3f 49 00 00       	call   4cc0 <printf>
+      exit();
+     381:	e8 ad 47 00 00       	call   4b33 <exit>
+     386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     390:	83 ec 0c             	sub    $0xc,%esp
+     393:	6a 01                	push   $0x1
+     395:	e8 29 48 00 00       	call   4bc3 <sleep>
+  if(unlink("oidir") != 0){
+     39a:	c7 04 24 79 50 00 00 	movl   $0x5079,(%esp)
+     3a1:	e8 dd 47 00 00       	call   4b83 <unlink>
+     3a6:	83 c4 10             	add    $0x10,%esp
+     3a9:	85 c0                	test   %eax,%eax
+     3ab:	75 56                	jne    403 <openiputtest+0xe3>
+  wait();
+     3ad:	e8 89 47 00 00       	call   4b3b <wait>
+  printf(stdout, "openiput test ok\n");
+     3b2:	83 ec 08             	sub    $0x8,%esp
+     3b5:	68 93 50 00 00       	push   $0x5093
+     3ba:	ff 35 38 79 00 00    	push   0x7938
+     3c0:	e8 fb 48 00 00       	call   4cc0 <printf>
+}
+     3c5:	83 c4 10             	add    $0x10,%esp
+     3c8:	c9                   	leave
+     3c9:	c3                   	ret
+     3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3d0:	e8 5e 47 00 00       	call   4b33 <exit>
+    printf(stdout, "fork failed\n");
+     3d5:	52                   	push   %edx
+     3d6:	52                   	push   %edx
+     3d7:	68 25 54 00 00       	push   $0x5425
+     3dc:	ff 35 38 79 00 00    	push   0x7938
+     3e2:	e8 d9 48 00 00       	call   4cc0 <printf>
+    exit();
+     3e7:	e8 47 47 00 00       	call   4b33 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3ec:	51                   	push   %ecx
+     3ed:	51                   	push   %ecx
+     3ee:	68 7f 50 00 00       	push   $0x507f
+     3f3:	ff 35 38 79 00 00    	push   0x7938
+     3f9:	e8 c2 48 00 00       	call   4cc0 <printf>
+    exit();
+     3fe:	e8 30 47 00 00       	call   4b33 <exit>
+    printf(stdout, "unlink failed\n");
+     403:	50                   	push   %eax
+     404:	50                   	push   %eax
+     405:	68 e3 5c 00 00       	push   $0x5ce3
+     40a:	ff 35 38 79 00 00    	push   0x7938
+     410:	e8 ab 48 00 00       	call   4cc0 <printf>
+    exit();
+     415:	e8 19 47 00 00       	call   4b33 <exit>
+     41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <opentest>:
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     426:	68 a5 50 00 00       	push   $0x50a5
+     42b:	ff 35 38 79 00 00    	push   0x7938
+     431:	e8 8a 48 00 00       	call   4cc0 <printf>
+  fd = open("echo", 0);
+     436:	58                   	pop    %eax
+     437:	5a                   	pop    %edx
+     438:	6a 00                	push   $0x0
+     43a:	68 b0 50 00 00       	push   $0x50b0
+     43f:	e8 2f 47 00 00       	call   4b73 <open>
+  if(fd < 0){
+     444:	83 c4 10             	add    $0x10,%esp
+     447:	85 c0                	test   %eax,%eax
+     449:	78 36                	js     481 <opentest+0x61>
+  close(fd);
+     44b:	83 ec 0c             	sub    $0xc,%esp
+     44e:	50                   	push   %eax
+     44f:	e8 07 47 00 00       	call   4b5b <close>
+  fd = open("doesnotexist", 0);
+     454:	5a                   	pop    %edx
+     455:	59                   	pop    %ecx
+     456:	6a 00                	push   $0x0
+     458:	68 c8 50 00 00       	push   $0x50c8
+     45d:	e8 11 47 00 00       	call   4b73 <open>
+  if(fd >= 0){
+     462:	83 c4 10             	add    $0x10,%esp
+     465:	85 c0                	test   %eax,%eax
+     467:	79 2f                	jns    498 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     469:	83 ec 08             	sub    $0x8,%esp
+     46c:	68 f3 50 00 00       	push   $0x50f3
+     471:	ff 35 38 79 00 00    	push   0x7938
+     477:	e8 44 48 00 00       	call   4cc0 <printf>
+}
+     47c:	83 c4 10             	add    $0x10,%esp
+     47f:	c9                   	leave
+     480:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     481:	50                   	push   %eax
+     482:	50                   	push   %eax
+     483:	68 b5 50 00 00       	push   $0x50b5
+     488:	ff 35 38 79 00 00    	push   0x7938
+     48e:	e8 2d 48 00 00       	call   4cc0 <printf>
+    exit();
+     493:	e8 9b 46 00 00       	call   4b33 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     498:	50                   	push   %eax
+     499:	50                   	push   %eax
+     49a:	68 d5 50 00 00       	push   $0x50d5
+     49f:	ff 35 38 79 00 00    	push   0x7938
+     4a5:	e8 16 48 00 00       	call   4cc0 <printf>
+    exit();
+     4aa:	e8 84 46 00 00       	call   4b33 <exit>
+     4af:	90                   	nop
+
+000004b0 <writetest>:
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	56                   	push   %esi
+     4b4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4b5:	83 ec 08             	sub    $0x8,%esp
+     4b8:	68 01 51 00 00       	push   $0x5101
+     4bd:	ff 35 38 79 00 00    	push   0x7938
+     4c3:	e8 f8 47 00 00       	call   4cc0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4c8:	58                   	pop    %eax
+     4c9:	5a                   	pop    %edx
+     4ca:	68 02 02 00 00       	push   $0x202
+     4cf:	68 12 51 00 00       	push   $0x5112
+     4d4:	e8 9a 46 00 00       	call   4b73 <open>
+  if(fd >= 0){
+     4d9:	83 c4 10             	add    $0x10,%esp
+     4dc:	85 c0                	test   %eax,%eax
+     4de:	0f 88 88 01 00 00    	js     66c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4e4:	83 ec 08             	sub    $0x8,%esp
+     4e7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4e9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4eb:	68 18 51 00 00       	push   $0x5118
+     4f0:	ff 35 38 79 00 00    	push   0x7938
+     4f6:	e8 c5 47 00 00       	call   4cc0 <printf>
+     4fb:	83 c4 10             	add    $0x10,%esp
+     4fe:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     500:	83 ec 04             	sub    $0x4,%esp
+     503:	6a 0a                	push   $0xa
+     505:	68 4f 51 00 00       	push   $0x514f
+     50a:	56                   	push   %esi
+     50b:	e8 43 46 00 00       	call   4b53 <write>
+     510:	83 c4 10             	add    $0x10,%esp
+     513:	83 f8 0a             	cmp    $0xa,%eax
+     516:	0f 85 d9 00 00 00    	jne    5f5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     51c:	83 ec 04             	sub    $0x4,%esp
+     51f:	6a 0a                	push   $0xa
+     521:	68 5a 51 00 00       	push   $0x515a
+     526:	56                   	push   %esi
+     527:	e8 27 46 00 00       	call   4b53 <write>
+     52c:	83 c4 10             	add    $0x10,%esp
+     52f:	83 f8 0a             	cmp    $0xa,%eax
+     532:	0f 85 d6 00 00 00    	jne    60e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     538:	83 c3 01             	add    $0x1,%ebx
+     53b:	83 fb 64             	cmp    $0x64,%ebx
+     53e:	75 c0                	jne    500 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     540:	83 ec 08             	sub    $0x8,%esp
+     543:	68 65 51 00 00       	push   $0x5165
+     548:	ff 35 38 79 00 00    	push   0x7938
+     54e:	e8 6d 47 00 00       	call   4cc0 <printf>
+  close(fd);
+     553:	89 34 24             	mov    %esi,(%esp)
+     556:	e8 00 46 00 00       	call   4b5b <close>
+  fd = open("small", O_RDONLY);
+     55b:	5b                   	pop    %ebx
+     55c:	5e                   	pop    %esi
+     55d:	6a 00                	push   $0x0
+     55f:	68 12 51 00 00       	push   $0x5112
+     564:	e8 0a 46 00 00       	call   4b73 <open>
+  if(fd >= 0){
+     569:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     56c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     56e:	85 c0                	test   %eax,%eax
+     570:	0f 88 b1 00 00 00    	js     627 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     576:	83 ec 08             	sub    $0x8,%esp
+     579:	68 70 51 00 00       	push   $0x5170
+     57e:	ff 35 38 79 00 00    	push   0x7938
+     584:	e8 37 47 00 00       	call   4cc0 <printf>
+  i = read(fd, buf, 2000);
+     589:	83 c4 0c             	add    $0xc,%esp
+     58c:	68 d0 07 00 00       	push   $0x7d0
+     591:	68 80 a0 00 00       	push   $0xa080
+     596:	53                   	push   %ebx
+     597:	e8 af 45 00 00       	call   4b4b <read>
+  if(i == 2000){
+     59c:	83 c4 10             	add    $0x10,%esp
+     59f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     5a4:	0f 85 94 00 00 00    	jne    63e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     5aa:	83 ec 08             	sub    $0x8,%esp
+     5ad:	68 a4 51 00 00       	push   $0x51a4
+     5b2:	ff 35 38 79 00 00    	push   0x7938
+     5b8:	e8 03 47 00 00       	call   4cc0 <printf>
+  close(fd);
+     5bd:	89 1c 24             	mov    %ebx,(%esp)
+     5c0:	e8 96 45 00 00       	call   4b5b <close>
+  if(unlink("small") < 0){
+     5c5:	c7 04 24 12 51 00 00 	movl   $0x5112,(%esp)
+     5cc:	e8 b2 45 00 00       	call   4b83 <unlink>
+     5d1:	83 c4 10             	add    $0x10,%esp
+     5d4:	85 c0                	test   %eax,%eax
+     5d6:	78 7d                	js     655 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5d8:	83 ec 08             	sub    $0x8,%esp
+     5db:	68 cc 51 00 00       	push   $0x51cc
+     5e0:	ff 35 38 79 00 00    	push   0x7938
+     5e6:	e8 d5 46 00 00       	call   4cc0 <printf>
+}
+     5eb:	83 c4 10             	add    $0x10,%esp
+     5ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5f1:	5b                   	pop    %ebx
+     5f2:	5e                   	pop    %esi
+     5f3:	5d                   	pop    %ebp
+     5f4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5f5:	83 ec 04             	sub    $0x4,%esp
+     5f8:	53                   	push   %ebx
+     5f9:	68 f4 64 00 00       	push   $0x64f4
+     5fe:	ff 35 38 79 00 00    	push   0x7938
+     604:	e8 b7 46 00 00       	call   4cc0 <printf>
+      exit();
+     609:	e8 25 45 00 00       	call   4b33 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     60e:	83 ec 04             	sub    $0x4,%esp
+     611:	53                   	push   %ebx
+     612:	68 18 65 00 00       	push   $0x6518
+     617:	ff 35 38 79 00 00    	push   0x7938
+     61d:	e8 9e 46 00 00       	call   4cc0 <printf>
+      exit();
+     622:	e8 0c 45 00 00       	call   4b33 <exit>
+    printf(stdout, "error: open small failed!\n");
+     627:	51                   	push   %ecx
+     628:	51                   	push   %ecx
+     629:	68 89 51 00 00       	push   $0x5189
+     62e:	ff 35 38 79 00 00    	push   0x7938
+     634:	e8 87 46 00 00       	call   4cc0 <printf>
+    exit();
+     639:	e8 f5 44 00 00       	call   4b33 <exit>
+    printf(stdout, "read failed\n");
+     63e:	52                   	push   %edx
+     63f:	52                   	push   %edx
+     640:	68 ce 63 00 00       	push   $0x63ce
+     645:	ff 35 38 79 00 00    	push   0x7938
+     64b:	e8 70 46 00 00       	call   4cc0 <printf>
+    exit();
+     650:	e8 de 44 00 00       	call   4b33 <exit>
+    printf(stdout, "unlink small failed\n");
+     655:	50                   	push   %eax
+     656:	50                   	push   %eax
+     657:	68 b7 51 00 00       	push   $0x51b7
+     65c:	ff 35 38 79 00 00    	push   0x7938
+     662:	e8 59 46 00 00       	call   4cc0 <printf>
+    exit();
+     667:	e8 c7 44 00 00       	call   4b33 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     66c:	50                   	push   %eax
+     66d:	50                   	push   %eax
+     66e:	68 33 51 00 00       	push   $0x5133
+     673:	ff 35 38 79 00 00    	push   0x7938
+     679:	e8 42 46 00 00       	call   4cc0 <printf>
+    exit();
+     67e:	e8 b0 44 00 00       	call   4b33 <exit>
+     683:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000690 <writetest1>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	56                   	push   %esi
+     694:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     695:	83 ec 08             	sub    $0x8,%esp
+     698:	68 e0 51 00 00       	push   $0x51e0
+     69d:	ff 35 38 79 00 00    	push   0x7938
+     6a3:	e8 18 46 00 00       	call   4cc0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     6a8:	58                   	pop    %eax
+     6a9:	5a                   	pop    %edx
+     6aa:	68 02 02 00 00       	push   $0x202
+     6af:	68 5a 52 00 00       	push   $0x525a
+     6b4:	e8 ba 44 00 00       	call   4b73 <open>
+  if(fd < 0){
+     6b9:	83 c4 10             	add    $0x10,%esp
+     6bc:	85 c0                	test   %eax,%eax
+     6be:	0f 88 61 01 00 00    	js     825 <writetest1+0x195>
+     6c4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGBLOCKS; i++){
+     6c6:	31 db                	xor    %ebx,%ebx
+     6c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cf:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6d0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6d3:	89 1d 80 a0 00 00    	mov    %ebx,0xa080
+    if(write(fd, buf, 512) != 512){
+     6d9:	68 00 02 00 00       	push   $0x200
+     6de:	68 80 a0 00 00       	push   $0xa080
+     6e3:	56                   	push   %esi
+     6e4:	e8 6a 44 00 00       	call   4b53 <write>
+     6e9:	83 c4 10             	add    $0x10,%esp
+     6ec:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6f1:	0f 85 b3 00 00 00    	jne    7aa <writetest1+0x11a>
+  for(i = 0; i < BIGBLOCKS; i++){
+     6f7:	83 c3 01             	add    $0x1,%ebx
+     6fa:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+     700:	75 ce                	jne    6d0 <writetest1+0x40>
+  close(fd);
+     702:	83 ec 0c             	sub    $0xc,%esp
+     705:	56                   	push   %esi
+     706:	e8 50 44 00 00       	call   4b5b <close>
+  fd = open("big", O_RDONLY);
+     70b:	5b                   	pop    %ebx
+     70c:	5e                   	pop    %esi
+     70d:	6a 00                	push   $0x0
+     70f:	68 5a 52 00 00       	push   $0x525a
+     714:	e8 5a 44 00 00       	call   4b73 <open>
+  if(fd < 0){
+     719:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     71c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     71e:	85 c0                	test   %eax,%eax
+     720:	0f 88 e8 00 00 00    	js     80e <writetest1+0x17e>
+  n = 0;
+     726:	31 f6                	xor    %esi,%esi
+     728:	eb 1d                	jmp    747 <writetest1+0xb7>
+     72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     730:	3d 00 02 00 00       	cmp    $0x200,%eax
+     735:	0f 85 9f 00 00 00    	jne    7da <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     73b:	a1 80 a0 00 00       	mov    0xa080,%eax
+     740:	39 f0                	cmp    %esi,%eax
+     742:	75 7f                	jne    7c3 <writetest1+0x133>
+    n++;
+     744:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     747:	83 ec 04             	sub    $0x4,%esp
+     74a:	68 00 02 00 00       	push   $0x200
+     74f:	68 80 a0 00 00       	push   $0xa080
+     754:	53                   	push   %ebx
+     755:	e8 f1 43 00 00       	call   4b4b <read>
+    if(i == 0){
+     75a:	83 c4 10             	add    $0x10,%esp
+     75d:	85 c0                	test   %eax,%eax
+     75f:	75 cf                	jne    730 <writetest1+0xa0>
+      if(n == BIGBLOCKS - 1){
+     761:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+     767:	0f 84 86 00 00 00    	je     7f3 <writetest1+0x163>
+  close(fd);
+     76d:	83 ec 0c             	sub    $0xc,%esp
+     770:	53                   	push   %ebx
+     771:	e8 e5 43 00 00       	call   4b5b <close>
+  if(unlink("big") < 0){
+     776:	c7 04 24 5a 52 00 00 	movl   $0x525a,(%esp)
+     77d:	e8 01 44 00 00       	call   4b83 <unlink>
+     782:	83 c4 10             	add    $0x10,%esp
+     785:	85 c0                	test   %eax,%eax
+     787:	0f 88 af 00 00 00    	js     83c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     78d:	83 ec 08             	sub    $0x8,%esp
+     790:	68 81 52 00 00       	push   $0x5281
+     795:	ff 35 38 79 00 00    	push   0x7938
+     79b:	e8 20 45 00 00       	call   4cc0 <printf>
+}
+     7a0:	83 c4 10             	add    $0x10,%esp
+     7a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7a6:	5b                   	pop    %ebx
+     7a7:	5e                   	pop    %esi
+     7a8:	5d                   	pop    %ebp
+     7a9:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     7aa:	83 ec 04             	sub    $0x4,%esp
+     7ad:	53                   	push   %ebx
+     7ae:	68 0a 52 00 00       	push   $0x520a
+     7b3:	ff 35 38 79 00 00    	push   0x7938
+     7b9:	e8 02 45 00 00       	call   4cc0 <printf>
+      exit();
+     7be:	e8 70 43 00 00       	call   4b33 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7c3:	50                   	push   %eax
+     7c4:	56                   	push   %esi
+     7c5:	68 3c 65 00 00       	push   $0x653c
+     7ca:	ff 35 38 79 00 00    	push   0x7938
+     7d0:	e8 eb 44 00 00       	call   4cc0 <printf>
+      exit();
+     7d5:	e8 59 43 00 00       	call   4b33 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7da:	83 ec 04             	sub    $0x4,%esp
+     7dd:	50                   	push   %eax
+     7de:	68 5e 52 00 00       	push   $0x525e
+     7e3:	ff 35 38 79 00 00    	push   0x7938
+     7e9:	e8 d2 44 00 00       	call   4cc0 <printf>
+      exit();
+     7ee:	e8 40 43 00 00       	call   4b33 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7f3:	52                   	push   %edx
+     7f4:	68 ff 03 00 00       	push   $0x3ff
+     7f9:	68 41 52 00 00       	push   $0x5241
+     7fe:	ff 35 38 79 00 00    	push   0x7938
+     804:	e8 b7 44 00 00       	call   4cc0 <printf>
+        exit();
+     809:	e8 25 43 00 00       	call   4b33 <exit>
+    printf(stdout, "error: open big failed!\n");
+     80e:	51                   	push   %ecx
+     80f:	51                   	push   %ecx
+     810:	68 28 52 00 00       	push   $0x5228
+     815:	ff 35 38 79 00 00    	push   0x7938
+     81b:	e8 a0 44 00 00       	call   4cc0 <printf>
+    exit();
+     820:	e8 0e 43 00 00       	call   4b33 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     825:	50                   	push   %eax
+     826:	50                   	push   %eax
+     827:	68 f0 51 00 00       	push   $0x51f0
+     82c:	ff 35 38 79 00 00    	push   0x7938
+     832:	e8 89 44 00 00       	call   4cc0 <printf>
+    exit();
+     837:	e8 f7 42 00 00       	call   4b33 <exit>
+    printf(stdout, "unlink big failed\n");
+     83c:	50                   	push   %eax
+     83d:	50                   	push   %eax
+     83e:	68 6e 52 00 00       	push   $0x526e
+     843:	ff 35 38 79 00 00    	push   0x7938
+     849:	e8 72 44 00 00       	call   4cc0 <printf>
+    exit();
+     84e:	e8 e0 42 00 00       	call   4b33 <exit>
+     853:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000860 <createtest>:
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	53                   	push   %ebx
+  name[2] = '\0';
+     864:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     869:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     86c:	68 5c 65 00 00       	push   $0x655c
+     871:	ff 35 38 79 00 00    	push   0x7938
+     877:	e8 44 44 00 00       	call   4cc0 <printf>
+  name[0] = 'a';
+     87c:	c6 05 70 a0 00 00 61 	movb   $0x61,0xa070
+  name[2] = '\0';
+     883:	83 c4 10             	add    $0x10,%esp
+     886:	c6 05 72 a0 00 00 00 	movb   $0x0,0xa072
+  for(i = 0; i < 52; i++){
+     88d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     890:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     893:	88 1d 71 a0 00 00    	mov    %bl,0xa071
+  for(i = 0; i < 52; i++){
+     899:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     89c:	68 02 02 00 00       	push   $0x202
+     8a1:	68 70 a0 00 00       	push   $0xa070
+     8a6:	e8 c8 42 00 00       	call   4b73 <open>
+    close(fd);
+     8ab:	89 04 24             	mov    %eax,(%esp)
+     8ae:	e8 a8 42 00 00       	call   4b5b <close>
+  for(i = 0; i < 52; i++){
+     8b3:	83 c4 10             	add    $0x10,%esp
+     8b6:	80 fb 64             	cmp    $0x64,%bl
+     8b9:	75 d5                	jne    890 <createtest+0x30>
+  name[0] = 'a';
+     8bb:	c6 05 70 a0 00 00 61 	movb   $0x61,0xa070
+  name[2] = '\0';
+     8c2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8c7:	c6 05 72 a0 00 00 00 	movb   $0x0,0xa072
+  for(i = 0; i < 52; i++){
+     8ce:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8d0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8d3:	88 1d 71 a0 00 00    	mov    %bl,0xa071
+  for(i = 0; i < 52; i++){
+     8d9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8dc:	68 70 a0 00 00       	push   $0xa070
+     8e1:	e8 9d 42 00 00       	call   4b83 <unlink>
+  for(i = 0; i < 52; i++){
+     8e6:	83 c4 10             	add    $0x10,%esp
+     8e9:	80 fb 64             	cmp    $0x64,%bl
+     8ec:	75 e2                	jne    8d0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8ee:	83 ec 08             	sub    $0x8,%esp
+     8f1:	68 84 65 00 00       	push   $0x6584
+     8f6:	ff 35 38 79 00 00    	push   0x7938
+     8fc:	e8 bf 43 00 00       	call   4cc0 <printf>
+}
+     901:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     904:	83 c4 10             	add    $0x10,%esp
+     907:	c9                   	leave
+     908:	c3                   	ret
+     909:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000910 <dirtest>:
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     916:	68 8f 52 00 00       	push   $0x528f
+     91b:	ff 35 38 79 00 00    	push   0x7938
+     921:	e8 9a 43 00 00       	call   4cc0 <printf>
+  if(mkdir("dir0") < 0){
+     926:	c7 04 24 9b 52 00 00 	movl   $0x529b,(%esp)
+     92d:	e8 69 42 00 00       	call   4b9b <mkdir>
+     932:	83 c4 10             	add    $0x10,%esp
+     935:	85 c0                	test   %eax,%eax
+     937:	78 58                	js     991 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     939:	83 ec 0c             	sub    $0xc,%esp
+     93c:	68 9b 52 00 00       	push   $0x529b
+     941:	e8 5d 42 00 00       	call   4ba3 <chdir>
+     946:	83 c4 10             	add    $0x10,%esp
+     949:	85 c0                	test   %eax,%eax
+     94b:	0f 88 85 00 00 00    	js     9d6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     951:	83 ec 0c             	sub    $0xc,%esp
+     954:	68 ba 59 00 00       	push   $0x59ba
+     959:	e8 45 42 00 00       	call   4ba3 <chdir>
+     95e:	83 c4 10             	add    $0x10,%esp
+     961:	85 c0                	test   %eax,%eax
+     963:	78 5a                	js     9bf <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     965:	83 ec 0c             	sub    $0xc,%esp
+     968:	68 9b 52 00 00       	push   $0x529b
+     96d:	e8 11 42 00 00       	call   4b83 <unlink>
+     972:	83 c4 10             	add    $0x10,%esp
+     975:	85 c0                	test   %eax,%eax
+     977:	78 2f                	js     9a8 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     979:	83 ec 08             	sub    $0x8,%esp
+     97c:	68 d8 52 00 00       	push   $0x52d8
+     981:	ff 35 38 79 00 00    	push   0x7938
+     987:	e8 34 43 00 00       	call   4cc0 <printf>
+}
+     98c:	83 c4 10             	add    $0x10,%esp
+     98f:	c9                   	leave
+     990:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     991:	50                   	push   %eax
+     992:	50                   	push   %eax
+     993:	68 d5 5d 00 00       	push   $0x5dd5
+     998:	ff 35 38 79 00 00    	push   0x7938
+     99e:	e8 1d 43 00 00       	call   4cc0 <printf>
+    exit();
+     9a3:	e8 8b 41 00 00       	call   4b33 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     9a8:	50                   	push   %eax
+     9a9:	50                   	push   %eax
+     9aa:	68 c4 52 00 00       	push   $0x52c4
+     9af:	ff 35 38 79 00 00    	push   0x7938
+     9b5:	e8 06 43 00 00       	call   4cc0 <printf>
+    exit();
+     9ba:	e8 74 41 00 00       	call   4b33 <exit>
+    printf(stdout, "chdir .. failed\n");
+     9bf:	52                   	push   %edx
+     9c0:	52                   	push   %edx
+     9c1:	68 b3 52 00 00       	push   $0x52b3
+     9c6:	ff 35 38 79 00 00    	push   0x7938
+     9cc:	e8 ef 42 00 00       	call   4cc0 <printf>
+    exit();
+     9d1:	e8 5d 41 00 00       	call   4b33 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9d6:	51                   	push   %ecx
+     9d7:	51                   	push   %ecx
+     9d8:	68 a0 52 00 00       	push   $0x52a0
+     9dd:	ff 35 38 79 00 00    	push   0x7938
+     9e3:	e8 d8 42 00 00       	call   4cc0 <printf>
+    exit();
+     9e8:	e8 46 41 00 00       	call   4b33 <exit>
+     9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <exectest>:
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9f6:	68 e7 52 00 00       	push   $0x52e7
+     9fb:	ff 35 38 79 00 00    	push   0x7938
+     a01:	e8 ba 42 00 00       	call   4cc0 <printf>
+  if(exec("echo", echoargv) < 0){
+     a06:	5a                   	pop    %edx
+     a07:	59                   	pop    %ecx
+     a08:	68 3c 79 00 00       	push   $0x793c
+     a0d:	68 b0 50 00 00       	push   $0x50b0
+     a12:	e8 54 41 00 00       	call   4b6b <exec>
+     a17:	83 c4 10             	add    $0x10,%esp
+     a1a:	85 c0                	test   %eax,%eax
+     a1c:	78 02                	js     a20 <exectest+0x30>
+}
+     a1e:	c9                   	leave
+     a1f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a20:	50                   	push   %eax
+     a21:	50                   	push   %eax
+     a22:	68 f2 52 00 00       	push   $0x52f2
+     a27:	ff 35 38 79 00 00    	push   0x7938
+     a2d:	e8 8e 42 00 00       	call   4cc0 <printf>
+    exit();
+     a32:	e8 fc 40 00 00       	call   4b33 <exit>
+     a37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3e:	66 90                	xchg   %ax,%ax
+
+00000a40 <pipe1>:
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	57                   	push   %edi
+     a44:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a45:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a48:	53                   	push   %ebx
+     a49:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a4c:	50                   	push   %eax
+     a4d:	e8 f1 40 00 00       	call   4b43 <pipe>
+     a52:	83 c4 10             	add    $0x10,%esp
+     a55:	85 c0                	test   %eax,%eax
+     a57:	0f 85 41 01 00 00    	jne    b9e <pipe1+0x15e>
+     a5d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a5f:	e8 c7 40 00 00       	call   4b2b <fork>
+  if(pid == 0){
+     a64:	85 c0                	test   %eax,%eax
+     a66:	0f 84 92 00 00 00    	je     afe <pipe1+0xbe>
+  } else if(pid > 0){
+     a6c:	0f 8e 3f 01 00 00    	jle    bb1 <pipe1+0x171>
+    close(fds[1]);
+     a72:	83 ec 0c             	sub    $0xc,%esp
+     a75:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a78:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a7a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a7f:	e8 d7 40 00 00       	call   4b5b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a84:	83 c4 10             	add    $0x10,%esp
+     a87:	83 ec 04             	sub    $0x4,%esp
+     a8a:	57                   	push   %edi
+     a8b:	68 80 a0 00 00       	push   $0xa080
+     a90:	ff 75 e0             	push   -0x20(%ebp)
+     a93:	e8 b3 40 00 00       	call   4b4b <read>
+     a98:	83 c4 10             	add    $0x10,%esp
+     a9b:	89 c1                	mov    %eax,%ecx
+     a9d:	85 c0                	test   %eax,%eax
+     a9f:	0f 8e b8 00 00 00    	jle    b5d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     aa5:	89 f0                	mov    %esi,%eax
+     aa7:	32 05 80 a0 00 00    	xor    0xa080,%al
+     aad:	0f b6 c0             	movzbl %al,%eax
+     ab0:	85 c0                	test   %eax,%eax
+     ab2:	75 30                	jne    ae4 <pipe1+0xa4>
+     ab4:	83 c6 01             	add    $0x1,%esi
+     ab7:	eb 0f                	jmp    ac8 <pipe1+0x88>
+     ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ac0:	38 90 80 a0 00 00    	cmp    %dl,0xa080(%eax)
+     ac6:	75 1c                	jne    ae4 <pipe1+0xa4>
+     ac8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     acb:	83 c0 01             	add    $0x1,%eax
+     ace:	39 c1                	cmp    %eax,%ecx
+     ad0:	75 ee                	jne    ac0 <pipe1+0x80>
+      cc = cc * 2;
+     ad2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ad4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ad9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     adb:	89 d6                	mov    %edx,%esi
+     add:	39 c7                	cmp    %eax,%edi
+     adf:	0f 4f f8             	cmovg  %eax,%edi
+     ae2:	eb a3                	jmp    a87 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ae4:	83 ec 08             	sub    $0x8,%esp
+     ae7:	68 12 53 00 00       	push   $0x5312
+     aec:	6a 01                	push   $0x1
+     aee:	e8 cd 41 00 00       	call   4cc0 <printf>
+     af3:	83 c4 10             	add    $0x10,%esp
+}
+     af6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     af9:	5b                   	pop    %ebx
+     afa:	5e                   	pop    %esi
+     afb:	5f                   	pop    %edi
+     afc:	5d                   	pop    %ebp
+     afd:	c3                   	ret
+    close(fds[0]);
+     afe:	83 ec 0c             	sub    $0xc,%esp
+     b01:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     b04:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     b06:	e8 50 40 00 00       	call   4b5b <close>
+     b0b:	83 c4 10             	add    $0x10,%esp
+     b0e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b10:	31 c0                	xor    %eax,%eax
+     b12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b18:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b1b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b1e:	88 90 7f a0 00 00    	mov    %dl,0xa07f(%eax)
+      for(i = 0; i < 1033; i++)
+     b24:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b29:	75 ed                	jne    b18 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b2b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b2e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b34:	68 09 04 00 00       	push   $0x409
+     b39:	68 80 a0 00 00       	push   $0xa080
+     b3e:	ff 75 e4             	push   -0x1c(%ebp)
+     b41:	e8 0d 40 00 00       	call   4b53 <write>
+     b46:	83 c4 10             	add    $0x10,%esp
+     b49:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b4e:	75 74                	jne    bc4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b50:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b56:	75 b8                	jne    b10 <pipe1+0xd0>
+    exit();
+     b58:	e8 d6 3f 00 00       	call   4b33 <exit>
+    if(total != 5 * 1033){
+     b5d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b63:	75 26                	jne    b8b <pipe1+0x14b>
+    close(fds[0]);
+     b65:	83 ec 0c             	sub    $0xc,%esp
+     b68:	ff 75 e0             	push   -0x20(%ebp)
+     b6b:	e8 eb 3f 00 00       	call   4b5b <close>
+    wait();
+     b70:	e8 c6 3f 00 00       	call   4b3b <wait>
+  printf(1, "pipe1 ok\n");
+     b75:	5a                   	pop    %edx
+     b76:	59                   	pop    %ecx
+     b77:	68 37 53 00 00       	push   $0x5337
+     b7c:	6a 01                	push   $0x1
+     b7e:	e8 3d 41 00 00       	call   4cc0 <printf>
+     b83:	83 c4 10             	add    $0x10,%esp
+     b86:	e9 6b ff ff ff       	jmp    af6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b8b:	56                   	push   %esi
+     b8c:	53                   	push   %ebx
+     b8d:	68 20 53 00 00       	push   $0x5320
+     b92:	6a 01                	push   $0x1
+     b94:	e8 27 41 00 00       	call   4cc0 <printf>
+      exit();
+     b99:	e8 95 3f 00 00       	call   4b33 <exit>
+    printf(1, "pipe() failed\n");
+     b9e:	50                   	push   %eax
+     b9f:	50                   	push   %eax
+     ba0:	68 0e 54 00 00       	push   $0x540e
+     ba5:	6a 01                	push   $0x1
+     ba7:	e8 14 41 00 00       	call   4cc0 <printf>
+    exit();
+     bac:	e8 82 3f 00 00       	call   4b33 <exit>
+    printf(1, "fork() failed\n");
+     bb1:	50                   	push   %eax
+     bb2:	50                   	push   %eax
+     bb3:	68 41 53 00 00       	push   $0x5341
+     bb8:	6a 01                	push   $0x1
+     bba:	e8 01 41 00 00       	call   4cc0 <printf>
+    exit();
+     bbf:	e8 6f 3f 00 00       	call   4b33 <exit>
+        printf(1, "pipe1 oops 1\n");
+     bc4:	57                   	push   %edi
+     bc5:	57                   	push   %edi
+     bc6:	68 04 53 00 00       	push   $0x5304
+     bcb:	6a 01                	push   $0x1
+     bcd:	e8 ee 40 00 00       	call   4cc0 <printf>
+        exit();
+     bd2:	e8 5c 3f 00 00       	call   4b33 <exit>
+     bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bde:	66 90                	xchg   %ax,%ax
+
+00000be0 <pipebench>:
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	57                   	push   %edi
+     be4:	56                   	push   %esi
+     be5:	53                   	push   %ebx
+     be6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "pipebench test\n");
+     be9:	68 50 53 00 00       	push   $0x5350
+     bee:	6a 01                	push   $0x1
+     bf0:	e8 cb 40 00 00       	call   4cc0 <printf>
+  if(pipe(fds) != 0){
+     bf5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     bf8:	89 04 24             	mov    %eax,(%esp)
+     bfb:	e8 43 3f 00 00       	call   4b43 <pipe>
+     c00:	83 c4 10             	add    $0x10,%esp
+     c03:	85 c0                	test   %eax,%eax
+     c05:	0f 85 3d 01 00 00    	jne    d48 <pipebench+0x168>
+     c0b:	89 c3                	mov    %eax,%ebx
+  pid = fork();
+     c0d:	e8 19 3f 00 00       	call   4b2b <fork>
+  if(pid < 0){
+     c12:	85 c0                	test   %eax,%eax
+     c14:	0f 88 1b 01 00 00    	js     d35 <pipebench+0x155>
+  if(pid == 0){
+     c1a:	75 5c                	jne    c78 <pipebench+0x98>
+    close(fds[0]);
+     c1c:	83 ec 0c             	sub    $0xc,%esp
+     c1f:	ff 75 e0             	push   -0x20(%ebp)
+    memset(buf, 'p', sizeof(buf));
+     c22:	bb 00 08 00 00       	mov    $0x800,%ebx
+    close(fds[0]);
+     c27:	e8 2f 3f 00 00       	call   4b5b <close>
+    memset(buf, 'p', sizeof(buf));
+     c2c:	83 c4 0c             	add    $0xc,%esp
+     c2f:	68 00 20 00 00       	push   $0x2000
+     c34:	6a 70                	push   $0x70
+     c36:	68 80 a0 00 00       	push   $0xa080
+     c3b:	e8 70 3d 00 00       	call   49b0 <memset>
+     c40:	83 c4 10             	add    $0x10,%esp
+     c43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c47:	90                   	nop
+      if(write(fds[1], buf, sizeof(buf)) != sizeof(buf)){
+     c48:	83 ec 04             	sub    $0x4,%esp
+     c4b:	68 00 20 00 00       	push   $0x2000
+     c50:	68 80 a0 00 00       	push   $0xa080
+     c55:	ff 75 e4             	push   -0x1c(%ebp)
+     c58:	e8 f6 3e 00 00       	call   4b53 <write>
+     c5d:	83 c4 10             	add    $0x10,%esp
+     c60:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     c65:	0f 85 b6 00 00 00    	jne    d21 <pipebench+0x141>
+    for(total = 0; total < PIPEBENCHKB*1024; total += sizeof(buf)){
+     c6b:	83 eb 01             	sub    $0x1,%ebx
+     c6e:	75 d8                	jne    c48 <pipebench+0x68>
+    exit();
+     c70:	e8 be 3e 00 00       	call   4b33 <exit>
+     c75:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fds[1]);
+     c78:	83 ec 0c             	sub    $0xc,%esp
+     c7b:	ff 75 e4             	push   -0x1c(%ebp)
+  total = 0;
+     c7e:	31 f6                	xor    %esi,%esi
+  close(fds[1]);
+     c80:	e8 d6 3e 00 00       	call   4b5b <close>
+  start = uptime();
+     c85:	e8 41 3f 00 00       	call   4bcb <uptime>
+  while((n = read(fds[0], buf, sizeof(buf))) > 0){
+     c8a:	83 c4 10             	add    $0x10,%esp
+  start = uptime();
+     c8d:	89 c7                	mov    %eax,%edi
+  while((n = read(fds[0], buf, sizeof(buf))) > 0){
+     c8f:	eb 0c                	jmp    c9d <pipebench+0xbd>
+     c91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    total += n;
+     c98:	01 c6                	add    %eax,%esi
+    nread++;
+     c9a:	83 c3 01             	add    $0x1,%ebx
+  while((n = read(fds[0], buf, sizeof(buf))) > 0){
+     c9d:	83 ec 04             	sub    $0x4,%esp
+     ca0:	68 00 20 00 00       	push   $0x2000
+     ca5:	68 80 a0 00 00       	push   $0xa080
+     caa:	ff 75 e0             	push   -0x20(%ebp)
+     cad:	e8 99 3e 00 00       	call   4b4b <read>
+     cb2:	83 c4 10             	add    $0x10,%esp
+     cb5:	85 c0                	test   %eax,%eax
+     cb7:	7f df                	jg     c98 <pipebench+0xb8>
+  ticks = uptime() - start;
+     cb9:	e8 0d 3f 00 00       	call   4bcb <uptime>
+  close(fds[0]);
+     cbe:	83 ec 0c             	sub    $0xc,%esp
+     cc1:	ff 75 e0             	push   -0x20(%ebp)
+  ticks = uptime() - start;
+     cc4:	29 f8                	sub    %edi,%eax
+     cc6:	89 c7                	mov    %eax,%edi
+  close(fds[0]);
+     cc8:	e8 8e 3e 00 00       	call   4b5b <close>
+  wait();
+     ccd:	e8 69 3e 00 00       	call   4b3b <wait>
+  if(total != PIPEBENCHKB*1024){
+     cd2:	83 c4 10             	add    $0x10,%esp
+     cd5:	81 fe 00 00 00 01    	cmp    $0x1000000,%esi
+     cdb:	75 7e                	jne    d5b <pipebench+0x17b>
+  printf(1, "pipebench: %d KB in %d ticks, %d reads, %d bytes per read\n",
+     cdd:	89 f0                	mov    %esi,%eax
+     cdf:	31 d2                	xor    %edx,%edx
+     ce1:	83 ec 08             	sub    $0x8,%esp
+     ce4:	f7 f3                	div    %ebx
+     ce6:	50                   	push   %eax
+     ce7:	89 c6                	mov    %eax,%esi
+     ce9:	53                   	push   %ebx
+     cea:	57                   	push   %edi
+     ceb:	68 00 40 00 00       	push   $0x4000
+     cf0:	68 ac 65 00 00       	push   $0x65ac
+     cf5:	6a 01                	push   $0x1
+     cf7:	e8 c4 3f 00 00       	call   4cc0 <printf>
+  if(total / nread <= OLDPIPESIZE){
+     cfc:	83 c4 20             	add    $0x20,%esp
+     cff:	81 fe 00 02 00 00    	cmp    $0x200,%esi
+     d05:	76 67                	jbe    d6e <pipebench+0x18e>
+  printf(1, "pipebench ok\n");
+     d07:	83 ec 08             	sub    $0x8,%esp
+     d0a:	68 c5 53 00 00       	push   $0x53c5
+     d0f:	6a 01                	push   $0x1
+     d11:	e8 aa 3f 00 00       	call   4cc0 <printf>
+}
+     d16:	83 c4 10             	add    $0x10,%esp
+     d19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d1c:	5b                   	pop    %ebx
+     d1d:	5e                   	pop    %esi
+     d1e:	5f                   	pop    %edi
+     d1f:	5d                   	pop    %ebp
+     d20:	c3                   	ret
+        printf(1, "pipebench: write failed\n");
+     d21:	83 ec 08             	sub    $0x8,%esp
+     d24:	68 92 53 00 00       	push   $0x5392
+     d29:	6a 01                	push   $0x1
+     d2b:	e8 90 3f 00 00       	call   4cc0 <printf>
+        exit();
+     d30:	e8 fe 3d 00 00       	call   4b33 <exit>
+    printf(1, "pipebench: fork failed\n");
+     d35:	51                   	push   %ecx
+     d36:	51                   	push   %ecx
+     d37:	68 7a 53 00 00       	push   $0x537a
+     d3c:	6a 01                	push   $0x1
+     d3e:	e8 7d 3f 00 00       	call   4cc0 <printf>
+    exit();
+     d43:	e8 eb 3d 00 00       	call   4b33 <exit>
+    printf(1, "pipebench: pipe() failed\n");
+     d48:	53                   	push   %ebx
+     d49:	53                   	push   %ebx
+     d4a:	68 60 53 00 00       	push   $0x5360
+     d4f:	6a 01                	push   $0x1
+     d51:	e8 6a 3f 00 00       	call   4cc0 <printf>
+    exit();
+     d56:	e8 d8 3d 00 00       	call   4b33 <exit>
+    printf(1, "pipebench: read %d bytes\n", total);
+     d5b:	52                   	push   %edx
+     d5c:	56                   	push   %esi
+     d5d:	68 ab 53 00 00       	push   $0x53ab
+     d62:	6a 01                	push   $0x1
+     d64:	e8 57 3f 00 00       	call   4cc0 <printf>
+    exit();
+     d69:	e8 c5 3d 00 00       	call   4b33 <exit>
+    printf(1, "pipebench: reads no bigger than the old pipe buffer\n");
+     d6e:	50                   	push   %eax
+     d6f:	50                   	push   %eax
+     d70:	68 e8 65 00 00       	push   $0x65e8
+     d75:	6a 01                	push   $0x1
+     d77:	e8 44 3f 00 00       	call   4cc0 <printf>
+    exit();
+     d7c:	e8 b2 3d 00 00       	call   4b33 <exit>
+     d81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8f:	90                   	nop
+
+00000d90 <splicetest>:
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	57                   	push   %edi
+     d94:	56                   	push   %esi
+     d95:	53                   	push   %ebx
+     d96:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "splice test\n");
+     d99:	68 d3 53 00 00       	push   $0x53d3
+     d9e:	6a 01                	push   $0x1
+     da0:	e8 1b 3f 00 00       	call   4cc0 <printf>
+  unlink("splice0");
+     da5:	c7 04 24 e0 53 00 00 	movl   $0x53e0,(%esp)
+     dac:	e8 d2 3d 00 00       	call   4b83 <unlink>
+  unlink("splice1");
+     db1:	c7 04 24 e8 53 00 00 	movl   $0x53e8,(%esp)
+     db8:	e8 c6 3d 00 00       	call   4b83 <unlink>
+  fd = open("splice0", O_CREATE|O_RDWR);
+     dbd:	5e                   	pop    %esi
+     dbe:	5f                   	pop    %edi
+     dbf:	68 02 02 00 00       	push   $0x202
+     dc4:	68 e0 53 00 00       	push   $0x53e0
+     dc9:	e8 a5 3d 00 00       	call   4b73 <open>
+     dce:	83 c4 10             	add    $0x10,%esp
+     dd1:	31 d2                	xor    %edx,%edx
+     dd3:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < sizeof(buf); i++)
+     dd5:	31 c0                	xor    %eax,%eax
+     dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dde:	66 90                	xchg   %ax,%ax
+    buf[i] = i * 7;
+     de0:	88 90 80 a0 00 00    	mov    %dl,0xa080(%eax)
+  for(i = 0; i < sizeof(buf); i++)
+     de6:	83 c0 01             	add    $0x1,%eax
+     de9:	83 c2 07             	add    $0x7,%edx
+     dec:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     df1:	75 ed                	jne    de0 <splicetest+0x50>
+     df3:	be 03 00 00 00       	mov    $0x3,%esi
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     df8:	83 ec 04             	sub    $0x4,%esp
+     dfb:	68 00 20 00 00       	push   $0x2000
+     e00:	68 80 a0 00 00       	push   $0xa080
+     e05:	53                   	push   %ebx
+     e06:	e8 48 3d 00 00       	call   4b53 <write>
+     e0b:	83 c4 10             	add    $0x10,%esp
+     e0e:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     e13:	0f 85 6b 01 00 00    	jne    f84 <splicetest+0x1f4>
+  for(i = 0; i < 3; i++){
+     e19:	83 ee 01             	sub    $0x1,%esi
+     e1c:	75 da                	jne    df8 <splicetest+0x68>
+  close(fd);
+     e1e:	83 ec 0c             	sub    $0xc,%esp
+     e21:	53                   	push   %ebx
+     e22:	e8 34 3d 00 00       	call   4b5b <close>
+  if(pipe(fds) != 0){
+     e27:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     e2a:	89 04 24             	mov    %eax,(%esp)
+     e2d:	e8 11 3d 00 00       	call   4b43 <pipe>
+     e32:	83 c4 10             	add    $0x10,%esp
+     e35:	85 c0                	test   %eax,%eax
+     e37:	0f 85 d1 01 00 00    	jne    100e <splicetest+0x27e>
+  pid = fork();
+     e3d:	e8 e9 3c 00 00       	call   4b2b <fork>
+  if(pid < 0){
+     e42:	85 c0                	test   %eax,%eax
+     e44:	0f 88 b1 01 00 00    	js     ffb <splicetest+0x26b>
+  if(pid == 0){
+     e4a:	0f 84 6e 01 00 00    	je     fbe <splicetest+0x22e>
+  close(fds[1]);
+     e50:	83 ec 0c             	sub    $0xc,%esp
+     e53:	ff 75 e4             	push   -0x1c(%ebp)
+     e56:	e8 00 3d 00 00       	call   4b5b <close>
+  fd = open("splice1", O_CREATE|O_RDWR);
+     e5b:	5e                   	pop    %esi
+     e5c:	5f                   	pop    %edi
+     e5d:	68 02 02 00 00       	push   $0x202
+     e62:	68 e8 53 00 00       	push   $0x53e8
+  total = 0;
+     e67:	31 f6                	xor    %esi,%esi
+  fd = open("splice1", O_CREATE|O_RDWR);
+     e69:	e8 05 3d 00 00       	call   4b73 <open>
+  while((n = splice(fds[0], fd, 3000)) > 0)
+     e6e:	83 c4 10             	add    $0x10,%esp
+  fd = open("splice1", O_CREATE|O_RDWR);
+     e71:	89 c7                	mov    %eax,%edi
+  while((n = splice(fds[0], fd, 3000)) > 0)
+     e73:	eb 05                	jmp    e7a <splicetest+0xea>
+     e75:	8d 76 00             	lea    0x0(%esi),%esi
+    total += n;
+     e78:	01 de                	add    %ebx,%esi
+  while((n = splice(fds[0], fd, 3000)) > 0)
+     e7a:	83 ec 04             	sub    $0x4,%esp
+     e7d:	68 b8 0b 00 00       	push   $0xbb8
+     e82:	57                   	push   %edi
+     e83:	ff 75 e0             	push   -0x20(%ebp)
+     e86:	e8 88 3d 00 00       	call   4c13 <splice>
+     e8b:	83 c4 10             	add    $0x10,%esp
+     e8e:	89 c3                	mov    %eax,%ebx
+     e90:	85 c0                	test   %eax,%eax
+     e92:	7f e4                	jg     e78 <splicetest+0xe8>
+  close(fds[0]);
+     e94:	83 ec 0c             	sub    $0xc,%esp
+     e97:	ff 75 e0             	push   -0x20(%ebp)
+     e9a:	e8 bc 3c 00 00       	call   4b5b <close>
+  close(fd);
+     e9f:	89 3c 24             	mov    %edi,(%esp)
+     ea2:	e8 b4 3c 00 00       	call   4b5b <close>
+  wait();
+     ea7:	e8 8f 3c 00 00       	call   4b3b <wait>
+  if(n < 0 || total != 3*sizeof(buf)){
+     eac:	83 c4 10             	add    $0x10,%esp
+     eaf:	85 db                	test   %ebx,%ebx
+     eb1:	0f 88 f4 00 00 00    	js     fab <splicetest+0x21b>
+     eb7:	81 fe 00 60 00 00    	cmp    $0x6000,%esi
+     ebd:	0f 85 e8 00 00 00    	jne    fab <splicetest+0x21b>
+  if(splice(0, 1, 1) >= 0){
+     ec3:	83 ec 04             	sub    $0x4,%esp
+     ec6:	6a 01                	push   $0x1
+     ec8:	6a 01                	push   $0x1
+     eca:	6a 00                	push   $0x0
+     ecc:	e8 42 3d 00 00       	call   4c13 <splice>
+     ed1:	83 c4 10             	add    $0x10,%esp
+     ed4:	85 c0                	test   %eax,%eax
+     ed6:	0f 89 bc 00 00 00    	jns    f98 <splicetest+0x208>
+  fd = open("splice1", O_RDONLY);
+     edc:	83 ec 08             	sub    $0x8,%esp
+  for(total = 0; (n = read(fd, buf, sizeof(buf))) > 0; total += n){
+     edf:	31 f6                	xor    %esi,%esi
+  fd = open("splice1", O_RDONLY);
+     ee1:	6a 00                	push   $0x0
+     ee3:	68 e8 53 00 00       	push   $0x53e8
+     ee8:	e8 86 3c 00 00       	call   4b73 <open>
+  for(total = 0; (n = read(fd, buf, sizeof(buf))) > 0; total += n){
+     eed:	83 c4 10             	add    $0x10,%esp
+  fd = open("splice1", O_RDONLY);
+     ef0:	89 c3                	mov    %eax,%ebx
+  for(total = 0; (n = read(fd, buf, sizeof(buf))) > 0; total += n){
+     ef2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     ef8:	83 ec 04             	sub    $0x4,%esp
+     efb:	68 00 20 00 00       	push   $0x2000
+     f00:	68 80 a0 00 00       	push   $0xa080
+     f05:	53                   	push   %ebx
+     f06:	e8 40 3c 00 00       	call   4b4b <read>
+     f0b:	83 c4 10             	add    $0x10,%esp
+     f0e:	85 c0                	test   %eax,%eax
+     f10:	7e 24                	jle    f36 <splicetest+0x1a6>
+     f12:	89 f2                	mov    %esi,%edx
+     f14:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+     f1b:	29 d1                	sub    %edx,%ecx
+    for(i = 0; i < n; i++){
+     f1d:	31 d2                	xor    %edx,%edx
+     f1f:	90                   	nop
+      if(buf[i] != (char)((total + i) % sizeof(buf) * 7)){
+     f20:	38 8a 80 a0 00 00    	cmp    %cl,0xa080(%edx)
+     f26:	75 48                	jne    f70 <splicetest+0x1e0>
+    for(i = 0; i < n; i++){
+     f28:	83 c2 01             	add    $0x1,%edx
+     f2b:	83 c1 07             	add    $0x7,%ecx
+     f2e:	39 d0                	cmp    %edx,%eax
+     f30:	75 ee                	jne    f20 <splicetest+0x190>
+  for(total = 0; (n = read(fd, buf, sizeof(buf))) > 0; total += n){
+     f32:	01 c6                	add    %eax,%esi
+     f34:	eb c2                	jmp    ef8 <splicetest+0x168>
+  close(fd);
+     f36:	83 ec 0c             	sub    $0xc,%esp
+     f39:	53                   	push   %ebx
+     f3a:	e8 1c 3c 00 00       	call   4b5b <close>
+  unlink("splice0");
+     f3f:	c7 04 24 e0 53 00 00 	movl   $0x53e0,(%esp)
+     f46:	e8 38 3c 00 00       	call   4b83 <unlink>
+  unlink("splice1");
+     f4b:	c7 04 24 e8 53 00 00 	movl   $0x53e8,(%esp)
+     f52:	e8 2c 3c 00 00       	call   4b83 <unlink>
+  printf(1, "splice ok\n");
+     f57:	58                   	pop    %eax
+     f58:	5a                   	pop    %edx
+     f59:	68 7b 54 00 00       	push   $0x547b
+     f5e:	6a 01                	push   $0x1
+     f60:	e8 5b 3d 00 00       	call   4cc0 <printf>
+}
+     f65:	83 c4 10             	add    $0x10,%esp
+     f68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f6b:	5b                   	pop    %ebx
+     f6c:	5e                   	pop    %esi
+     f6d:	5f                   	pop    %edi
+     f6e:	5d                   	pop    %ebp
+     f6f:	c3                   	ret
+        printf(1, "splice: wrong data\n");
+     f70:	83 ec 08             	sub    $0x8,%esp
+     f73:	68 67 54 00 00       	push   $0x5467
+     f78:	6a 01                	push   $0x1
+     f7a:	e8 41 3d 00 00       	call   4cc0 <printf>
+        exit();
+     f7f:	e8 af 3b 00 00       	call   4b33 <exit>
+      printf(1, "splice: write failed\n");
+     f84:	83 ec 08             	sub    $0x8,%esp
+     f87:	68 f0 53 00 00       	push   $0x53f0
+     f8c:	6a 01                	push   $0x1
+     f8e:	e8 2d 3d 00 00       	call   4cc0 <printf>
+      exit();
+     f93:	e8 9b 3b 00 00       	call   4b33 <exit>
+    printf(1, "splice: worked without a pipe\n");
+     f98:	51                   	push   %ecx
+     f99:	51                   	push   %ecx
+     f9a:	68 20 66 00 00       	push   $0x6620
+     f9f:	6a 01                	push   $0x1
+     fa1:	e8 1a 3d 00 00       	call   4cc0 <printf>
+    exit();
+     fa6:	e8 88 3b 00 00       	call   4b33 <exit>
+    printf(1, "splice: moved %d bytes\n", total);
+     fab:	53                   	push   %ebx
+     fac:	56                   	push   %esi
+     fad:	68 4f 54 00 00       	push   $0x544f
+     fb2:	6a 01                	push   $0x1
+     fb4:	e8 07 3d 00 00       	call   4cc0 <printf>
+    exit();
+     fb9:	e8 75 3b 00 00       	call   4b33 <exit>
+    close(fds[0]);
+     fbe:	83 ec 0c             	sub    $0xc,%esp
+     fc1:	ff 75 e0             	push   -0x20(%ebp)
+     fc4:	e8 92 3b 00 00       	call   4b5b <close>
+    fd = open("splice0", O_RDONLY);
+     fc9:	58                   	pop    %eax
+     fca:	5a                   	pop    %edx
+     fcb:	6a 00                	push   $0x0
+     fcd:	68 e0 53 00 00       	push   $0x53e0
+     fd2:	e8 9c 3b 00 00       	call   4b73 <open>
+    while((n = splice(fd, fds[1], 5000)) > 0)
+     fd7:	83 c4 10             	add    $0x10,%esp
+    fd = open("splice0", O_RDONLY);
+     fda:	89 c3                	mov    %eax,%ebx
+    while((n = splice(fd, fds[1], 5000)) > 0)
+     fdc:	83 ec 04             	sub    $0x4,%esp
+     fdf:	68 88 13 00 00       	push   $0x1388
+     fe4:	ff 75 e4             	push   -0x1c(%ebp)
+     fe7:	53                   	push   %ebx
+     fe8:	e8 26 3c 00 00       	call   4c13 <splice>
+     fed:	83 c4 10             	add    $0x10,%esp
+     ff0:	85 c0                	test   %eax,%eax
+     ff2:	7f e8                	jg     fdc <splicetest+0x24c>
+    if(n < 0)
+     ff4:	75 2b                	jne    1021 <splicetest+0x291>
+    exit();
+     ff6:	e8 38 3b 00 00       	call   4b33 <exit>
+    printf(1, "splice: fork failed\n");
+     ffb:	51                   	push   %ecx
+     ffc:	51                   	push   %ecx
+     ffd:	68 1d 54 00 00       	push   $0x541d
+    1002:	6a 01                	push   $0x1
+    1004:	e8 b7 3c 00 00       	call   4cc0 <printf>
+    exit();
+    1009:	e8 25 3b 00 00       	call   4b33 <exit>
+    printf(1, "splice: pipe() failed\n");
+    100e:	53                   	push   %ebx
+    100f:	53                   	push   %ebx
+    1010:	68 06 54 00 00       	push   $0x5406
+    1015:	6a 01                	push   $0x1
+    1017:	e8 a4 3c 00 00       	call   4cc0 <printf>
+    exit();
+    101c:	e8 12 3b 00 00       	call   4b33 <exit>
+      printf(1, "splice: file to pipe failed\n");
+    1021:	50                   	push   %eax
+    1022:	50                   	push   %eax
+    1023:	68 32 54 00 00       	push   $0x5432
+    1028:	6a 01                	push   $0x1
+    102a:	e8 91 3c 00 00       	call   4cc0 <printf>
+    102f:	83 c4 10             	add    $0x10,%esp
+    1032:	eb c2                	jmp    ff6 <splicetest+0x266>
+    1034:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    103f:	90                   	nop
+
+00001040 <fdtest>:
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	53                   	push   %ebx
+  for(n = 0; (fd = dup(1)) >= 0; n++){
+    1044:	bb 03 00 00 00       	mov    $0x3,%ebx
+{
+    1049:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fd test\n");
+    104c:	68 77 55 00 00       	push   $0x5577
+    1051:	6a 01                	push   $0x1
+    1053:	e8 68 3c 00 00       	call   4cc0 <printf>
+  for(n = 0; (fd = dup(1)) >= 0; n++){
+    1058:	83 c4 10             	add    $0x10,%esp
+    105b:	eb 0e                	jmp    106b <fdtest+0x2b>
+    105d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(fd != 3 + n){
+    1060:	39 c3                	cmp    %eax,%ebx
+    1062:	0f 85 a3 00 00 00    	jne    110b <fdtest+0xcb>
+  for(n = 0; (fd = dup(1)) >= 0; n++){
+    1068:	83 c3 01             	add    $0x1,%ebx
+    106b:	83 ec 0c             	sub    $0xc,%esp
+    106e:	6a 01                	push   $0x1
+    1070:	e8 36 3b 00 00       	call   4bab <dup>
+    1075:	83 c4 10             	add    $0x10,%esp
+    1078:	85 c0                	test   %eax,%eax
+    107a:	79 e4                	jns    1060 <fdtest+0x20>
+  if(n != NOFILE - 3){
+    107c:	83 fb 40             	cmp    $0x40,%ebx
+    107f:	0f 85 ad 00 00 00    	jne    1132 <fdtest+0xf2>
+  close(40);
+    1085:	83 ec 0c             	sub    $0xc,%esp
+    1088:	6a 28                	push   $0x28
+    108a:	e8 cc 3a 00 00       	call   4b5b <close>
+  close(7);
+    108f:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+    1096:	e8 c0 3a 00 00       	call   4b5b <close>
+  if(dup(1) != 7 || dup(1) != 40 || dup(1) >= 0){
+    109b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    10a2:	e8 04 3b 00 00       	call   4bab <dup>
+    10a7:	83 c4 10             	add    $0x10,%esp
+    10aa:	83 f8 07             	cmp    $0x7,%eax
+    10ad:	75 6f                	jne    111e <fdtest+0xde>
+    10af:	83 ec 0c             	sub    $0xc,%esp
+    10b2:	6a 01                	push   $0x1
+    10b4:	e8 f2 3a 00 00       	call   4bab <dup>
+    10b9:	83 c4 10             	add    $0x10,%esp
+    10bc:	83 f8 28             	cmp    $0x28,%eax
+    10bf:	75 5d                	jne    111e <fdtest+0xde>
+    10c1:	83 ec 0c             	sub    $0xc,%esp
+    10c4:	6a 01                	push   $0x1
+    10c6:	e8 e0 3a 00 00       	call   4bab <dup>
+    10cb:	83 c4 10             	add    $0x10,%esp
+    10ce:	85 c0                	test   %eax,%eax
+    10d0:	79 4c                	jns    111e <fdtest+0xde>
+  for(fd = 3; fd < NOFILE; fd++)
+    10d2:	bb 03 00 00 00       	mov    $0x3,%ebx
+    10d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10de:	66 90                	xchg   %ax,%ax
+    close(fd);
+    10e0:	83 ec 0c             	sub    $0xc,%esp
+    10e3:	53                   	push   %ebx
+  for(fd = 3; fd < NOFILE; fd++)
+    10e4:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+    10e7:	e8 6f 3a 00 00       	call   4b5b <close>
+  for(fd = 3; fd < NOFILE; fd++)
+    10ec:	83 c4 10             	add    $0x10,%esp
+    10ef:	83 fb 40             	cmp    $0x40,%ebx
+    10f2:	75 ec                	jne    10e0 <fdtest+0xa0>
+  printf(1, "fd ok\n");
+    10f4:	83 ec 08             	sub    $0x8,%esp
+    10f7:	68 8f 55 00 00       	push   $0x558f
+    10fc:	6a 01                	push   $0x1
+    10fe:	e8 bd 3b 00 00       	call   4cc0 <printf>
+}
+    1103:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1106:	83 c4 10             	add    $0x10,%esp
+    1109:	c9                   	leave
+    110a:	c3                   	ret
+      printf(1, "fdtest: dup gave %d, not %d\n", fd, 3 + n);
+    110b:	53                   	push   %ebx
+    110c:	50                   	push   %eax
+    110d:	68 86 54 00 00       	push   $0x5486
+    1112:	6a 01                	push   $0x1
+    1114:	e8 a7 3b 00 00       	call   4cc0 <printf>
+      exit();
+    1119:	e8 15 3a 00 00       	call   4b33 <exit>
+    printf(1, "fdtest: wrong fd reused\n");
+    111e:	83 ec 08             	sub    $0x8,%esp
+    1121:	68 c0 54 00 00       	push   $0x54c0
+    1126:	6a 01                	push   $0x1
+    1128:	e8 93 3b 00 00       	call   4cc0 <printf>
+    exit();
+    112d:	e8 01 3a 00 00       	call   4b33 <exit>
+    printf(1, "fdtest: only %d descriptors\n", n + 3);
+    1132:	50                   	push   %eax
+    1133:	53                   	push   %ebx
+    1134:	68 a3 54 00 00       	push   $0x54a3
+    1139:	6a 01                	push   $0x1
+    113b:	e8 80 3b 00 00       	call   4cc0 <printf>
+    exit();
+    1140:	e8 ee 39 00 00       	call   4b33 <exit>
+    1145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001150 <preempt>:
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	57                   	push   %edi
+    1154:	56                   	push   %esi
+    1155:	53                   	push   %ebx
+    1156:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+    1159:	68 d9 54 00 00       	push   $0x54d9
+    115e:	6a 01                	push   $0x1
+    1160:	e8 5b 3b 00 00       	call   4cc0 <printf>
+  pid1 = fork();
+    1165:	e8 c1 39 00 00       	call   4b2b <fork>
+  if(pid1 == 0)
+    116a:	83 c4 10             	add    $0x10,%esp
+    116d:	85 c0                	test   %eax,%eax
+    116f:	75 07                	jne    1178 <preempt+0x28>
+    for(;;)
+    1171:	eb fe                	jmp    1171 <preempt+0x21>
+    1173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1177:	90                   	nop
+    1178:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+    117a:	e8 ac 39 00 00       	call   4b2b <fork>
+    117f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+    1181:	85 c0                	test   %eax,%eax
+    1183:	75 0b                	jne    1190 <preempt+0x40>
+    for(;;)
+    1185:	eb fe                	jmp    1185 <preempt+0x35>
+    1187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+    1190:	83 ec 0c             	sub    $0xc,%esp
+    1193:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1196:	50                   	push   %eax
+    1197:	e8 a7 39 00 00       	call   4b43 <pipe>
+  pid3 = fork();
+    119c:	e8 8a 39 00 00       	call   4b2b <fork>
+  if(pid3 == 0){
+    11a1:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    11a4:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+    11a6:	85 c0                	test   %eax,%eax
+    11a8:	75 3e                	jne    11e8 <preempt+0x98>
+    close(pfds[0]);
+    11aa:	83 ec 0c             	sub    $0xc,%esp
+    11ad:	ff 75 e0             	push   -0x20(%ebp)
+    11b0:	e8 a6 39 00 00       	call   4b5b <close>
+    if(write(pfds[1], "x", 1) != 1)
+    11b5:	83 c4 0c             	add    $0xc,%esp
+    11b8:	6a 01                	push   $0x1
+    11ba:	68 fe 5c 00 00       	push   $0x5cfe
+    11bf:	ff 75 e4             	push   -0x1c(%ebp)
+    11c2:	e8 8c 39 00 00       	call   4b53 <write>
+    11c7:	83 c4 10             	add    $0x10,%esp
+    11ca:	83 f8 01             	cmp    $0x1,%eax
+    11cd:	0f 85 b8 00 00 00    	jne    128b <preempt+0x13b>
+    close(pfds[1]);
+    11d3:	83 ec 0c             	sub    $0xc,%esp
+    11d6:	ff 75 e4             	push   -0x1c(%ebp)
+    11d9:	e8 7d 39 00 00       	call   4b5b <close>
+    11de:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    11e1:	eb fe                	jmp    11e1 <preempt+0x91>
+    11e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11e7:	90                   	nop
+  close(pfds[1]);
+    11e8:	83 ec 0c             	sub    $0xc,%esp
+    11eb:	ff 75 e4             	push   -0x1c(%ebp)
+    11ee:	e8 68 39 00 00       	call   4b5b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    11f3:	83 c4 0c             	add    $0xc,%esp
+    11f6:	68 00 20 00 00       	push   $0x2000
+    11fb:	68 80 a0 00 00       	push   $0xa080
+    1200:	ff 75 e0             	push   -0x20(%ebp)
+    1203:	e8 43 39 00 00       	call   4b4b <read>
+    1208:	83 c4 10             	add    $0x10,%esp
+    120b:	83 f8 01             	cmp    $0x1,%eax
+    120e:	75 67                	jne    1277 <preempt+0x127>
+  close(pfds[0]);
+    1210:	83 ec 0c             	sub    $0xc,%esp
+    1213:	ff 75 e0             	push   -0x20(%ebp)
+    1216:	e8 40 39 00 00       	call   4b5b <close>
+  printf(1, "kill... ");
+    121b:	58                   	pop    %eax
+    121c:	5a                   	pop    %edx
+    121d:	68 0a 55 00 00       	push   $0x550a
+    1222:	6a 01                	push   $0x1
+    1224:	e8 97 3a 00 00       	call   4cc0 <printf>
+  kill(pid1);
+    1229:	89 1c 24             	mov    %ebx,(%esp)
+    122c:	e8 32 39 00 00       	call   4b63 <kill>
+  kill(pid2);
+    1231:	89 34 24             	mov    %esi,(%esp)
+    1234:	e8 2a 39 00 00       	call   4b63 <kill>
+  kill(pid3);
+    1239:	89 3c 24             	mov    %edi,(%esp)
+    123c:	e8 22 39 00 00       	call   4b63 <kill>
+  printf(1, "wait... ");
+    1241:	59                   	pop    %ecx
+    1242:	5b                   	pop    %ebx
+    1243:	68 13 55 00 00       	push   $0x5513
+    1248:	6a 01                	push   $0x1
+    124a:	e8 71 3a 00 00       	call   4cc0 <printf>
+  wait();
+    124f:	e8 e7 38 00 00       	call   4b3b <wait>
+  wait();
+    1254:	e8 e2 38 00 00       	call   4b3b <wait>
+  wait();
+    1259:	e8 dd 38 00 00       	call   4b3b <wait>
+  printf(1, "preempt ok\n");
+    125e:	5e                   	pop    %esi
+    125f:	5f                   	pop    %edi
+    1260:	68 1c 55 00 00       	push   $0x551c
+    1265:	6a 01                	push   $0x1
+    1267:	e8 54 3a 00 00       	call   4cc0 <printf>
+    126c:	83 c4 10             	add    $0x10,%esp
+}
+    126f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1272:	5b                   	pop    %ebx
+    1273:	5e                   	pop    %esi
+    1274:	5f                   	pop    %edi
+    1275:	5d                   	pop    %ebp
+    1276:	c3                   	ret
+    printf(1, "preempt read error");
+    1277:	83 ec 08             	sub    $0x8,%esp
+    127a:	68 f7 54 00 00       	push   $0x54f7
+    127f:	6a 01                	push   $0x1
+    1281:	e8 3a 3a 00 00       	call   4cc0 <printf>
+    1286:	83 c4 10             	add    $0x10,%esp
+    1289:	eb e4                	jmp    126f <preempt+0x11f>
+      printf(1, "preempt write error");
+    128b:	83 ec 08             	sub    $0x8,%esp
+    128e:	68 e3 54 00 00       	push   $0x54e3
+    1293:	6a 01                	push   $0x1
+    1295:	e8 26 3a 00 00       	call   4cc0 <printf>
+    129a:	83 c4 10             	add    $0x10,%esp
+    129d:	e9 31 ff ff ff       	jmp    11d3 <preempt+0x83>
+    12a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012b0 <exitwait>:
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	56                   	push   %esi
+    12b4:	be 64 00 00 00       	mov    $0x64,%esi
+    12b9:	53                   	push   %ebx
+    12ba:	eb 14                	jmp    12d0 <exitwait+0x20>
+    12bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+    12c0:	74 68                	je     132a <exitwait+0x7a>
+      if(wait() != pid){
+    12c2:	e8 74 38 00 00       	call   4b3b <wait>
+    12c7:	39 d8                	cmp    %ebx,%eax
+    12c9:	75 2d                	jne    12f8 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+    12cb:	83 ee 01             	sub    $0x1,%esi
+    12ce:	74 41                	je     1311 <exitwait+0x61>
+    pid = fork();
+    12d0:	e8 56 38 00 00       	call   4b2b <fork>
+    12d5:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    12d7:	85 c0                	test   %eax,%eax
+    12d9:	79 e5                	jns    12c0 <exitwait+0x10>
+      printf(1, "fork failed\n");
+    12db:	83 ec 08             	sub    $0x8,%esp
+    12de:	68 25 54 00 00       	push   $0x5425
+    12e3:	6a 01                	push   $0x1
+    12e5:	e8 d6 39 00 00       	call   4cc0 <printf>
+      return;
+    12ea:	83 c4 10             	add    $0x10,%esp
+}
+    12ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12f0:	5b                   	pop    %ebx
+    12f1:	5e                   	pop    %esi
+    12f2:	5d                   	pop    %ebp
+    12f3:	c3                   	ret
+    12f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+    12f8:	83 ec 08             	sub    $0x8,%esp
+    12fb:	68 28 55 00 00       	push   $0x5528
+    1300:	6a 01                	push   $0x1
+    1302:	e8 b9 39 00 00       	call   4cc0 <printf>
+        return;
+    1307:	83 c4 10             	add    $0x10,%esp
+}
+    130a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    130d:	5b                   	pop    %ebx
+    130e:	5e                   	pop    %esi
+    130f:	5d                   	pop    %ebp
+    1310:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    1311:	83 ec 08             	sub    $0x8,%esp
+    1314:	68 38 55 00 00       	push   $0x5538
+    1319:	6a 01                	push   $0x1
+    131b:	e8 a0 39 00 00       	call   4cc0 <printf>
+    1320:	83 c4 10             	add    $0x10,%esp
+}
+    1323:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1326:	5b                   	pop    %ebx
+    1327:	5e                   	pop    %esi
+    1328:	5d                   	pop    %ebp
+    1329:	c3                   	ret
+      exit();
+    132a:	e8 04 38 00 00       	call   4b33 <exit>
+    132f:	90                   	nop
+
+00001330 <mem>:
+{
+    1330:	55                   	push   %ebp
+    1331:	89 e5                	mov    %esp,%ebp
+    1333:	56                   	push   %esi
+    1334:	31 f6                	xor    %esi,%esi
+    1336:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    1337:	83 ec 08             	sub    $0x8,%esp
+    133a:	68 45 55 00 00       	push   $0x5545
+    133f:	6a 01                	push   $0x1
+    1341:	e8 7a 39 00 00       	call   4cc0 <printf>
+  ppid = getpid();
+    1346:	e8 68 38 00 00       	call   4bb3 <getpid>
+    134b:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    134d:	e8 d9 37 00 00       	call   4b2b <fork>
+    1352:	83 c4 10             	add    $0x10,%esp
+    1355:	85 c0                	test   %eax,%eax
+    1357:	74 0b                	je     1364 <mem+0x34>
+    1359:	e9 8a 00 00 00       	jmp    13e8 <mem+0xb8>
+    135e:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    1360:	89 30                	mov    %esi,(%eax)
+    1362:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    1364:	83 ec 0c             	sub    $0xc,%esp
+    1367:	68 11 27 00 00       	push   $0x2711
+    136c:	e8 8f 3b 00 00       	call   4f00 <malloc>
+    1371:	83 c4 10             	add    $0x10,%esp
+    1374:	85 c0                	test   %eax,%eax
+    1376:	75 e8                	jne    1360 <mem+0x30>
+    while(m1){
+    1378:	85 f6                	test   %esi,%esi
+    137a:	74 18                	je     1394 <mem+0x64>
+    137c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    1380:	89 f0                	mov    %esi,%eax
+      free(m1);
+    1382:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    1385:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    1387:	50                   	push   %eax
+    1388:	e8 e3 3a 00 00       	call   4e70 <free>
+    while(m1){
+    138d:	83 c4 10             	add    $0x10,%esp
+    1390:	85 f6                	test   %esi,%esi
+    1392:	75 ec                	jne    1380 <mem+0x50>
+    m1 = malloc(1024*20);
+    1394:	83 ec 0c             	sub    $0xc,%esp
+    1397:	68 00 50 00 00       	push   $0x5000
+    139c:	e8 5f 3b 00 00       	call   4f00 <malloc>
+    if(m1 == 0){
+    13a1:	83 c4 10             	add    $0x10,%esp
+    13a4:	85 c0                	test   %eax,%eax
+    13a6:	74 20                	je     13c8 <mem+0x98>
+    free(m1);
+    13a8:	83 ec 0c             	sub    $0xc,%esp
+    13ab:	50                   	push   %eax
+    13ac:	e8 bf 3a 00 00       	call   4e70 <free>
+    printf(1, "mem ok\n");
+    13b1:	58                   	pop    %eax
+    13b2:	5a                   	pop    %edx
+    13b3:	68 69 55 00 00       	push   $0x5569
+    13b8:	6a 01                	push   $0x1
+    13ba:	e8 01 39 00 00       	call   4cc0 <printf>
+    exit();
+    13bf:	e8 6f 37 00 00       	call   4b33 <exit>
+    13c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    13c8:	83 ec 08             	sub    $0x8,%esp
+    13cb:	68 4f 55 00 00       	push   $0x554f
+    13d0:	6a 01                	push   $0x1
+    13d2:	e8 e9 38 00 00       	call   4cc0 <printf>
+      kill(ppid);
+    13d7:	89 1c 24             	mov    %ebx,(%esp)
+    13da:	e8 84 37 00 00       	call   4b63 <kill>
+      exit();
+    13df:	e8 4f 37 00 00       	call   4b33 <exit>
+    13e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    13e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13eb:	5b                   	pop    %ebx
+    13ec:	5e                   	pop    %esi
+    13ed:	5d                   	pop    %ebp
+    wait();
+    13ee:	e9 48 37 00 00       	jmp    4b3b <wait>
+    13f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001400 <sharedfd>:
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	57                   	push   %edi
+    1404:	56                   	push   %esi
+    1405:	53                   	push   %ebx
+    1406:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1409:	68 71 55 00 00       	push   $0x5571
+    140e:	6a 01                	push   $0x1
+    1410:	e8 ab 38 00 00       	call   4cc0 <printf>
+  unlink("sharedfd");
+    1415:	c7 04 24 80 55 00 00 	movl   $0x5580,(%esp)
+    141c:	e8 62 37 00 00       	call   4b83 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1421:	5b                   	pop    %ebx
+    1422:	5e                   	pop    %esi
+    1423:	68 02 02 00 00       	push   $0x202
+    1428:	68 80 55 00 00       	push   $0x5580
+    142d:	e8 41 37 00 00       	call   4b73 <open>
+  if(fd < 0){
+    1432:	83 c4 10             	add    $0x10,%esp
+    1435:	85 c0                	test   %eax,%eax
+    1437:	0f 88 2a 01 00 00    	js     1567 <sharedfd+0x167>
+    143d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    143f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    1442:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    1447:	e8 df 36 00 00       	call   4b2b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    144c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    144f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1452:	19 c0                	sbb    %eax,%eax
+    1454:	83 ec 04             	sub    $0x4,%esp
+    1457:	83 e0 f3             	and    $0xfffffff3,%eax
+    145a:	6a 0a                	push   $0xa
+    145c:	83 c0 70             	add    $0x70,%eax
+    145f:	50                   	push   %eax
+    1460:	56                   	push   %esi
+    1461:	e8 4a 35 00 00       	call   49b0 <memset>
+    1466:	83 c4 10             	add    $0x10,%esp
+    1469:	eb 0a                	jmp    1475 <sharedfd+0x75>
+    146b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    146f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    1470:	83 eb 01             	sub    $0x1,%ebx
+    1473:	74 26                	je     149b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1475:	83 ec 04             	sub    $0x4,%esp
+    1478:	6a 0a                	push   $0xa
+    147a:	56                   	push   %esi
+    147b:	57                   	push   %edi
+    147c:	e8 d2 36 00 00       	call   4b53 <write>
+    1481:	83 c4 10             	add    $0x10,%esp
+    1484:	83 f8 0a             	cmp    $0xa,%eax
+    1487:	74 e7                	je     1470 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1489:	83 ec 08             	sub    $0x8,%esp
+    148c:	68 6c 66 00 00       	push   $0x666c
+    1491:	6a 01                	push   $0x1
+    1493:	e8 28 38 00 00       	call   4cc0 <printf>
+      break;
+    1498:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    149b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    149e:	85 c9                	test   %ecx,%ecx
+    14a0:	0f 84 f5 00 00 00    	je     159b <sharedfd+0x19b>
+    wait();
+    14a6:	e8 90 36 00 00       	call   4b3b <wait>
+  close(fd);
+    14ab:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    14ae:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    14b0:	57                   	push   %edi
+    14b1:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    14b4:	e8 a2 36 00 00       	call   4b5b <close>
+  fd = open("sharedfd", 0);
+    14b9:	58                   	pop    %eax
+    14ba:	5a                   	pop    %edx
+    14bb:	6a 00                	push   $0x0
+    14bd:	68 80 55 00 00       	push   $0x5580
+    14c2:	e8 ac 36 00 00       	call   4b73 <open>
+  if(fd < 0){
+    14c7:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    14ca:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    14cc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    14cf:	85 c0                	test   %eax,%eax
+    14d1:	0f 88 aa 00 00 00    	js     1581 <sharedfd+0x181>
+    14d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14de:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    14e0:	83 ec 04             	sub    $0x4,%esp
+    14e3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    14e6:	6a 0a                	push   $0xa
+    14e8:	56                   	push   %esi
+    14e9:	ff 75 d0             	push   -0x30(%ebp)
+    14ec:	e8 5a 36 00 00       	call   4b4b <read>
+    14f1:	83 c4 10             	add    $0x10,%esp
+    14f4:	85 c0                	test   %eax,%eax
+    14f6:	7e 28                	jle    1520 <sharedfd+0x120>
+    14f8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    14fb:	89 f0                	mov    %esi,%eax
+    14fd:	eb 13                	jmp    1512 <sharedfd+0x112>
+    14ff:	90                   	nop
+        np++;
+    1500:	80 f9 70             	cmp    $0x70,%cl
+    1503:	0f 94 c1             	sete   %cl
+    1506:	0f b6 c9             	movzbl %cl,%ecx
+    1509:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    150b:	83 c0 01             	add    $0x1,%eax
+    150e:	39 f8                	cmp    %edi,%eax
+    1510:	74 ce                	je     14e0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1512:	0f b6 08             	movzbl (%eax),%ecx
+    1515:	80 f9 63             	cmp    $0x63,%cl
+    1518:	75 e6                	jne    1500 <sharedfd+0x100>
+        nc++;
+    151a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    151d:	eb ec                	jmp    150b <sharedfd+0x10b>
+    151f:	90                   	nop
+  close(fd);
+    1520:	83 ec 0c             	sub    $0xc,%esp
+    1523:	ff 75 d0             	push   -0x30(%ebp)
+    1526:	e8 30 36 00 00       	call   4b5b <close>
+  unlink("sharedfd");
+    152b:	c7 04 24 80 55 00 00 	movl   $0x5580,(%esp)
+    1532:	e8 4c 36 00 00       	call   4b83 <unlink>
+  if(nc == 10000 && np == 10000){
+    1537:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    153a:	83 c4 10             	add    $0x10,%esp
+    153d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1543:	75 5b                	jne    15a0 <sharedfd+0x1a0>
+    1545:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    154b:	75 53                	jne    15a0 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    154d:	83 ec 08             	sub    $0x8,%esp
+    1550:	68 89 55 00 00       	push   $0x5589
+    1555:	6a 01                	push   $0x1
+    1557:	e8 64 37 00 00       	call   4cc0 <printf>
+    155c:	83 c4 10             	add    $0x10,%esp
+}
+    155f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1562:	5b                   	pop    %ebx
+    1563:	5e                   	pop    %esi
+    1564:	5f                   	pop    %edi
+    1565:	5d                   	pop    %ebp
+    1566:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1567:	83 ec 08             	sub    $0x8,%esp
+    156a:	68 40 66 00 00       	push   $0x6640
+    156f:	6a 01                	push   $0x1
+    1571:	e8 4a 37 00 00       	call   4cc0 <printf>
+    return;
+    1576:	83 c4 10             	add    $0x10,%esp
+}
+    1579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    157c:	5b                   	pop    %ebx
+    157d:	5e                   	pop    %esi
+    157e:	5f                   	pop    %edi
+    157f:	5d                   	pop    %ebp
+    1580:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1581:	83 ec 08             	sub    $0x8,%esp
+    1584:	68 8c 66 00 00       	push   $0x668c
+    1589:	6a 01                	push   $0x1
+    158b:	e8 30 37 00 00       	call   4cc0 <printf>
+    return;
+    1590:	83 c4 10             	add    $0x10,%esp
+}
+    1593:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1596:	5b                   	pop    %ebx
+    1597:	5e                   	pop    %esi
+    1598:	5f                   	pop    %edi
+    1599:	5d                   	pop    %ebp
+    159a:	c3                   	ret
+    exit();
+    159b:	e8 93 35 00 00       	call   4b33 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    15a0:	53                   	push   %ebx
+    15a1:	52                   	push   %edx
+    15a2:	68 96 55 00 00       	push   $0x5596
+    15a7:	6a 01                	push   $0x1
+    15a9:	e8 12 37 00 00       	call   4cc0 <printf>
+    exit();
+    15ae:	e8 80 35 00 00       	call   4b33 <exit>
+    15b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000015c0 <fourfiles>:
+{
+    15c0:	55                   	push   %ebp
+    15c1:	89 e5                	mov    %esp,%ebp
+    15c3:	57                   	push   %edi
+    15c4:	56                   	push   %esi
+    15c5:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    15c6:	31 db                	xor    %ebx,%ebx
+{
+    15c8:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    15cb:	c7 45 d8 ab 55 00 00 	movl   $0x55ab,-0x28(%ebp)
+    15d2:	c7 45 dc f4 56 00 00 	movl   $0x56f4,-0x24(%ebp)
+    15d9:	c7 45 e0 f8 56 00 00 	movl   $0x56f8,-0x20(%ebp)
+    15e0:	c7 45 e4 ae 55 00 00 	movl   $0x55ae,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    15e7:	68 b1 55 00 00       	push   $0x55b1
+    15ec:	6a 01                	push   $0x1
+    15ee:	e8 cd 36 00 00       	call   4cc0 <printf>
+    15f3:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    15f6:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    15fa:	83 ec 0c             	sub    $0xc,%esp
+    15fd:	56                   	push   %esi
+    15fe:	e8 80 35 00 00       	call   4b83 <unlink>
+    pid = fork();
+    1603:	e8 23 35 00 00       	call   4b2b <fork>
+    if(pid < 0){
+    1608:	83 c4 10             	add    $0x10,%esp
+    160b:	85 c0                	test   %eax,%eax
+    160d:	0f 88 65 01 00 00    	js     1778 <fourfiles+0x1b8>
+    if(pid == 0){
+    1613:	0f 84 eb 00 00 00    	je     1704 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1619:	83 c3 01             	add    $0x1,%ebx
+    161c:	83 fb 04             	cmp    $0x4,%ebx
+    161f:	75 d5                	jne    15f6 <fourfiles+0x36>
+    wait();
+    1621:	e8 15 35 00 00       	call   4b3b <wait>
+  for(i = 0; i < 2; i++){
+    1626:	31 f6                	xor    %esi,%esi
+    wait();
+    1628:	e8 0e 35 00 00       	call   4b3b <wait>
+    162d:	e8 09 35 00 00       	call   4b3b <wait>
+    1632:	e8 04 35 00 00       	call   4b3b <wait>
+    fname = names[i];
+    1637:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    163b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    163e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    1640:	6a 00                	push   $0x0
+    1642:	53                   	push   %ebx
+    1643:	e8 2b 35 00 00       	call   4b73 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1648:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    164b:	83 c4 10             	add    $0x10,%esp
+    164e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1658:	83 ec 04             	sub    $0x4,%esp
+    165b:	68 00 20 00 00       	push   $0x2000
+    1660:	68 80 a0 00 00       	push   $0xa080
+    1665:	ff 75 d4             	push   -0x2c(%ebp)
+    1668:	e8 de 34 00 00       	call   4b4b <read>
+    166d:	83 c4 10             	add    $0x10,%esp
+    1670:	89 c3                	mov    %eax,%ebx
+    1672:	85 c0                	test   %eax,%eax
+    1674:	7e 28                	jle    169e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1676:	31 c0                	xor    %eax,%eax
+    1678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    167f:	90                   	nop
+        if(buf[j] != '0'+i){
+    1680:	83 fe 01             	cmp    $0x1,%esi
+    1683:	0f be 88 80 a0 00 00 	movsbl 0xa080(%eax),%ecx
+    168a:	19 d2                	sbb    %edx,%edx
+    168c:	83 c2 31             	add    $0x31,%edx
+    168f:	39 d1                	cmp    %edx,%ecx
+    1691:	75 5d                	jne    16f0 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1693:	83 c0 01             	add    $0x1,%eax
+    1696:	39 c3                	cmp    %eax,%ebx
+    1698:	75 e6                	jne    1680 <fourfiles+0xc0>
+      total += n;
+    169a:	01 df                	add    %ebx,%edi
+    169c:	eb ba                	jmp    1658 <fourfiles+0x98>
+    close(fd);
+    169e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    16a1:	83 ec 0c             	sub    $0xc,%esp
+    16a4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    16a7:	51                   	push   %ecx
+    16a8:	e8 ae 34 00 00       	call   4b5b <close>
+    if(total != 12*500){
+    16ad:	83 c4 10             	add    $0x10,%esp
+    16b0:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    16b6:	0f 85 d0 00 00 00    	jne    178c <fourfiles+0x1cc>
+    unlink(fname);
+    16bc:	83 ec 0c             	sub    $0xc,%esp
+    16bf:	53                   	push   %ebx
+    16c0:	e8 be 34 00 00       	call   4b83 <unlink>
+  for(i = 0; i < 2; i++){
+    16c5:	83 c4 10             	add    $0x10,%esp
+    16c8:	85 f6                	test   %esi,%esi
+    16ca:	75 0a                	jne    16d6 <fourfiles+0x116>
+    16cc:	be 01 00 00 00       	mov    $0x1,%esi
+    16d1:	e9 61 ff ff ff       	jmp    1637 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    16d6:	83 ec 08             	sub    $0x8,%esp
+    16d9:	68 ef 55 00 00       	push   $0x55ef
+    16de:	6a 01                	push   $0x1
+    16e0:	e8 db 35 00 00       	call   4cc0 <printf>
+}
+    16e5:	83 c4 10             	add    $0x10,%esp
+    16e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16eb:	5b                   	pop    %ebx
+    16ec:	5e                   	pop    %esi
+    16ed:	5f                   	pop    %edi
+    16ee:	5d                   	pop    %ebp
+    16ef:	c3                   	ret
+          printf(1, "wrong char\n");
+    16f0:	83 ec 08             	sub    $0x8,%esp
+    16f3:	68 d2 55 00 00       	push   $0x55d2
+    16f8:	6a 01                	push   $0x1
+    16fa:	e8 c1 35 00 00       	call   4cc0 <printf>
+          exit();
+    16ff:	e8 2f 34 00 00       	call   4b33 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1704:	83 ec 08             	sub    $0x8,%esp
+    1707:	68 02 02 00 00       	push   $0x202
+    170c:	56                   	push   %esi
+    170d:	e8 61 34 00 00       	call   4b73 <open>
+      if(fd < 0){
+    1712:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1715:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1717:	85 c0                	test   %eax,%eax
+    1719:	78 45                	js     1760 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    171b:	83 ec 04             	sub    $0x4,%esp
+    171e:	83 c3 30             	add    $0x30,%ebx
+    1721:	68 00 02 00 00       	push   $0x200
+    1726:	53                   	push   %ebx
+    1727:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    172c:	68 80 a0 00 00       	push   $0xa080
+    1731:	e8 7a 32 00 00       	call   49b0 <memset>
+    1736:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1739:	83 ec 04             	sub    $0x4,%esp
+    173c:	68 f4 01 00 00       	push   $0x1f4
+    1741:	68 80 a0 00 00       	push   $0xa080
+    1746:	56                   	push   %esi
+    1747:	e8 07 34 00 00       	call   4b53 <write>
+    174c:	83 c4 10             	add    $0x10,%esp
+    174f:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    1754:	75 49                	jne    179f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    1756:	83 eb 01             	sub    $0x1,%ebx
+    1759:	75 de                	jne    1739 <fourfiles+0x179>
+      exit();
+    175b:	e8 d3 33 00 00       	call   4b33 <exit>
+        printf(1, "create failed\n");
+    1760:	51                   	push   %ecx
+    1761:	51                   	push   %ecx
+    1762:	68 a0 63 00 00       	push   $0x63a0
+    1767:	6a 01                	push   $0x1
+    1769:	e8 52 35 00 00       	call   4cc0 <printf>
+        exit();
+    176e:	e8 c0 33 00 00       	call   4b33 <exit>
+    1773:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1777:	90                   	nop
+      printf(1, "fork failed\n");
+    1778:	83 ec 08             	sub    $0x8,%esp
+    177b:	68 25 54 00 00       	push   $0x5425
+    1780:	6a 01                	push   $0x1
+    1782:	e8 39 35 00 00       	call   4cc0 <printf>
+      exit();
+    1787:	e8 a7 33 00 00       	call   4b33 <exit>
+      printf(1, "wrong length %d\n", total);
+    178c:	50                   	push   %eax
+    178d:	57                   	push   %edi
+    178e:	68 de 55 00 00       	push   $0x55de
+    1793:	6a 01                	push   $0x1
+    1795:	e8 26 35 00 00       	call   4cc0 <printf>
+      exit();
+    179a:	e8 94 33 00 00       	call   4b33 <exit>
+          printf(1, "write failed %d\n", n);
+    179f:	52                   	push   %edx
+    17a0:	50                   	push   %eax
+    17a1:	68 c1 55 00 00       	push   $0x55c1
+    17a6:	6a 01                	push   $0x1
+    17a8:	e8 13 35 00 00       	call   4cc0 <printf>
+          exit();
+    17ad:	e8 81 33 00 00       	call   4b33 <exit>
+    17b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000017c0 <createdelete>:
+{
+    17c0:	55                   	push   %ebp
+    17c1:	89 e5                	mov    %esp,%ebp
+    17c3:	57                   	push   %edi
+    17c4:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    17c5:	31 f6                	xor    %esi,%esi
+{
+    17c7:	53                   	push   %ebx
+    17c8:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    17cb:	68 fd 55 00 00       	push   $0x55fd
+    17d0:	6a 01                	push   $0x1
+    17d2:	e8 e9 34 00 00       	call   4cc0 <printf>
+    17d7:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    17da:	e8 4c 33 00 00       	call   4b2b <fork>
+    17df:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    17e1:	85 c0                	test   %eax,%eax
+    17e3:	0f 88 ac 01 00 00    	js     1995 <createdelete+0x1d5>
+    if(pid == 0){
+    17e9:	0f 84 01 01 00 00    	je     18f0 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    17ef:	83 c6 01             	add    $0x1,%esi
+    17f2:	83 fe 04             	cmp    $0x4,%esi
+    17f5:	75 e3                	jne    17da <createdelete+0x1a>
+    wait();
+    17f7:	e8 3f 33 00 00       	call   4b3b <wait>
+  for(i = 0; i < N; i++){
+    17fc:	31 ff                	xor    %edi,%edi
+    17fe:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1801:	e8 35 33 00 00       	call   4b3b <wait>
+    1806:	e8 30 33 00 00       	call   4b3b <wait>
+    180b:	e8 2b 33 00 00       	call   4b3b <wait>
+  name[0] = name[1] = name[2] = 0;
+    1810:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1818:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    181a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    181d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1822:	0f 94 c2             	sete   %dl
+    1825:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1828:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    182b:	0f 9f c0             	setg   %al
+    182e:	09 c2                	or     %eax,%edx
+    1830:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1833:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1837:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    183a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    183d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    1840:	6a 00                	push   $0x0
+    1842:	56                   	push   %esi
+    1843:	e8 2b 33 00 00       	call   4b73 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    1848:	83 c4 10             	add    $0x10,%esp
+    184b:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    184f:	74 7f                	je     18d0 <createdelete+0x110>
+    1851:	85 c0                	test   %eax,%eax
+    1853:	0f 88 27 01 00 00    	js     1980 <createdelete+0x1c0>
+        close(fd);
+    1859:	83 ec 0c             	sub    $0xc,%esp
+    185c:	50                   	push   %eax
+    185d:	e8 f9 32 00 00       	call   4b5b <close>
+    1862:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1865:	83 c3 01             	add    $0x1,%ebx
+    1868:	80 fb 74             	cmp    $0x74,%bl
+    186b:	75 c6                	jne    1833 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    186d:	83 c7 01             	add    $0x1,%edi
+    1870:	83 ff 14             	cmp    $0x14,%edi
+    1873:	75 a3                	jne    1818 <createdelete+0x58>
+    1875:	bf 70 00 00 00       	mov    $0x70,%edi
+    187a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1880:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1883:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1888:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    188b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    188d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1890:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1893:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1897:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    189a:	56                   	push   %esi
+    189b:	e8 e3 32 00 00       	call   4b83 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    18a0:	83 c4 10             	add    $0x10,%esp
+    18a3:	83 eb 01             	sub    $0x1,%ebx
+    18a6:	75 e3                	jne    188b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    18a8:	83 c7 01             	add    $0x1,%edi
+    18ab:	89 f8                	mov    %edi,%eax
+    18ad:	3c 84                	cmp    $0x84,%al
+    18af:	75 cf                	jne    1880 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    18b1:	83 ec 08             	sub    $0x8,%esp
+    18b4:	68 10 56 00 00       	push   $0x5610
+    18b9:	6a 01                	push   $0x1
+    18bb:	e8 00 34 00 00       	call   4cc0 <printf>
+}
+    18c0:	83 c4 10             	add    $0x10,%esp
+    18c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18c6:	5b                   	pop    %ebx
+    18c7:	5e                   	pop    %esi
+    18c8:	5f                   	pop    %edi
+    18c9:	5d                   	pop    %ebp
+    18ca:	c3                   	ret
+    18cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18cf:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    18d0:	85 c0                	test   %eax,%eax
+    18d2:	78 91                	js     1865 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    18d4:	50                   	push   %eax
+    18d5:	56                   	push   %esi
+    18d6:	68 dc 66 00 00       	push   $0x66dc
+    18db:	6a 01                	push   $0x1
+    18dd:	e8 de 33 00 00       	call   4cc0 <printf>
+        exit();
+    18e2:	e8 4c 32 00 00       	call   4b33 <exit>
+    18e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ee:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    18f0:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    18f3:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    18f7:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    18fa:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    18fd:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1900:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1903:	8d 43 30             	lea    0x30(%ebx),%eax
+    1906:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1909:	68 02 02 00 00       	push   $0x202
+    190e:	56                   	push   %esi
+    190f:	e8 5f 32 00 00       	call   4b73 <open>
+        if(fd < 0){
+    1914:	83 c4 10             	add    $0x10,%esp
+    1917:	85 c0                	test   %eax,%eax
+    1919:	0f 88 8a 00 00 00    	js     19a9 <createdelete+0x1e9>
+        close(fd);
+    191f:	83 ec 0c             	sub    $0xc,%esp
+    1922:	50                   	push   %eax
+    1923:	e8 33 32 00 00       	call   4b5b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1928:	83 c4 10             	add    $0x10,%esp
+    192b:	85 db                	test   %ebx,%ebx
+    192d:	74 19                	je     1948 <createdelete+0x188>
+    192f:	f6 c3 01             	test   $0x1,%bl
+    1932:	74 1b                	je     194f <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    1934:	83 c3 01             	add    $0x1,%ebx
+    1937:	83 fb 14             	cmp    $0x14,%ebx
+    193a:	75 c4                	jne    1900 <createdelete+0x140>
+      exit();
+    193c:	e8 f2 31 00 00       	call   4b33 <exit>
+    1941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    1948:	bb 01 00 00 00       	mov    $0x1,%ebx
+    194d:	eb b1                	jmp    1900 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    194f:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    1951:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    1954:	d1 f8                	sar    %eax
+    1956:	83 c0 30             	add    $0x30,%eax
+    1959:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    195c:	56                   	push   %esi
+    195d:	e8 21 32 00 00       	call   4b83 <unlink>
+    1962:	83 c4 10             	add    $0x10,%esp
+    1965:	85 c0                	test   %eax,%eax
+    1967:	79 cb                	jns    1934 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1969:	52                   	push   %edx
+    196a:	52                   	push   %edx
+    196b:	68 e3 5c 00 00       	push   $0x5ce3
+    1970:	6a 01                	push   $0x1
+    1972:	e8 49 33 00 00       	call   4cc0 <printf>
+            exit();
+    1977:	e8 b7 31 00 00       	call   4b33 <exit>
+    197c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1980:	83 ec 04             	sub    $0x4,%esp
+    1983:	56                   	push   %esi
+    1984:	68 b8 66 00 00       	push   $0x66b8
+    1989:	6a 01                	push   $0x1
+    198b:	e8 30 33 00 00       	call   4cc0 <printf>
+        exit();
+    1990:	e8 9e 31 00 00       	call   4b33 <exit>
+      printf(1, "fork failed\n");
+    1995:	83 ec 08             	sub    $0x8,%esp
+    1998:	68 25 54 00 00       	push   $0x5425
+    199d:	6a 01                	push   $0x1
+    199f:	e8 1c 33 00 00       	call   4cc0 <printf>
+      exit();
+    19a4:	e8 8a 31 00 00       	call   4b33 <exit>
+          printf(1, "create failed\n");
+    19a9:	83 ec 08             	sub    $0x8,%esp
+    19ac:	68 a0 63 00 00       	push   $0x63a0
+    19b1:	6a 01                	push   $0x1
+    19b3:	e8 08 33 00 00       	call   4cc0 <printf>
+          exit();
+    19b8:	e8 76 31 00 00       	call   4b33 <exit>
+    19bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000019c0 <unlinkread>:
+{
+    19c0:	55                   	push   %ebp
+    19c1:	89 e5                	mov    %esp,%ebp
+    19c3:	56                   	push   %esi
+    19c4:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    19c5:	83 ec 08             	sub    $0x8,%esp
+    19c8:	68 21 56 00 00       	push   $0x5621
+    19cd:	6a 01                	push   $0x1
+    19cf:	e8 ec 32 00 00       	call   4cc0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    19d4:	5b                   	pop    %ebx
+    19d5:	5e                   	pop    %esi
+    19d6:	68 02 02 00 00       	push   $0x202
+    19db:	68 32 56 00 00       	push   $0x5632
+    19e0:	e8 8e 31 00 00       	call   4b73 <open>
+  if(fd < 0){
+    19e5:	83 c4 10             	add    $0x10,%esp
+    19e8:	85 c0                	test   %eax,%eax
+    19ea:	0f 88 e6 00 00 00    	js     1ad6 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    19f0:	83 ec 04             	sub    $0x4,%esp
+    19f3:	89 c3                	mov    %eax,%ebx
+    19f5:	6a 05                	push   $0x5
+    19f7:	68 57 56 00 00       	push   $0x5657
+    19fc:	50                   	push   %eax
+    19fd:	e8 51 31 00 00       	call   4b53 <write>
+  close(fd);
+    1a02:	89 1c 24             	mov    %ebx,(%esp)
+    1a05:	e8 51 31 00 00       	call   4b5b <close>
+  fd = open("unlinkread", O_RDWR);
+    1a0a:	58                   	pop    %eax
+    1a0b:	5a                   	pop    %edx
+    1a0c:	6a 02                	push   $0x2
+    1a0e:	68 32 56 00 00       	push   $0x5632
+    1a13:	e8 5b 31 00 00       	call   4b73 <open>
+  if(fd < 0){
+    1a18:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    1a1b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1a1d:	85 c0                	test   %eax,%eax
+    1a1f:	0f 88 10 01 00 00    	js     1b35 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1a25:	83 ec 0c             	sub    $0xc,%esp
+    1a28:	68 32 56 00 00       	push   $0x5632
+    1a2d:	e8 51 31 00 00       	call   4b83 <unlink>
+    1a32:	83 c4 10             	add    $0x10,%esp
+    1a35:	85 c0                	test   %eax,%eax
+    1a37:	0f 85 e5 00 00 00    	jne    1b22 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1a3d:	83 ec 08             	sub    $0x8,%esp
+    1a40:	68 02 02 00 00       	push   $0x202
+    1a45:	68 32 56 00 00       	push   $0x5632
+    1a4a:	e8 24 31 00 00       	call   4b73 <open>
+  write(fd1, "yyy", 3);
+    1a4f:	83 c4 0c             	add    $0xc,%esp
+    1a52:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1a54:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    1a56:	68 8f 56 00 00       	push   $0x568f
+    1a5b:	50                   	push   %eax
+    1a5c:	e8 f2 30 00 00       	call   4b53 <write>
+  close(fd1);
+    1a61:	89 34 24             	mov    %esi,(%esp)
+    1a64:	e8 f2 30 00 00       	call   4b5b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1a69:	83 c4 0c             	add    $0xc,%esp
+    1a6c:	68 00 20 00 00       	push   $0x2000
+    1a71:	68 80 a0 00 00       	push   $0xa080
+    1a76:	53                   	push   %ebx
+    1a77:	e8 cf 30 00 00       	call   4b4b <read>
+    1a7c:	83 c4 10             	add    $0x10,%esp
+    1a7f:	83 f8 05             	cmp    $0x5,%eax
+    1a82:	0f 85 87 00 00 00    	jne    1b0f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1a88:	80 3d 80 a0 00 00 68 	cmpb   $0x68,0xa080
+    1a8f:	75 6b                	jne    1afc <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1a91:	83 ec 04             	sub    $0x4,%esp
+    1a94:	6a 0a                	push   $0xa
+    1a96:	68 80 a0 00 00       	push   $0xa080
+    1a9b:	53                   	push   %ebx
+    1a9c:	e8 b2 30 00 00       	call   4b53 <write>
+    1aa1:	83 c4 10             	add    $0x10,%esp
+    1aa4:	83 f8 0a             	cmp    $0xa,%eax
+    1aa7:	75 40                	jne    1ae9 <unlinkread+0x129>
+  close(fd);
+    1aa9:	83 ec 0c             	sub    $0xc,%esp
+    1aac:	53                   	push   %ebx
+    1aad:	e8 a9 30 00 00       	call   4b5b <close>
+  unlink("unlinkread");
+    1ab2:	c7 04 24 32 56 00 00 	movl   $0x5632,(%esp)
+    1ab9:	e8 c5 30 00 00       	call   4b83 <unlink>
+  printf(1, "unlinkread ok\n");
+    1abe:	58                   	pop    %eax
+    1abf:	5a                   	pop    %edx
+    1ac0:	68 da 56 00 00       	push   $0x56da
+    1ac5:	6a 01                	push   $0x1
+    1ac7:	e8 f4 31 00 00       	call   4cc0 <printf>
+}
+    1acc:	83 c4 10             	add    $0x10,%esp
+    1acf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1ad2:	5b                   	pop    %ebx
+    1ad3:	5e                   	pop    %esi
+    1ad4:	5d                   	pop    %ebp
+    1ad5:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1ad6:	51                   	push   %ecx
+    1ad7:	51                   	push   %ecx
+    1ad8:	68 3d 56 00 00       	push   $0x563d
+    1add:	6a 01                	push   $0x1
+    1adf:	e8 dc 31 00 00       	call   4cc0 <printf>
+    exit();
+    1ae4:	e8 4a 30 00 00       	call   4b33 <exit>
+    printf(1, "unlinkread write failed\n");
+    1ae9:	51                   	push   %ecx
+    1aea:	51                   	push   %ecx
+    1aeb:	68 c1 56 00 00       	push   $0x56c1
+    1af0:	6a 01                	push   $0x1
+    1af2:	e8 c9 31 00 00       	call   4cc0 <printf>
+    exit();
+    1af7:	e8 37 30 00 00       	call   4b33 <exit>
+    printf(1, "unlinkread wrong data\n");
+    1afc:	53                   	push   %ebx
+    1afd:	53                   	push   %ebx
+    1afe:	68 aa 56 00 00       	push   $0x56aa
+    1b03:	6a 01                	push   $0x1
+    1b05:	e8 b6 31 00 00       	call   4cc0 <printf>
+    exit();
+    1b0a:	e8 24 30 00 00       	call   4b33 <exit>
+    printf(1, "unlinkread read failed");
+    1b0f:	56                   	push   %esi
+    1b10:	56                   	push   %esi
+    1b11:	68 93 56 00 00       	push   $0x5693
+    1b16:	6a 01                	push   $0x1
+    1b18:	e8 a3 31 00 00       	call   4cc0 <printf>
+    exit();
+    1b1d:	e8 11 30 00 00       	call   4b33 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1b22:	50                   	push   %eax
+    1b23:	50                   	push   %eax
+    1b24:	68 75 56 00 00       	push   $0x5675
+    1b29:	6a 01                	push   $0x1
+    1b2b:	e8 90 31 00 00       	call   4cc0 <printf>
+    exit();
+    1b30:	e8 fe 2f 00 00       	call   4b33 <exit>
+    printf(1, "open unlinkread failed\n");
+    1b35:	50                   	push   %eax
+    1b36:	50                   	push   %eax
+    1b37:	68 5d 56 00 00       	push   $0x565d
+    1b3c:	6a 01                	push   $0x1
+    1b3e:	e8 7d 31 00 00       	call   4cc0 <printf>
+    exit();
+    1b43:	e8 eb 2f 00 00       	call   4b33 <exit>
+    1b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b4f:	90                   	nop
+
+00001b50 <linktest>:
+{
+    1b50:	55                   	push   %ebp
+    1b51:	89 e5                	mov    %esp,%ebp
+    1b53:	53                   	push   %ebx
+    1b54:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    1b57:	68 e9 56 00 00       	push   $0x56e9
+    1b5c:	6a 01                	push   $0x1
+    1b5e:	e8 5d 31 00 00       	call   4cc0 <printf>
+  unlink("lf1");
+    1b63:	c7 04 24 f3 56 00 00 	movl   $0x56f3,(%esp)
+    1b6a:	e8 14 30 00 00       	call   4b83 <unlink>
+  unlink("lf2");
+    1b6f:	c7 04 24 f7 56 00 00 	movl   $0x56f7,(%esp)
+    1b76:	e8 08 30 00 00       	call   4b83 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    1b7b:	58                   	pop    %eax
+    1b7c:	5a                   	pop    %edx
+    1b7d:	68 02 02 00 00       	push   $0x202
+    1b82:	68 f3 56 00 00       	push   $0x56f3
+    1b87:	e8 e7 2f 00 00       	call   4b73 <open>
+  if(fd < 0){
+    1b8c:	83 c4 10             	add    $0x10,%esp
+    1b8f:	85 c0                	test   %eax,%eax
+    1b91:	0f 88 1e 01 00 00    	js     1cb5 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1b97:	83 ec 04             	sub    $0x4,%esp
+    1b9a:	89 c3                	mov    %eax,%ebx
+    1b9c:	6a 05                	push   $0x5
+    1b9e:	68 57 56 00 00       	push   $0x5657
+    1ba3:	50                   	push   %eax
+    1ba4:	e8 aa 2f 00 00       	call   4b53 <write>
+    1ba9:	83 c4 10             	add    $0x10,%esp
+    1bac:	83 f8 05             	cmp    $0x5,%eax
+    1baf:	0f 85 98 01 00 00    	jne    1d4d <linktest+0x1fd>
+  close(fd);
+    1bb5:	83 ec 0c             	sub    $0xc,%esp
+    1bb8:	53                   	push   %ebx
+    1bb9:	e8 9d 2f 00 00       	call   4b5b <close>
+  if(link("lf1", "lf2") < 0){
+    1bbe:	5b                   	pop    %ebx
+    1bbf:	58                   	pop    %eax
+    1bc0:	68 f7 56 00 00       	push   $0x56f7
+    1bc5:	68 f3 56 00 00       	push   $0x56f3
+    1bca:	e8 c4 2f 00 00       	call   4b93 <link>
+    1bcf:	83 c4 10             	add    $0x10,%esp
+    1bd2:	85 c0                	test   %eax,%eax
+    1bd4:	0f 88 60 01 00 00    	js     1d3a <linktest+0x1ea>
+  unlink("lf1");
+    1bda:	83 ec 0c             	sub    $0xc,%esp
+    1bdd:	68 f3 56 00 00       	push   $0x56f3
+    1be2:	e8 9c 2f 00 00       	call   4b83 <unlink>
+  if(open("lf1", 0) >= 0){
+    1be7:	58                   	pop    %eax
+    1be8:	5a                   	pop    %edx
+    1be9:	6a 00                	push   $0x0
+    1beb:	68 f3 56 00 00       	push   $0x56f3
+    1bf0:	e8 7e 2f 00 00       	call   4b73 <open>
+    1bf5:	83 c4 10             	add    $0x10,%esp
+    1bf8:	85 c0                	test   %eax,%eax
+    1bfa:	0f 89 27 01 00 00    	jns    1d27 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1c00:	83 ec 08             	sub    $0x8,%esp
+    1c03:	6a 00                	push   $0x0
+    1c05:	68 f7 56 00 00       	push   $0x56f7
+    1c0a:	e8 64 2f 00 00       	call   4b73 <open>
+  if(fd < 0){
+    1c0f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1c12:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1c14:	85 c0                	test   %eax,%eax
+    1c16:	0f 88 f8 00 00 00    	js     1d14 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1c1c:	83 ec 04             	sub    $0x4,%esp
+    1c1f:	68 00 20 00 00       	push   $0x2000
+    1c24:	68 80 a0 00 00       	push   $0xa080
+    1c29:	50                   	push   %eax
+    1c2a:	e8 1c 2f 00 00       	call   4b4b <read>
+    1c2f:	83 c4 10             	add    $0x10,%esp
+    1c32:	83 f8 05             	cmp    $0x5,%eax
+    1c35:	0f 85 c6 00 00 00    	jne    1d01 <linktest+0x1b1>
+  close(fd);
+    1c3b:	83 ec 0c             	sub    $0xc,%esp
+    1c3e:	53                   	push   %ebx
+    1c3f:	e8 17 2f 00 00       	call   4b5b <close>
+  if(link("lf2", "lf2") >= 0){
+    1c44:	58                   	pop    %eax
+    1c45:	5a                   	pop    %edx
+    1c46:	68 f7 56 00 00       	push   $0x56f7
+    1c4b:	68 f7 56 00 00       	push   $0x56f7
+    1c50:	e8 3e 2f 00 00       	call   4b93 <link>
+    1c55:	83 c4 10             	add    $0x10,%esp
+    1c58:	85 c0                	test   %eax,%eax
+    1c5a:	0f 89 8e 00 00 00    	jns    1cee <linktest+0x19e>
+  unlink("lf2");
+    1c60:	83 ec 0c             	sub    $0xc,%esp
+    1c63:	68 f7 56 00 00       	push   $0x56f7
+    1c68:	e8 16 2f 00 00       	call   4b83 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    1c6d:	59                   	pop    %ecx
+    1c6e:	5b                   	pop    %ebx
+    1c6f:	68 f3 56 00 00       	push   $0x56f3
+    1c74:	68 f7 56 00 00       	push   $0x56f7
+    1c79:	e8 15 2f 00 00       	call   4b93 <link>
+    1c7e:	83 c4 10             	add    $0x10,%esp
+    1c81:	85 c0                	test   %eax,%eax
+    1c83:	79 56                	jns    1cdb <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1c85:	83 ec 08             	sub    $0x8,%esp
+    1c88:	68 f3 56 00 00       	push   $0x56f3
+    1c8d:	68 bb 59 00 00       	push   $0x59bb
+    1c92:	e8 fc 2e 00 00       	call   4b93 <link>
+    1c97:	83 c4 10             	add    $0x10,%esp
+    1c9a:	85 c0                	test   %eax,%eax
+    1c9c:	79 2a                	jns    1cc8 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    1c9e:	83 ec 08             	sub    $0x8,%esp
+    1ca1:	68 91 57 00 00       	push   $0x5791
+    1ca6:	6a 01                	push   $0x1
+    1ca8:	e8 13 30 00 00       	call   4cc0 <printf>
+}
+    1cad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1cb0:	83 c4 10             	add    $0x10,%esp
+    1cb3:	c9                   	leave
+    1cb4:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1cb5:	50                   	push   %eax
+    1cb6:	50                   	push   %eax
+    1cb7:	68 fb 56 00 00       	push   $0x56fb
+    1cbc:	6a 01                	push   $0x1
+    1cbe:	e8 fd 2f 00 00       	call   4cc0 <printf>
+    exit();
+    1cc3:	e8 6b 2e 00 00       	call   4b33 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1cc8:	50                   	push   %eax
+    1cc9:	50                   	push   %eax
+    1cca:	68 75 57 00 00       	push   $0x5775
+    1ccf:	6a 01                	push   $0x1
+    1cd1:	e8 ea 2f 00 00       	call   4cc0 <printf>
+    exit();
+    1cd6:	e8 58 2e 00 00       	call   4b33 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    1cdb:	52                   	push   %edx
+    1cdc:	52                   	push   %edx
+    1cdd:	68 24 67 00 00       	push   $0x6724
+    1ce2:	6a 01                	push   $0x1
+    1ce4:	e8 d7 2f 00 00       	call   4cc0 <printf>
+    exit();
+    1ce9:	e8 45 2e 00 00       	call   4b33 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1cee:	50                   	push   %eax
+    1cef:	50                   	push   %eax
+    1cf0:	68 57 57 00 00       	push   $0x5757
+    1cf5:	6a 01                	push   $0x1
+    1cf7:	e8 c4 2f 00 00       	call   4cc0 <printf>
+    exit();
+    1cfc:	e8 32 2e 00 00       	call   4b33 <exit>
+    printf(1, "read lf2 failed\n");
+    1d01:	51                   	push   %ecx
+    1d02:	51                   	push   %ecx
+    1d03:	68 46 57 00 00       	push   $0x5746
+    1d08:	6a 01                	push   $0x1
+    1d0a:	e8 b1 2f 00 00       	call   4cc0 <printf>
+    exit();
+    1d0f:	e8 1f 2e 00 00       	call   4b33 <exit>
+    printf(1, "open lf2 failed\n");
+    1d14:	53                   	push   %ebx
+    1d15:	53                   	push   %ebx
+    1d16:	68 35 57 00 00       	push   $0x5735
+    1d1b:	6a 01                	push   $0x1
+    1d1d:	e8 9e 2f 00 00       	call   4cc0 <printf>
+    exit();
+    1d22:	e8 0c 2e 00 00       	call   4b33 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1d27:	50                   	push   %eax
+    1d28:	50                   	push   %eax
+    1d29:	68 fc 66 00 00       	push   $0x66fc
+    1d2e:	6a 01                	push   $0x1
+    1d30:	e8 8b 2f 00 00       	call   4cc0 <printf>
+    exit();
+    1d35:	e8 f9 2d 00 00       	call   4b33 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1d3a:	51                   	push   %ecx
+    1d3b:	51                   	push   %ecx
+    1d3c:	68 20 57 00 00       	push   $0x5720
+    1d41:	6a 01                	push   $0x1
+    1d43:	e8 78 2f 00 00       	call   4cc0 <printf>
+    exit();
+    1d48:	e8 e6 2d 00 00       	call   4b33 <exit>
+    printf(1, "write lf1 failed\n");
+    1d4d:	50                   	push   %eax
+    1d4e:	50                   	push   %eax
+    1d4f:	68 0e 57 00 00       	push   $0x570e
+    1d54:	6a 01                	push   $0x1
+    1d56:	e8 65 2f 00 00       	call   4cc0 <printf>
+    exit();
+    1d5b:	e8 d3 2d 00 00       	call   4b33 <exit>
+
+00001d60 <concreate>:
+{
+    1d60:	55                   	push   %ebp
+    1d61:	89 e5                	mov    %esp,%ebp
+    1d63:	57                   	push   %edi
+    1d64:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1d65:	31 f6                	xor    %esi,%esi
+{
+    1d67:	53                   	push   %ebx
+    1d68:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    1d6b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    1d6e:	68 9e 57 00 00       	push   $0x579e
+    1d73:	6a 01                	push   $0x1
+    1d75:	e8 46 2f 00 00       	call   4cc0 <printf>
+  file[0] = 'C';
+    1d7a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    1d7e:	83 c4 10             	add    $0x10,%esp
+    1d81:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1d85:	eb 4c                	jmp    1dd3 <concreate+0x73>
+    1d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d8e:	66 90                	xchg   %ax,%ax
+    1d90:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1d96:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    1d9b:	0f 83 8f 00 00 00    	jae    1e30 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1da1:	83 ec 08             	sub    $0x8,%esp
+    1da4:	68 02 02 00 00       	push   $0x202
+    1da9:	53                   	push   %ebx
+    1daa:	e8 c4 2d 00 00       	call   4b73 <open>
+      if(fd < 0){
+    1daf:	83 c4 10             	add    $0x10,%esp
+    1db2:	85 c0                	test   %eax,%eax
+    1db4:	78 63                	js     1e19 <concreate+0xb9>
+      close(fd);
+    1db6:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1db9:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    1dbc:	50                   	push   %eax
+    1dbd:	e8 99 2d 00 00       	call   4b5b <close>
+    1dc2:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1dc5:	e8 71 2d 00 00       	call   4b3b <wait>
+  for(i = 0; i < 40; i++){
+    1dca:	83 fe 28             	cmp    $0x28,%esi
+    1dcd:	0f 84 7f 00 00 00    	je     1e52 <concreate+0xf2>
+    unlink(file);
+    1dd3:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1dd6:	8d 46 30             	lea    0x30(%esi),%eax
+    1dd9:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    1ddc:	53                   	push   %ebx
+    1ddd:	e8 a1 2d 00 00       	call   4b83 <unlink>
+    pid = fork();
+    1de2:	e8 44 2d 00 00       	call   4b2b <fork>
+    if(pid && (i % 3) == 1){
+    1de7:	83 c4 10             	add    $0x10,%esp
+    1dea:	85 c0                	test   %eax,%eax
+    1dec:	75 a2                	jne    1d90 <concreate+0x30>
+      link("C0", file);
+    1dee:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1df4:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    1dfa:	0f 83 d0 00 00 00    	jae    1ed0 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1e00:	83 ec 08             	sub    $0x8,%esp
+    1e03:	68 02 02 00 00       	push   $0x202
+    1e08:	53                   	push   %ebx
+    1e09:	e8 65 2d 00 00       	call   4b73 <open>
+      if(fd < 0){
+    1e0e:	83 c4 10             	add    $0x10,%esp
+    1e11:	85 c0                	test   %eax,%eax
+    1e13:	0f 89 ea 01 00 00    	jns    2003 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1e19:	83 ec 04             	sub    $0x4,%esp
+    1e1c:	53                   	push   %ebx
+    1e1d:	68 b1 57 00 00       	push   $0x57b1
+    1e22:	6a 01                	push   $0x1
+    1e24:	e8 97 2e 00 00       	call   4cc0 <printf>
+        exit();
+    1e29:	e8 05 2d 00 00       	call   4b33 <exit>
+    1e2e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    1e30:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1e33:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1e36:	53                   	push   %ebx
+    1e37:	68 ae 57 00 00       	push   $0x57ae
+    1e3c:	e8 52 2d 00 00       	call   4b93 <link>
+    1e41:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1e44:	e8 f2 2c 00 00       	call   4b3b <wait>
+  for(i = 0; i < 40; i++){
+    1e49:	83 fe 28             	cmp    $0x28,%esi
+    1e4c:	0f 85 81 ff ff ff    	jne    1dd3 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    1e52:	83 ec 04             	sub    $0x4,%esp
+    1e55:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1e58:	6a 28                	push   $0x28
+    1e5a:	6a 00                	push   $0x0
+    1e5c:	50                   	push   %eax
+    1e5d:	e8 4e 2b 00 00       	call   49b0 <memset>
+  fd = open(".", 0);
+    1e62:	5e                   	pop    %esi
+    1e63:	5f                   	pop    %edi
+    1e64:	6a 00                	push   $0x0
+    1e66:	68 bb 59 00 00       	push   $0x59bb
+    1e6b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    1e6e:	e8 00 2d 00 00       	call   4b73 <open>
+  n = 0;
+    1e73:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1e7a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1e7d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1e7f:	90                   	nop
+    1e80:	83 ec 04             	sub    $0x4,%esp
+    1e83:	6a 10                	push   $0x10
+    1e85:	57                   	push   %edi
+    1e86:	56                   	push   %esi
+    1e87:	e8 bf 2c 00 00       	call   4b4b <read>
+    1e8c:	83 c4 10             	add    $0x10,%esp
+    1e8f:	85 c0                	test   %eax,%eax
+    1e91:	7e 5d                	jle    1ef0 <concreate+0x190>
+    if(de.inum == 0)
+    1e93:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1e98:	74 e6                	je     1e80 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1e9a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    1e9e:	75 e0                	jne    1e80 <concreate+0x120>
+    1ea0:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1ea4:	75 da                	jne    1e80 <concreate+0x120>
+      i = de.name[1] - '0';
+    1ea6:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    1eaa:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1ead:	83 f8 27             	cmp    $0x27,%eax
+    1eb0:	0f 87 5e 01 00 00    	ja     2014 <concreate+0x2b4>
+      if(fa[i]){
+    1eb6:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    1ebb:	0f 85 7e 01 00 00    	jne    203f <concreate+0x2df>
+      n++;
+    1ec1:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1ec5:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    1eca:	eb b4                	jmp    1e80 <concreate+0x120>
+    1ecc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1ed0:	83 ec 08             	sub    $0x8,%esp
+    1ed3:	53                   	push   %ebx
+    1ed4:	68 ae 57 00 00       	push   $0x57ae
+    1ed9:	e8 b5 2c 00 00       	call   4b93 <link>
+    1ede:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1ee1:	e8 4d 2c 00 00       	call   4b33 <exit>
+    1ee6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1eed:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1ef0:	83 ec 0c             	sub    $0xc,%esp
+    1ef3:	56                   	push   %esi
+    1ef4:	e8 62 2c 00 00       	call   4b5b <close>
+  if(n != 40){
+    1ef9:	83 c4 10             	add    $0x10,%esp
+    1efc:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1f00:	0f 85 26 01 00 00    	jne    202c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1f06:	31 f6                	xor    %esi,%esi
+    1f08:	eb 48                	jmp    1f52 <concreate+0x1f2>
+    1f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1f10:	85 ff                	test   %edi,%edi
+    1f12:	74 05                	je     1f19 <concreate+0x1b9>
+    1f14:	83 f8 01             	cmp    $0x1,%eax
+    1f17:	74 68                	je     1f81 <concreate+0x221>
+      unlink(file);
+    1f19:	83 ec 0c             	sub    $0xc,%esp
+    1f1c:	53                   	push   %ebx
+    1f1d:	e8 61 2c 00 00       	call   4b83 <unlink>
+      unlink(file);
+    1f22:	89 1c 24             	mov    %ebx,(%esp)
+    1f25:	e8 59 2c 00 00       	call   4b83 <unlink>
+      unlink(file);
+    1f2a:	89 1c 24             	mov    %ebx,(%esp)
+    1f2d:	e8 51 2c 00 00       	call   4b83 <unlink>
+      unlink(file);
+    1f32:	89 1c 24             	mov    %ebx,(%esp)
+    1f35:	e8 49 2c 00 00       	call   4b83 <unlink>
+    1f3a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1f3d:	85 ff                	test   %edi,%edi
+    1f3f:	74 a0                	je     1ee1 <concreate+0x181>
+      wait();
+    1f41:	e8 f5 2b 00 00       	call   4b3b <wait>
+  for(i = 0; i < 40; i++){
+    1f46:	83 c6 01             	add    $0x1,%esi
+    1f49:	83 fe 28             	cmp    $0x28,%esi
+    1f4c:	0f 84 86 00 00 00    	je     1fd8 <concreate+0x278>
+    file[1] = '0' + i;
+    1f52:	8d 46 30             	lea    0x30(%esi),%eax
+    1f55:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1f58:	e8 ce 2b 00 00       	call   4b2b <fork>
+    1f5d:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1f5f:	85 c0                	test   %eax,%eax
+    1f61:	0f 88 88 00 00 00    	js     1fef <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1f67:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1f6c:	f7 e6                	mul    %esi
+    1f6e:	89 d0                	mov    %edx,%eax
+    1f70:	83 e2 fe             	and    $0xfffffffe,%edx
+    1f73:	d1 e8                	shr    %eax
+    1f75:	01 c2                	add    %eax,%edx
+    1f77:	89 f0                	mov    %esi,%eax
+    1f79:	29 d0                	sub    %edx,%eax
+    1f7b:	89 c1                	mov    %eax,%ecx
+    1f7d:	09 f9                	or     %edi,%ecx
+    1f7f:	75 8f                	jne    1f10 <concreate+0x1b0>
+      close(open(file, 0));
+    1f81:	83 ec 08             	sub    $0x8,%esp
+    1f84:	6a 00                	push   $0x0
+    1f86:	53                   	push   %ebx
+    1f87:	e8 e7 2b 00 00       	call   4b73 <open>
+    1f8c:	89 04 24             	mov    %eax,(%esp)
+    1f8f:	e8 c7 2b 00 00       	call   4b5b <close>
+      close(open(file, 0));
+    1f94:	58                   	pop    %eax
+    1f95:	5a                   	pop    %edx
+    1f96:	6a 00                	push   $0x0
+    1f98:	53                   	push   %ebx
+    1f99:	e8 d5 2b 00 00       	call   4b73 <open>
+    1f9e:	89 04 24             	mov    %eax,(%esp)
+    1fa1:	e8 b5 2b 00 00       	call   4b5b <close>
+      close(open(file, 0));
+    1fa6:	59                   	pop    %ecx
+    1fa7:	58                   	pop    %eax
+    1fa8:	6a 00                	push   $0x0
+    1faa:	53                   	push   %ebx
+    1fab:	e8 c3 2b 00 00       	call   4b73 <open>
+    1fb0:	89 04 24             	mov    %eax,(%esp)
+    1fb3:	e8 a3 2b 00 00       	call   4b5b <close>
+      close(open(file, 0));
+    1fb8:	58                   	pop    %eax
+    1fb9:	5a                   	pop    %edx
+    1fba:	6a 00                	push   $0x0
+    1fbc:	53                   	push   %ebx
+    1fbd:	e8 b1 2b 00 00       	call   4b73 <open>
+    1fc2:	89 04 24             	mov    %eax,(%esp)
+    1fc5:	e8 91 2b 00 00       	call   4b5b <close>
+    1fca:	83 c4 10             	add    $0x10,%esp
+    1fcd:	e9 6b ff ff ff       	jmp    1f3d <concreate+0x1dd>
+    1fd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1fd8:	83 ec 08             	sub    $0x8,%esp
+    1fdb:	68 03 58 00 00       	push   $0x5803
+    1fe0:	6a 01                	push   $0x1
+    1fe2:	e8 d9 2c 00 00       	call   4cc0 <printf>
+}
+    1fe7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fea:	5b                   	pop    %ebx
+    1feb:	5e                   	pop    %esi
+    1fec:	5f                   	pop    %edi
+    1fed:	5d                   	pop    %ebp
+    1fee:	c3                   	ret
+      printf(1, "fork failed\n");
+    1fef:	83 ec 08             	sub    $0x8,%esp
+    1ff2:	68 25 54 00 00       	push   $0x5425
+    1ff7:	6a 01                	push   $0x1
+    1ff9:	e8 c2 2c 00 00       	call   4cc0 <printf>
+      exit();
+    1ffe:	e8 30 2b 00 00       	call   4b33 <exit>
+      close(fd);
+    2003:	83 ec 0c             	sub    $0xc,%esp
+    2006:	50                   	push   %eax
+    2007:	e8 4f 2b 00 00       	call   4b5b <close>
+    200c:	83 c4 10             	add    $0x10,%esp
+    200f:	e9 cd fe ff ff       	jmp    1ee1 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    2014:	83 ec 04             	sub    $0x4,%esp
+    2017:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    201a:	50                   	push   %eax
+    201b:	68 cd 57 00 00       	push   $0x57cd
+    2020:	6a 01                	push   $0x1
+    2022:	e8 99 2c 00 00       	call   4cc0 <printf>
+        exit();
+    2027:	e8 07 2b 00 00       	call   4b33 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    202c:	51                   	push   %ecx
+    202d:	51                   	push   %ecx
+    202e:	68 48 67 00 00       	push   $0x6748
+    2033:	6a 01                	push   $0x1
+    2035:	e8 86 2c 00 00       	call   4cc0 <printf>
+    exit();
+    203a:	e8 f4 2a 00 00       	call   4b33 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    203f:	83 ec 04             	sub    $0x4,%esp
+    2042:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    2045:	50                   	push   %eax
+    2046:	68 e6 57 00 00       	push   $0x57e6
+    204b:	6a 01                	push   $0x1
+    204d:	e8 6e 2c 00 00       	call   4cc0 <printf>
+        exit();
+    2052:	e8 dc 2a 00 00       	call   4b33 <exit>
+    2057:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    205e:	66 90                	xchg   %ax,%ax
+
+00002060 <linkunlink>:
+{
+    2060:	55                   	push   %ebp
+    2061:	89 e5                	mov    %esp,%ebp
+    2063:	57                   	push   %edi
+    2064:	56                   	push   %esi
+    2065:	53                   	push   %ebx
+    2066:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    2069:	68 11 58 00 00       	push   $0x5811
+    206e:	6a 01                	push   $0x1
+    2070:	e8 4b 2c 00 00       	call   4cc0 <printf>
+  unlink("x");
+    2075:	c7 04 24 fe 5c 00 00 	movl   $0x5cfe,(%esp)
+    207c:	e8 02 2b 00 00       	call   4b83 <unlink>
+  pid = fork();
+    2081:	e8 a5 2a 00 00       	call   4b2b <fork>
+  if(pid < 0){
+    2086:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2089:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    208c:	85 c0                	test   %eax,%eax
+    208e:	0f 88 b6 00 00 00    	js     214a <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    2094:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    2098:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    209d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    20a2:	19 ff                	sbb    %edi,%edi
+    20a4:	83 e7 60             	and    $0x60,%edi
+    20a7:	83 c7 01             	add    $0x1,%edi
+    20aa:	eb 1e                	jmp    20ca <linkunlink+0x6a>
+    20ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    20b0:	83 f8 01             	cmp    $0x1,%eax
+    20b3:	74 7b                	je     2130 <linkunlink+0xd0>
+      unlink("x");
+    20b5:	83 ec 0c             	sub    $0xc,%esp
+    20b8:	68 fe 5c 00 00       	push   $0x5cfe
+    20bd:	e8 c1 2a 00 00       	call   4b83 <unlink>
+    20c2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    20c5:	83 eb 01             	sub    $0x1,%ebx
+    20c8:	74 41                	je     210b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    20ca:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    20d0:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    20d6:	89 f8                	mov    %edi,%eax
+    20d8:	f7 e6                	mul    %esi
+    20da:	89 d0                	mov    %edx,%eax
+    20dc:	83 e2 fe             	and    $0xfffffffe,%edx
+    20df:	d1 e8                	shr    %eax
+    20e1:	01 c2                	add    %eax,%edx
+    20e3:	89 f8                	mov    %edi,%eax
+    20e5:	29 d0                	sub    %edx,%eax
+    20e7:	75 c7                	jne    20b0 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    20e9:	83 ec 08             	sub    $0x8,%esp
+    20ec:	68 02 02 00 00       	push   $0x202
+    20f1:	68 fe 5c 00 00       	push   $0x5cfe
+    20f6:	e8 78 2a 00 00       	call   4b73 <open>
+    20fb:	89 04 24             	mov    %eax,(%esp)
+    20fe:	e8 58 2a 00 00       	call   4b5b <close>
+    2103:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2106:	83 eb 01             	sub    $0x1,%ebx
+    2109:	75 bf                	jne    20ca <linkunlink+0x6a>
+  if(pid)
+    210b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    210e:	85 c0                	test   %eax,%eax
+    2110:	74 4b                	je     215d <linkunlink+0xfd>
+    wait();
+    2112:	e8 24 2a 00 00       	call   4b3b <wait>
+  printf(1, "linkunlink ok\n");
+    2117:	83 ec 08             	sub    $0x8,%esp
+    211a:	68 26 58 00 00       	push   $0x5826
+    211f:	6a 01                	push   $0x1
+    2121:	e8 9a 2b 00 00       	call   4cc0 <printf>
+}
+    2126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2129:	5b                   	pop    %ebx
+    212a:	5e                   	pop    %esi
+    212b:	5f                   	pop    %edi
+    212c:	5d                   	pop    %ebp
+    212d:	c3                   	ret
+    212e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    2130:	83 ec 08             	sub    $0x8,%esp
+    2133:	68 fe 5c 00 00       	push   $0x5cfe
+    2138:	68 22 58 00 00       	push   $0x5822
+    213d:	e8 51 2a 00 00       	call   4b93 <link>
+    2142:	83 c4 10             	add    $0x10,%esp
+    2145:	e9 7b ff ff ff       	jmp    20c5 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    214a:	52                   	push   %edx
+    214b:	52                   	push   %edx
+    214c:	68 25 54 00 00       	push   $0x5425
+    2151:	6a 01                	push   $0x1
+    2153:	e8 68 2b 00 00       	call   4cc0 <printf>
+    exit();
+    2158:	e8 d6 29 00 00       	call   4b33 <exit>
+    exit();
+    215d:	e8 d1 29 00 00       	call   4b33 <exit>
+    2162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002170 <bigdir>:
+{
+    2170:	55                   	push   %ebp
+    2171:	89 e5                	mov    %esp,%ebp
+    2173:	57                   	push   %edi
+    2174:	56                   	push   %esi
+    2175:	53                   	push   %ebx
+    2176:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    2179:	68 35 58 00 00       	push   $0x5835
+    217e:	6a 01                	push   $0x1
+    2180:	e8 3b 2b 00 00       	call   4cc0 <printf>
+  unlink("bd");
+    2185:	c7 04 24 42 58 00 00 	movl   $0x5842,(%esp)
+    218c:	e8 f2 29 00 00       	call   4b83 <unlink>
+  fd = open("bd", O_CREATE);
+    2191:	5a                   	pop    %edx
+    2192:	59                   	pop    %ecx
+    2193:	68 00 02 00 00       	push   $0x200
+    2198:	68 42 58 00 00       	push   $0x5842
+    219d:	e8 d1 29 00 00       	call   4b73 <open>
+  if(fd < 0){
+    21a2:	83 c4 10             	add    $0x10,%esp
+    21a5:	85 c0                	test   %eax,%eax
+    21a7:	0f 88 de 00 00 00    	js     228b <bigdir+0x11b>
+  close(fd);
+    21ad:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    21b0:	31 f6                	xor    %esi,%esi
+    21b2:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    21b5:	50                   	push   %eax
+    21b6:	e8 a0 29 00 00       	call   4b5b <close>
+    21bb:	83 c4 10             	add    $0x10,%esp
+    21be:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    21c0:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    21c2:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    21c5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    21c9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    21cc:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    21d0:	83 c0 30             	add    $0x30,%eax
+    21d3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    21d6:	89 f0                	mov    %esi,%eax
+    21d8:	83 e0 3f             	and    $0x3f,%eax
+    21db:	83 c0 30             	add    $0x30,%eax
+    21de:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    21e1:	57                   	push   %edi
+    21e2:	68 42 58 00 00       	push   $0x5842
+    21e7:	e8 a7 29 00 00       	call   4b93 <link>
+    21ec:	83 c4 10             	add    $0x10,%esp
+    21ef:	89 c3                	mov    %eax,%ebx
+    21f1:	85 c0                	test   %eax,%eax
+    21f3:	75 6e                	jne    2263 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    21f5:	83 c6 01             	add    $0x1,%esi
+    21f8:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    21fe:	75 c0                	jne    21c0 <bigdir+0x50>
+  unlink("bd");
+    2200:	83 ec 0c             	sub    $0xc,%esp
+    2203:	68 42 58 00 00       	push   $0x5842
+    2208:	e8 76 29 00 00       	call   4b83 <unlink>
+    220d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    2210:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    2212:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    2215:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2219:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    221c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2220:	83 c0 30             	add    $0x30,%eax
+    2223:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2226:	89 d8                	mov    %ebx,%eax
+    2228:	83 e0 3f             	and    $0x3f,%eax
+    222b:	83 c0 30             	add    $0x30,%eax
+    222e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    2231:	57                   	push   %edi
+    2232:	e8 4c 29 00 00       	call   4b83 <unlink>
+    2237:	83 c4 10             	add    $0x10,%esp
+    223a:	85 c0                	test   %eax,%eax
+    223c:	75 39                	jne    2277 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    223e:	83 c3 01             	add    $0x1,%ebx
+    2241:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    2247:	75 c7                	jne    2210 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    2249:	83 ec 08             	sub    $0x8,%esp
+    224c:	68 84 58 00 00       	push   $0x5884
+    2251:	6a 01                	push   $0x1
+    2253:	e8 68 2a 00 00       	call   4cc0 <printf>
+    2258:	83 c4 10             	add    $0x10,%esp
+}
+    225b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    225e:	5b                   	pop    %ebx
+    225f:	5e                   	pop    %esi
+    2260:	5f                   	pop    %edi
+    2261:	5d                   	pop    %ebp
+    2262:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    2263:	83 ec 08             	sub    $0x8,%esp
+    2266:	68 5b 58 00 00       	push   $0x585b
+    226b:	6a 01                	push   $0x1
+    226d:	e8 4e 2a 00 00       	call   4cc0 <printf>
+      exit();
+    2272:	e8 bc 28 00 00       	call   4b33 <exit>
+      printf(1, "bigdir unlink failed");
+    2277:	83 ec 08             	sub    $0x8,%esp
+    227a:	68 6f 58 00 00       	push   $0x586f
+    227f:	6a 01                	push   $0x1
+    2281:	e8 3a 2a 00 00       	call   4cc0 <printf>
+      exit();
+    2286:	e8 a8 28 00 00       	call   4b33 <exit>
+    printf(1, "bigdir create failed\n");
+    228b:	50                   	push   %eax
+    228c:	50                   	push   %eax
+    228d:	68 45 58 00 00       	push   $0x5845
+    2292:	6a 01                	push   $0x1
+    2294:	e8 27 2a 00 00       	call   4cc0 <printf>
+    exit();
+    2299:	e8 95 28 00 00       	call   4b33 <exit>
+    229e:	66 90                	xchg   %ax,%ax
+
+000022a0 <subdir>:
+{
+    22a0:	55                   	push   %ebp
+    22a1:	89 e5                	mov    %esp,%ebp
+    22a3:	53                   	push   %ebx
+    22a4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    22a7:	68 8f 58 00 00       	push   $0x588f
+    22ac:	6a 01                	push   $0x1
+    22ae:	e8 0d 2a 00 00       	call   4cc0 <printf>
+  unlink("ff");
+    22b3:	c7 04 24 18 59 00 00 	movl   $0x5918,(%esp)
+    22ba:	e8 c4 28 00 00       	call   4b83 <unlink>
+  if(mkdir("dd") != 0){
+    22bf:	c7 04 24 b5 59 00 00 	movl   $0x59b5,(%esp)
+    22c6:	e8 d0 28 00 00       	call   4b9b <mkdir>
+    22cb:	83 c4 10             	add    $0x10,%esp
+    22ce:	85 c0                	test   %eax,%eax
+    22d0:	0f 85 b3 05 00 00    	jne    2889 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    22d6:	83 ec 08             	sub    $0x8,%esp
+    22d9:	68 02 02 00 00       	push   $0x202
+    22de:	68 ee 58 00 00       	push   $0x58ee
+    22e3:	e8 8b 28 00 00       	call   4b73 <open>
+  if(fd < 0){
+    22e8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    22eb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    22ed:	85 c0                	test   %eax,%eax
+    22ef:	0f 88 81 05 00 00    	js     2876 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    22f5:	83 ec 04             	sub    $0x4,%esp
+    22f8:	6a 02                	push   $0x2
+    22fa:	68 18 59 00 00       	push   $0x5918
+    22ff:	50                   	push   %eax
+    2300:	e8 4e 28 00 00       	call   4b53 <write>
+  close(fd);
+    2305:	89 1c 24             	mov    %ebx,(%esp)
+    2308:	e8 4e 28 00 00       	call   4b5b <close>
+  if(unlink("dd") >= 0){
+    230d:	c7 04 24 b5 59 00 00 	movl   $0x59b5,(%esp)
+    2314:	e8 6a 28 00 00       	call   4b83 <unlink>
+    2319:	83 c4 10             	add    $0x10,%esp
+    231c:	85 c0                	test   %eax,%eax
+    231e:	0f 89 3f 05 00 00    	jns    2863 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2324:	83 ec 0c             	sub    $0xc,%esp
+    2327:	68 c9 58 00 00       	push   $0x58c9
+    232c:	e8 6a 28 00 00       	call   4b9b <mkdir>
+    2331:	83 c4 10             	add    $0x10,%esp
+    2334:	85 c0                	test   %eax,%eax
+    2336:	0f 85 14 05 00 00    	jne    2850 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    233c:	83 ec 08             	sub    $0x8,%esp
+    233f:	68 02 02 00 00       	push   $0x202
+    2344:	68 eb 58 00 00       	push   $0x58eb
+    2349:	e8 25 28 00 00       	call   4b73 <open>
+  if(fd < 0){
+    234e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2351:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2353:	85 c0                	test   %eax,%eax
+    2355:	0f 88 24 04 00 00    	js     277f <subdir+0x4df>
+  write(fd, "FF", 2);
+    235b:	83 ec 04             	sub    $0x4,%esp
+    235e:	6a 02                	push   $0x2
+    2360:	68 0c 59 00 00       	push   $0x590c
+    2365:	50                   	push   %eax
+    2366:	e8 e8 27 00 00       	call   4b53 <write>
+  close(fd);
+    236b:	89 1c 24             	mov    %ebx,(%esp)
+    236e:	e8 e8 27 00 00       	call   4b5b <close>
+  fd = open("dd/dd/../ff", 0);
+    2373:	58                   	pop    %eax
+    2374:	5a                   	pop    %edx
+    2375:	6a 00                	push   $0x0
+    2377:	68 0f 59 00 00       	push   $0x590f
+    237c:	e8 f2 27 00 00       	call   4b73 <open>
+  if(fd < 0){
+    2381:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    2384:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2386:	85 c0                	test   %eax,%eax
+    2388:	0f 88 de 03 00 00    	js     276c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    238e:	83 ec 04             	sub    $0x4,%esp
+    2391:	68 00 20 00 00       	push   $0x2000
+    2396:	68 80 a0 00 00       	push   $0xa080
+    239b:	50                   	push   %eax
+    239c:	e8 aa 27 00 00       	call   4b4b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    23a1:	83 c4 10             	add    $0x10,%esp
+    23a4:	83 f8 02             	cmp    $0x2,%eax
+    23a7:	0f 85 3a 03 00 00    	jne    26e7 <subdir+0x447>
+    23ad:	80 3d 80 a0 00 00 66 	cmpb   $0x66,0xa080
+    23b4:	0f 85 2d 03 00 00    	jne    26e7 <subdir+0x447>
+  close(fd);
+    23ba:	83 ec 0c             	sub    $0xc,%esp
+    23bd:	53                   	push   %ebx
+    23be:	e8 98 27 00 00       	call   4b5b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    23c3:	59                   	pop    %ecx
+    23c4:	5b                   	pop    %ebx
+    23c5:	68 4f 59 00 00       	push   $0x594f
+    23ca:	68 eb 58 00 00       	push   $0x58eb
+    23cf:	e8 bf 27 00 00       	call   4b93 <link>
+    23d4:	83 c4 10             	add    $0x10,%esp
+    23d7:	85 c0                	test   %eax,%eax
+    23d9:	0f 85 c6 03 00 00    	jne    27a5 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    23df:	83 ec 0c             	sub    $0xc,%esp
+    23e2:	68 eb 58 00 00       	push   $0x58eb
+    23e7:	e8 97 27 00 00       	call   4b83 <unlink>
+    23ec:	83 c4 10             	add    $0x10,%esp
+    23ef:	85 c0                	test   %eax,%eax
+    23f1:	0f 85 16 03 00 00    	jne    270d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    23f7:	83 ec 08             	sub    $0x8,%esp
+    23fa:	6a 00                	push   $0x0
+    23fc:	68 eb 58 00 00       	push   $0x58eb
+    2401:	e8 6d 27 00 00       	call   4b73 <open>
+    2406:	83 c4 10             	add    $0x10,%esp
+    2409:	85 c0                	test   %eax,%eax
+    240b:	0f 89 2c 04 00 00    	jns    283d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2411:	83 ec 0c             	sub    $0xc,%esp
+    2414:	68 b5 59 00 00       	push   $0x59b5
+    2419:	e8 85 27 00 00       	call   4ba3 <chdir>
+    241e:	83 c4 10             	add    $0x10,%esp
+    2421:	85 c0                	test   %eax,%eax
+    2423:	0f 85 01 04 00 00    	jne    282a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2429:	83 ec 0c             	sub    $0xc,%esp
+    242c:	68 83 59 00 00       	push   $0x5983
+    2431:	e8 6d 27 00 00       	call   4ba3 <chdir>
+    2436:	83 c4 10             	add    $0x10,%esp
+    2439:	85 c0                	test   %eax,%eax
+    243b:	0f 85 b9 02 00 00    	jne    26fa <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    2441:	83 ec 0c             	sub    $0xc,%esp
+    2444:	68 a9 59 00 00       	push   $0x59a9
+    2449:	e8 55 27 00 00       	call   4ba3 <chdir>
+    244e:	83 c4 10             	add    $0x10,%esp
+    2451:	85 c0                	test   %eax,%eax
+    2453:	0f 85 a1 02 00 00    	jne    26fa <subdir+0x45a>
+  if(chdir("./..") != 0){
+    2459:	83 ec 0c             	sub    $0xc,%esp
+    245c:	68 b8 59 00 00       	push   $0x59b8
+    2461:	e8 3d 27 00 00       	call   4ba3 <chdir>
+    2466:	83 c4 10             	add    $0x10,%esp
+    2469:	85 c0                	test   %eax,%eax
+    246b:	0f 85 21 03 00 00    	jne    2792 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    2471:	83 ec 08             	sub    $0x8,%esp
+    2474:	6a 00                	push   $0x0
+    2476:	68 4f 59 00 00       	push   $0x594f
+    247b:	e8 f3 26 00 00       	call   4b73 <open>
+  if(fd < 0){
+    2480:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2483:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2485:	85 c0                	test   %eax,%eax
+    2487:	0f 88 e0 04 00 00    	js     296d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    248d:	83 ec 04             	sub    $0x4,%esp
+    2490:	68 00 20 00 00       	push   $0x2000
+    2495:	68 80 a0 00 00       	push   $0xa080
+    249a:	50                   	push   %eax
+    249b:	e8 ab 26 00 00       	call   4b4b <read>
+    24a0:	83 c4 10             	add    $0x10,%esp
+    24a3:	83 f8 02             	cmp    $0x2,%eax
+    24a6:	0f 85 ae 04 00 00    	jne    295a <subdir+0x6ba>
+  close(fd);
+    24ac:	83 ec 0c             	sub    $0xc,%esp
+    24af:	53                   	push   %ebx
+    24b0:	e8 a6 26 00 00       	call   4b5b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    24b5:	58                   	pop    %eax
+    24b6:	5a                   	pop    %edx
+    24b7:	6a 00                	push   $0x0
+    24b9:	68 eb 58 00 00       	push   $0x58eb
+    24be:	e8 b0 26 00 00       	call   4b73 <open>
+    24c3:	83 c4 10             	add    $0x10,%esp
+    24c6:	85 c0                	test   %eax,%eax
+    24c8:	0f 89 65 02 00 00    	jns    2733 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    24ce:	83 ec 08             	sub    $0x8,%esp
+    24d1:	68 02 02 00 00       	push   $0x202
+    24d6:	68 03 5a 00 00       	push   $0x5a03
+    24db:	e8 93 26 00 00       	call   4b73 <open>
+    24e0:	83 c4 10             	add    $0x10,%esp
+    24e3:	85 c0                	test   %eax,%eax
+    24e5:	0f 89 35 02 00 00    	jns    2720 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    24eb:	83 ec 08             	sub    $0x8,%esp
+    24ee:	68 02 02 00 00       	push   $0x202
+    24f3:	68 28 5a 00 00       	push   $0x5a28
+    24f8:	e8 76 26 00 00       	call   4b73 <open>
+    24fd:	83 c4 10             	add    $0x10,%esp
+    2500:	85 c0                	test   %eax,%eax
+    2502:	0f 89 0f 03 00 00    	jns    2817 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2508:	83 ec 08             	sub    $0x8,%esp
+    250b:	68 00 02 00 00       	push   $0x200
+    2510:	68 b5 59 00 00       	push   $0x59b5
+    2515:	e8 59 26 00 00       	call   4b73 <open>
+    251a:	83 c4 10             	add    $0x10,%esp
+    251d:	85 c0                	test   %eax,%eax
+    251f:	0f 89 df 02 00 00    	jns    2804 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2525:	83 ec 08             	sub    $0x8,%esp
+    2528:	6a 02                	push   $0x2
+    252a:	68 b5 59 00 00       	push   $0x59b5
+    252f:	e8 3f 26 00 00       	call   4b73 <open>
+    2534:	83 c4 10             	add    $0x10,%esp
+    2537:	85 c0                	test   %eax,%eax
+    2539:	0f 89 b2 02 00 00    	jns    27f1 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    253f:	83 ec 08             	sub    $0x8,%esp
+    2542:	6a 01                	push   $0x1
+    2544:	68 b5 59 00 00       	push   $0x59b5
+    2549:	e8 25 26 00 00       	call   4b73 <open>
+    254e:	83 c4 10             	add    $0x10,%esp
+    2551:	85 c0                	test   %eax,%eax
+    2553:	0f 89 85 02 00 00    	jns    27de <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2559:	83 ec 08             	sub    $0x8,%esp
+    255c:	68 97 5a 00 00       	push   $0x5a97
+    2561:	68 03 5a 00 00       	push   $0x5a03
+    2566:	e8 28 26 00 00       	call   4b93 <link>
+    256b:	83 c4 10             	add    $0x10,%esp
+    256e:	85 c0                	test   %eax,%eax
+    2570:	0f 84 55 02 00 00    	je     27cb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2576:	83 ec 08             	sub    $0x8,%esp
+    2579:	68 97 5a 00 00       	push   $0x5a97
+    257e:	68 28 5a 00 00       	push   $0x5a28
+    2583:	e8 0b 26 00 00       	call   4b93 <link>
+    2588:	83 c4 10             	add    $0x10,%esp
+    258b:	85 c0                	test   %eax,%eax
+    258d:	0f 84 25 02 00 00    	je     27b8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2593:	83 ec 08             	sub    $0x8,%esp
+    2596:	68 4f 59 00 00       	push   $0x594f
+    259b:	68 ee 58 00 00       	push   $0x58ee
+    25a0:	e8 ee 25 00 00       	call   4b93 <link>
+    25a5:	83 c4 10             	add    $0x10,%esp
+    25a8:	85 c0                	test   %eax,%eax
+    25aa:	0f 84 a9 01 00 00    	je     2759 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    25b0:	83 ec 0c             	sub    $0xc,%esp
+    25b3:	68 03 5a 00 00       	push   $0x5a03
+    25b8:	e8 de 25 00 00       	call   4b9b <mkdir>
+    25bd:	83 c4 10             	add    $0x10,%esp
+    25c0:	85 c0                	test   %eax,%eax
+    25c2:	0f 84 7e 01 00 00    	je     2746 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    25c8:	83 ec 0c             	sub    $0xc,%esp
+    25cb:	68 28 5a 00 00       	push   $0x5a28
+    25d0:	e8 c6 25 00 00       	call   4b9b <mkdir>
+    25d5:	83 c4 10             	add    $0x10,%esp
+    25d8:	85 c0                	test   %eax,%eax
+    25da:	0f 84 67 03 00 00    	je     2947 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    25e0:	83 ec 0c             	sub    $0xc,%esp
+    25e3:	68 4f 59 00 00       	push   $0x594f
+    25e8:	e8 ae 25 00 00       	call   4b9b <mkdir>
+    25ed:	83 c4 10             	add    $0x10,%esp
+    25f0:	85 c0                	test   %eax,%eax
+    25f2:	0f 84 3c 03 00 00    	je     2934 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    25f8:	83 ec 0c             	sub    $0xc,%esp
+    25fb:	68 28 5a 00 00       	push   $0x5a28
+    2600:	e8 7e 25 00 00       	call   4b83 <unlink>
+    2605:	83 c4 10             	add    $0x10,%esp
+    2608:	85 c0                	test   %eax,%eax
+    260a:	0f 84 11 03 00 00    	je     2921 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2610:	83 ec 0c             	sub    $0xc,%esp
+    2613:	68 03 5a 00 00       	push   $0x5a03
+    2618:	e8 66 25 00 00       	call   4b83 <unlink>
+    261d:	83 c4 10             	add    $0x10,%esp
+    2620:	85 c0                	test   %eax,%eax
+    2622:	0f 84 e6 02 00 00    	je     290e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2628:	83 ec 0c             	sub    $0xc,%esp
+    262b:	68 ee 58 00 00       	push   $0x58ee
+    2630:	e8 6e 25 00 00       	call   4ba3 <chdir>
+    2635:	83 c4 10             	add    $0x10,%esp
+    2638:	85 c0                	test   %eax,%eax
+    263a:	0f 84 bb 02 00 00    	je     28fb <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2640:	83 ec 0c             	sub    $0xc,%esp
+    2643:	68 9a 5a 00 00       	push   $0x5a9a
+    2648:	e8 56 25 00 00       	call   4ba3 <chdir>
+    264d:	83 c4 10             	add    $0x10,%esp
+    2650:	85 c0                	test   %eax,%eax
+    2652:	0f 84 90 02 00 00    	je     28e8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2658:	83 ec 0c             	sub    $0xc,%esp
+    265b:	68 4f 59 00 00       	push   $0x594f
+    2660:	e8 1e 25 00 00       	call   4b83 <unlink>
+    2665:	83 c4 10             	add    $0x10,%esp
+    2668:	85 c0                	test   %eax,%eax
+    266a:	0f 85 9d 00 00 00    	jne    270d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2670:	83 ec 0c             	sub    $0xc,%esp
+    2673:	68 ee 58 00 00       	push   $0x58ee
+    2678:	e8 06 25 00 00       	call   4b83 <unlink>
+    267d:	83 c4 10             	add    $0x10,%esp
+    2680:	85 c0                	test   %eax,%eax
+    2682:	0f 85 4d 02 00 00    	jne    28d5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2688:	83 ec 0c             	sub    $0xc,%esp
+    268b:	68 b5 59 00 00       	push   $0x59b5
+    2690:	e8 ee 24 00 00       	call   4b83 <unlink>
+    2695:	83 c4 10             	add    $0x10,%esp
+    2698:	85 c0                	test   %eax,%eax
+    269a:	0f 84 22 02 00 00    	je     28c2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    26a0:	83 ec 0c             	sub    $0xc,%esp
+    26a3:	68 ca 58 00 00       	push   $0x58ca
+    26a8:	e8 d6 24 00 00       	call   4b83 <unlink>
+    26ad:	83 c4 10             	add    $0x10,%esp
+    26b0:	85 c0                	test   %eax,%eax
+    26b2:	0f 88 f7 01 00 00    	js     28af <subdir+0x60f>
+  if(unlink("dd") < 0){
+    26b8:	83 ec 0c             	sub    $0xc,%esp
+    26bb:	68 b5 59 00 00       	push   $0x59b5
+    26c0:	e8 be 24 00 00       	call   4b83 <unlink>
+    26c5:	83 c4 10             	add    $0x10,%esp
+    26c8:	85 c0                	test   %eax,%eax
+    26ca:	0f 88 cc 01 00 00    	js     289c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    26d0:	83 ec 08             	sub    $0x8,%esp
+    26d3:	68 97 5b 00 00       	push   $0x5b97
+    26d8:	6a 01                	push   $0x1
+    26da:	e8 e1 25 00 00       	call   4cc0 <printf>
+}
+    26df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    26e2:	83 c4 10             	add    $0x10,%esp
+    26e5:	c9                   	leave
+    26e6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    26e7:	50                   	push   %eax
+    26e8:	50                   	push   %eax
+    26e9:	68 34 59 00 00       	push   $0x5934
+    26ee:	6a 01                	push   $0x1
+    26f0:	e8 cb 25 00 00       	call   4cc0 <printf>
+    exit();
+    26f5:	e8 39 24 00 00       	call   4b33 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    26fa:	50                   	push   %eax
+    26fb:	50                   	push   %eax
+    26fc:	68 8f 59 00 00       	push   $0x598f
+    2701:	6a 01                	push   $0x1
+    2703:	e8 b8 25 00 00       	call   4cc0 <printf>
+    exit();
+    2708:	e8 26 24 00 00       	call   4b33 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    270d:	50                   	push   %eax
+    270e:	50                   	push   %eax
+    270f:	68 5a 59 00 00       	push   $0x595a
+    2714:	6a 01                	push   $0x1
+    2716:	e8 a5 25 00 00       	call   4cc0 <printf>
+    exit();
+    271b:	e8 13 24 00 00       	call   4b33 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2720:	51                   	push   %ecx
+    2721:	51                   	push   %ecx
+    2722:	68 0c 5a 00 00       	push   $0x5a0c
+    2727:	6a 01                	push   $0x1
+    2729:	e8 92 25 00 00       	call   4cc0 <printf>
+    exit();
+    272e:	e8 00 24 00 00       	call   4b33 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2733:	53                   	push   %ebx
+    2734:	53                   	push   %ebx
+    2735:	68 ec 67 00 00       	push   $0x67ec
+    273a:	6a 01                	push   $0x1
+    273c:	e8 7f 25 00 00       	call   4cc0 <printf>
+    exit();
+    2741:	e8 ed 23 00 00       	call   4b33 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2746:	51                   	push   %ecx
+    2747:	51                   	push   %ecx
+    2748:	68 a0 5a 00 00       	push   $0x5aa0
+    274d:	6a 01                	push   $0x1
+    274f:	e8 6c 25 00 00       	call   4cc0 <printf>
+    exit();
+    2754:	e8 da 23 00 00       	call   4b33 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2759:	53                   	push   %ebx
+    275a:	53                   	push   %ebx
+    275b:	68 5c 68 00 00       	push   $0x685c
+    2760:	6a 01                	push   $0x1
+    2762:	e8 59 25 00 00       	call   4cc0 <printf>
+    exit();
+    2767:	e8 c7 23 00 00       	call   4b33 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    276c:	50                   	push   %eax
+    276d:	50                   	push   %eax
+    276e:	68 1b 59 00 00       	push   $0x591b
+    2773:	6a 01                	push   $0x1
+    2775:	e8 46 25 00 00       	call   4cc0 <printf>
+    exit();
+    277a:	e8 b4 23 00 00       	call   4b33 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    277f:	51                   	push   %ecx
+    2780:	51                   	push   %ecx
+    2781:	68 f4 58 00 00       	push   $0x58f4
+    2786:	6a 01                	push   $0x1
+    2788:	e8 33 25 00 00       	call   4cc0 <printf>
+    exit();
+    278d:	e8 a1 23 00 00       	call   4b33 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2792:	50                   	push   %eax
+    2793:	50                   	push   %eax
+    2794:	68 bd 59 00 00       	push   $0x59bd
+    2799:	6a 01                	push   $0x1
+    279b:	e8 20 25 00 00       	call   4cc0 <printf>
+    exit();
+    27a0:	e8 8e 23 00 00       	call   4b33 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    27a5:	52                   	push   %edx
+    27a6:	52                   	push   %edx
+    27a7:	68 a4 67 00 00       	push   $0x67a4
+    27ac:	6a 01                	push   $0x1
+    27ae:	e8 0d 25 00 00       	call   4cc0 <printf>
+    exit();
+    27b3:	e8 7b 23 00 00       	call   4b33 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    27b8:	50                   	push   %eax
+    27b9:	50                   	push   %eax
+    27ba:	68 38 68 00 00       	push   $0x6838
+    27bf:	6a 01                	push   $0x1
+    27c1:	e8 fa 24 00 00       	call   4cc0 <printf>
+    exit();
+    27c6:	e8 68 23 00 00       	call   4b33 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    27cb:	50                   	push   %eax
+    27cc:	50                   	push   %eax
+    27cd:	68 14 68 00 00       	push   $0x6814
+    27d2:	6a 01                	push   $0x1
+    27d4:	e8 e7 24 00 00       	call   4cc0 <printf>
+    exit();
+    27d9:	e8 55 23 00 00       	call   4b33 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    27de:	50                   	push   %eax
+    27df:	50                   	push   %eax
+    27e0:	68 7c 5a 00 00       	push   $0x5a7c
+    27e5:	6a 01                	push   $0x1
+    27e7:	e8 d4 24 00 00       	call   4cc0 <printf>
+    exit();
+    27ec:	e8 42 23 00 00       	call   4b33 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    27f1:	50                   	push   %eax
+    27f2:	50                   	push   %eax
+    27f3:	68 63 5a 00 00       	push   $0x5a63
+    27f8:	6a 01                	push   $0x1
+    27fa:	e8 c1 24 00 00       	call   4cc0 <printf>
+    exit();
+    27ff:	e8 2f 23 00 00       	call   4b33 <exit>
+    printf(1, "create dd succeeded!\n");
+    2804:	50                   	push   %eax
+    2805:	50                   	push   %eax
+    2806:	68 4d 5a 00 00       	push   $0x5a4d
+    280b:	6a 01                	push   $0x1
+    280d:	e8 ae 24 00 00       	call   4cc0 <printf>
+    exit();
+    2812:	e8 1c 23 00 00       	call   4b33 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2817:	52                   	push   %edx
+    2818:	52                   	push   %edx
+    2819:	68 31 5a 00 00       	push   $0x5a31
+    281e:	6a 01                	push   $0x1
+    2820:	e8 9b 24 00 00       	call   4cc0 <printf>
+    exit();
+    2825:	e8 09 23 00 00       	call   4b33 <exit>
+    printf(1, "chdir dd failed\n");
+    282a:	50                   	push   %eax
+    282b:	50                   	push   %eax
+    282c:	68 72 59 00 00       	push   $0x5972
+    2831:	6a 01                	push   $0x1
+    2833:	e8 88 24 00 00       	call   4cc0 <printf>
+    exit();
+    2838:	e8 f6 22 00 00       	call   4b33 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    283d:	50                   	push   %eax
+    283e:	50                   	push   %eax
+    283f:	68 c8 67 00 00       	push   $0x67c8
+    2844:	6a 01                	push   $0x1
+    2846:	e8 75 24 00 00       	call   4cc0 <printf>
+    exit();
+    284b:	e8 e3 22 00 00       	call   4b33 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2850:	53                   	push   %ebx
+    2851:	53                   	push   %ebx
+    2852:	68 d0 58 00 00       	push   $0x58d0
+    2857:	6a 01                	push   $0x1
+    2859:	e8 62 24 00 00       	call   4cc0 <printf>
+    exit();
+    285e:	e8 d0 22 00 00       	call   4b33 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2863:	50                   	push   %eax
+    2864:	50                   	push   %eax
+    2865:	68 7c 67 00 00       	push   $0x677c
+    286a:	6a 01                	push   $0x1
+    286c:	e8 4f 24 00 00       	call   4cc0 <printf>
+    exit();
+    2871:	e8 bd 22 00 00       	call   4b33 <exit>
+    printf(1, "create dd/ff failed\n");
+    2876:	50                   	push   %eax
+    2877:	50                   	push   %eax
+    2878:	68 b4 58 00 00       	push   $0x58b4
+    287d:	6a 01                	push   $0x1
+    287f:	e8 3c 24 00 00       	call   4cc0 <printf>
+    exit();
+    2884:	e8 aa 22 00 00       	call   4b33 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2889:	50                   	push   %eax
+    288a:	50                   	push   %eax
+    288b:	68 9c 58 00 00       	push   $0x589c
+    2890:	6a 01                	push   $0x1
+    2892:	e8 29 24 00 00       	call   4cc0 <printf>
+    exit();
+    2897:	e8 97 22 00 00       	call   4b33 <exit>
+    printf(1, "unlink dd failed\n");
+    289c:	50                   	push   %eax
+    289d:	50                   	push   %eax
+    289e:	68 85 5b 00 00       	push   $0x5b85
+    28a3:	6a 01                	push   $0x1
+    28a5:	e8 16 24 00 00       	call   4cc0 <printf>
+    exit();
+    28aa:	e8 84 22 00 00       	call   4b33 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    28af:	52                   	push   %edx
+    28b0:	52                   	push   %edx
+    28b1:	68 70 5b 00 00       	push   $0x5b70
+    28b6:	6a 01                	push   $0x1
+    28b8:	e8 03 24 00 00       	call   4cc0 <printf>
+    exit();
+    28bd:	e8 71 22 00 00       	call   4b33 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    28c2:	51                   	push   %ecx
+    28c3:	51                   	push   %ecx
+    28c4:	68 80 68 00 00       	push   $0x6880
+    28c9:	6a 01                	push   $0x1
+    28cb:	e8 f0 23 00 00       	call   4cc0 <printf>
+    exit();
+    28d0:	e8 5e 22 00 00       	call   4b33 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    28d5:	53                   	push   %ebx
+    28d6:	53                   	push   %ebx
+    28d7:	68 5b 5b 00 00       	push   $0x5b5b
+    28dc:	6a 01                	push   $0x1
+    28de:	e8 dd 23 00 00       	call   4cc0 <printf>
+    exit();
+    28e3:	e8 4b 22 00 00       	call   4b33 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    28e8:	50                   	push   %eax
+    28e9:	50                   	push   %eax
+    28ea:	68 43 5b 00 00       	push   $0x5b43
+    28ef:	6a 01                	push   $0x1
+    28f1:	e8 ca 23 00 00       	call   4cc0 <printf>
+    exit();
+    28f6:	e8 38 22 00 00       	call   4b33 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    28fb:	50                   	push   %eax
+    28fc:	50                   	push   %eax
+    28fd:	68 2b 5b 00 00       	push   $0x5b2b
+    2902:	6a 01                	push   $0x1
+    2904:	e8 b7 23 00 00       	call   4cc0 <printf>
+    exit();
+    2909:	e8 25 22 00 00       	call   4b33 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    290e:	50                   	push   %eax
+    290f:	50                   	push   %eax
+    2910:	68 0f 5b 00 00       	push   $0x5b0f
+    2915:	6a 01                	push   $0x1
+    2917:	e8 a4 23 00 00       	call   4cc0 <printf>
+    exit();
+    291c:	e8 12 22 00 00       	call   4b33 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2921:	50                   	push   %eax
+    2922:	50                   	push   %eax
+    2923:	68 f3 5a 00 00       	push   $0x5af3
+    2928:	6a 01                	push   $0x1
+    292a:	e8 91 23 00 00       	call   4cc0 <printf>
+    exit();
+    292f:	e8 ff 21 00 00       	call   4b33 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2934:	50                   	push   %eax
+    2935:	50                   	push   %eax
+    2936:	68 d6 5a 00 00       	push   $0x5ad6
+    293b:	6a 01                	push   $0x1
+    293d:	e8 7e 23 00 00       	call   4cc0 <printf>
+    exit();
+    2942:	e8 ec 21 00 00       	call   4b33 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2947:	52                   	push   %edx
+    2948:	52                   	push   %edx
+    2949:	68 bb 5a 00 00       	push   $0x5abb
+    294e:	6a 01                	push   $0x1
+    2950:	e8 6b 23 00 00       	call   4cc0 <printf>
+    exit();
+    2955:	e8 d9 21 00 00       	call   4b33 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    295a:	51                   	push   %ecx
+    295b:	51                   	push   %ecx
+    295c:	68 e8 59 00 00       	push   $0x59e8
+    2961:	6a 01                	push   $0x1
+    2963:	e8 58 23 00 00       	call   4cc0 <printf>
+    exit();
+    2968:	e8 c6 21 00 00       	call   4b33 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    296d:	53                   	push   %ebx
+    296e:	53                   	push   %ebx
+    296f:	68 d0 59 00 00       	push   $0x59d0
+    2974:	6a 01                	push   $0x1
+    2976:	e8 45 23 00 00       	call   4cc0 <printf>
+    exit();
+    297b:	e8 b3 21 00 00       	call   4b33 <exit>
+
+00002980 <bigwrite>:
+{
+    2980:	55                   	push   %ebp
+    2981:	89 e5                	mov    %esp,%ebp
+    2983:	56                   	push   %esi
+    2984:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2985:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    298a:	83 ec 08             	sub    $0x8,%esp
+    298d:	68 a2 5b 00 00       	push   $0x5ba2
+    2992:	6a 01                	push   $0x1
+    2994:	e8 27 23 00 00       	call   4cc0 <printf>
+  unlink("bigwrite");
+    2999:	c7 04 24 b1 5b 00 00 	movl   $0x5bb1,(%esp)
+    29a0:	e8 de 21 00 00       	call   4b83 <unlink>
+    29a5:	83 c4 10             	add    $0x10,%esp
+    29a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29af:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    29b0:	83 ec 08             	sub    $0x8,%esp
+    29b3:	68 02 02 00 00       	push   $0x202
+    29b8:	68 b1 5b 00 00       	push   $0x5bb1
+    29bd:	e8 b1 21 00 00       	call   4b73 <open>
+    if(fd < 0){
+    29c2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    29c5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    29c7:	85 c0                	test   %eax,%eax
+    29c9:	78 7e                	js     2a49 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    29cb:	83 ec 04             	sub    $0x4,%esp
+    29ce:	53                   	push   %ebx
+    29cf:	68 80 a0 00 00       	push   $0xa080
+    29d4:	50                   	push   %eax
+    29d5:	e8 79 21 00 00       	call   4b53 <write>
+      if(cc != sz){
+    29da:	83 c4 10             	add    $0x10,%esp
+    29dd:	39 d8                	cmp    %ebx,%eax
+    29df:	75 55                	jne    2a36 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    29e1:	83 ec 04             	sub    $0x4,%esp
+    29e4:	53                   	push   %ebx
+    29e5:	68 80 a0 00 00       	push   $0xa080
+    29ea:	56                   	push   %esi
+    29eb:	e8 63 21 00 00       	call   4b53 <write>
+      if(cc != sz){
+    29f0:	83 c4 10             	add    $0x10,%esp
+    29f3:	39 c3                	cmp    %eax,%ebx
+    29f5:	75 3f                	jne    2a36 <bigwrite+0xb6>
+    close(fd);
+    29f7:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    29fa:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2a00:	56                   	push   %esi
+    2a01:	e8 55 21 00 00       	call   4b5b <close>
+    unlink("bigwrite");
+    2a06:	c7 04 24 b1 5b 00 00 	movl   $0x5bb1,(%esp)
+    2a0d:	e8 71 21 00 00       	call   4b83 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2a12:	83 c4 10             	add    $0x10,%esp
+    2a15:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    2a1b:	75 93                	jne    29b0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    2a1d:	83 ec 08             	sub    $0x8,%esp
+    2a20:	68 e4 5b 00 00       	push   $0x5be4
+    2a25:	6a 01                	push   $0x1
+    2a27:	e8 94 22 00 00       	call   4cc0 <printf>
+}
+    2a2c:	83 c4 10             	add    $0x10,%esp
+    2a2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2a32:	5b                   	pop    %ebx
+    2a33:	5e                   	pop    %esi
+    2a34:	5d                   	pop    %ebp
+    2a35:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2a36:	50                   	push   %eax
+    2a37:	53                   	push   %ebx
+    2a38:	68 d2 5b 00 00       	push   $0x5bd2
+    2a3d:	6a 01                	push   $0x1
+    2a3f:	e8 7c 22 00 00       	call   4cc0 <printf>
+        exit();
+    2a44:	e8 ea 20 00 00       	call   4b33 <exit>
+      printf(1, "cannot create bigwrite\n");
+    2a49:	83 ec 08             	sub    $0x8,%esp
+    2a4c:	68 ba 5b 00 00       	push   $0x5bba
+    2a51:	6a 01                	push   $0x1
+    2a53:	e8 68 22 00 00       	call   4cc0 <printf>
+      exit();
+    2a58:	e8 d6 20 00 00       	call   4b33 <exit>
+    2a5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002a60 <bigfile>:
+{
+    2a60:	55                   	push   %ebp
+    2a61:	89 e5                	mov    %esp,%ebp
+    2a63:	57                   	push   %edi
+    2a64:	56                   	push   %esi
+    2a65:	53                   	push   %ebx
+    2a66:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    2a69:	68 f1 5b 00 00       	push   $0x5bf1
+    2a6e:	6a 01                	push   $0x1
+    2a70:	e8 4b 22 00 00       	call   4cc0 <printf>
+  unlink("bigfile");
+    2a75:	c7 04 24 0d 5c 00 00 	movl   $0x5c0d,(%esp)
+    2a7c:	e8 02 21 00 00       	call   4b83 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2a81:	58                   	pop    %eax
+    2a82:	5a                   	pop    %edx
+    2a83:	68 02 02 00 00       	push   $0x202
+    2a88:	68 0d 5c 00 00       	push   $0x5c0d
+    2a8d:	e8 e1 20 00 00       	call   4b73 <open>
+  if(fd < 0){
+    2a92:	83 c4 10             	add    $0x10,%esp
+    2a95:	85 c0                	test   %eax,%eax
+    2a97:	0f 88 5e 01 00 00    	js     2bfb <bigfile+0x19b>
+    2a9d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    2a9f:	31 db                	xor    %ebx,%ebx
+    2aa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2aa8:	83 ec 04             	sub    $0x4,%esp
+    2aab:	68 58 02 00 00       	push   $0x258
+    2ab0:	53                   	push   %ebx
+    2ab1:	68 80 a0 00 00       	push   $0xa080
+    2ab6:	e8 f5 1e 00 00       	call   49b0 <memset>
+    if(write(fd, buf, 600) != 600){
+    2abb:	83 c4 0c             	add    $0xc,%esp
+    2abe:	68 58 02 00 00       	push   $0x258
+    2ac3:	68 80 a0 00 00       	push   $0xa080
+    2ac8:	56                   	push   %esi
+    2ac9:	e8 85 20 00 00       	call   4b53 <write>
+    2ace:	83 c4 10             	add    $0x10,%esp
+    2ad1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2ad6:	0f 85 f8 00 00 00    	jne    2bd4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    2adc:	83 c3 01             	add    $0x1,%ebx
+    2adf:	83 fb 14             	cmp    $0x14,%ebx
+    2ae2:	75 c4                	jne    2aa8 <bigfile+0x48>
+  close(fd);
+    2ae4:	83 ec 0c             	sub    $0xc,%esp
+    2ae7:	56                   	push   %esi
+    2ae8:	e8 6e 20 00 00       	call   4b5b <close>
+  fd = open("bigfile", 0);
+    2aed:	5e                   	pop    %esi
+    2aee:	5f                   	pop    %edi
+    2aef:	6a 00                	push   $0x0
+    2af1:	68 0d 5c 00 00       	push   $0x5c0d
+    2af6:	e8 78 20 00 00       	call   4b73 <open>
+  if(fd < 0){
+    2afb:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    2afe:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2b00:	85 c0                	test   %eax,%eax
+    2b02:	0f 88 e0 00 00 00    	js     2be8 <bigfile+0x188>
+  total = 0;
+    2b08:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    2b0a:	31 ff                	xor    %edi,%edi
+    2b0c:	eb 30                	jmp    2b3e <bigfile+0xde>
+    2b0e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2b10:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2b15:	0f 85 91 00 00 00    	jne    2bac <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    2b1b:	89 fa                	mov    %edi,%edx
+    2b1d:	0f be 05 80 a0 00 00 	movsbl 0xa080,%eax
+    2b24:	d1 fa                	sar    %edx
+    2b26:	39 d0                	cmp    %edx,%eax
+    2b28:	75 6e                	jne    2b98 <bigfile+0x138>
+    2b2a:	0f be 15 ab a1 00 00 	movsbl 0xa1ab,%edx
+    2b31:	39 d0                	cmp    %edx,%eax
+    2b33:	75 63                	jne    2b98 <bigfile+0x138>
+    total += cc;
+    2b35:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    2b3b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    2b3e:	83 ec 04             	sub    $0x4,%esp
+    2b41:	68 2c 01 00 00       	push   $0x12c
+    2b46:	68 80 a0 00 00       	push   $0xa080
+    2b4b:	56                   	push   %esi
+    2b4c:	e8 fa 1f 00 00       	call   4b4b <read>
+    if(cc < 0){
+    2b51:	83 c4 10             	add    $0x10,%esp
+    2b54:	85 c0                	test   %eax,%eax
+    2b56:	78 68                	js     2bc0 <bigfile+0x160>
+    if(cc == 0)
+    2b58:	75 b6                	jne    2b10 <bigfile+0xb0>
+  close(fd);
+    2b5a:	83 ec 0c             	sub    $0xc,%esp
+    2b5d:	56                   	push   %esi
+    2b5e:	e8 f8 1f 00 00       	call   4b5b <close>
+  if(total != 20*600){
+    2b63:	83 c4 10             	add    $0x10,%esp
+    2b66:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    2b6c:	0f 85 9c 00 00 00    	jne    2c0e <bigfile+0x1ae>
+  unlink("bigfile");
+    2b72:	83 ec 0c             	sub    $0xc,%esp
+    2b75:	68 0d 5c 00 00       	push   $0x5c0d
+    2b7a:	e8 04 20 00 00       	call   4b83 <unlink>
+  printf(1, "bigfile test ok\n");
+    2b7f:	58                   	pop    %eax
+    2b80:	5a                   	pop    %edx
+    2b81:	68 9c 5c 00 00       	push   $0x5c9c
+    2b86:	6a 01                	push   $0x1
+    2b88:	e8 33 21 00 00       	call   4cc0 <printf>
+}
+    2b8d:	83 c4 10             	add    $0x10,%esp
+    2b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2b93:	5b                   	pop    %ebx
+    2b94:	5e                   	pop    %esi
+    2b95:	5f                   	pop    %edi
+    2b96:	5d                   	pop    %ebp
+    2b97:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2b98:	83 ec 08             	sub    $0x8,%esp
+    2b9b:	68 69 5c 00 00       	push   $0x5c69
+    2ba0:	6a 01                	push   $0x1
+    2ba2:	e8 19 21 00 00       	call   4cc0 <printf>
+      exit();
+    2ba7:	e8 87 1f 00 00       	call   4b33 <exit>
+      printf(1, "short read bigfile\n");
+    2bac:	83 ec 08             	sub    $0x8,%esp
+    2baf:	68 55 5c 00 00       	push   $0x5c55
+    2bb4:	6a 01                	push   $0x1
+    2bb6:	e8 05 21 00 00       	call   4cc0 <printf>
+      exit();
+    2bbb:	e8 73 1f 00 00       	call   4b33 <exit>
+      printf(1, "read bigfile failed\n");
+    2bc0:	83 ec 08             	sub    $0x8,%esp
+    2bc3:	68 40 5c 00 00       	push   $0x5c40
+    2bc8:	6a 01                	push   $0x1
+    2bca:	e8 f1 20 00 00       	call   4cc0 <printf>
+      exit();
+    2bcf:	e8 5f 1f 00 00       	call   4b33 <exit>
+      printf(1, "write bigfile failed\n");
+    2bd4:	83 ec 08             	sub    $0x8,%esp
+    2bd7:	68 15 5c 00 00       	push   $0x5c15
+    2bdc:	6a 01                	push   $0x1
+    2bde:	e8 dd 20 00 00       	call   4cc0 <printf>
+      exit();
+    2be3:	e8 4b 1f 00 00       	call   4b33 <exit>
+    printf(1, "cannot open bigfile\n");
+    2be8:	53                   	push   %ebx
+    2be9:	53                   	push   %ebx
+    2bea:	68 2b 5c 00 00       	push   $0x5c2b
+    2bef:	6a 01                	push   $0x1
+    2bf1:	e8 ca 20 00 00       	call   4cc0 <printf>
+    exit();
+    2bf6:	e8 38 1f 00 00       	call   4b33 <exit>
+    printf(1, "cannot create bigfile");
+    2bfb:	50                   	push   %eax
+    2bfc:	50                   	push   %eax
+    2bfd:	68 ff 5b 00 00       	push   $0x5bff
+    2c02:	6a 01                	push   $0x1
+    2c04:	e8 b7 20 00 00       	call   4cc0 <printf>
+    exit();
+    2c09:	e8 25 1f 00 00       	call   4b33 <exit>
+    printf(1, "read bigfile wrong total\n");
+    2c0e:	51                   	push   %ecx
+    2c0f:	51                   	push   %ecx
+    2c10:	68 82 5c 00 00       	push   $0x5c82
+    2c15:	6a 01                	push   $0x1
+    2c17:	e8 a4 20 00 00       	call   4cc0 <printf>
+    exit();
+    2c1c:	e8 12 1f 00 00       	call   4b33 <exit>
+    2c21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c2f:	90                   	nop
+
+00002c30 <dcachetest>:
+{
+    2c30:	55                   	push   %ebp
+    2c31:	89 e5                	mov    %esp,%ebp
+    2c33:	53                   	push   %ebx
+  mkdir("dcd");
+    2c34:	bb 03 00 00 00       	mov    $0x3,%ebx
+{
+    2c39:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dcache test\n");
+    2c3c:	68 ad 5c 00 00       	push   $0x5cad
+    2c41:	6a 01                	push   $0x1
+    2c43:	e8 78 20 00 00       	call   4cc0 <printf>
+  mkdir("dcd");
+    2c48:	c7 04 24 ba 5c 00 00 	movl   $0x5cba,(%esp)
+    2c4f:	e8 47 1f 00 00       	call   4b9b <mkdir>
+    2c54:	83 c4 10             	add    $0x10,%esp
+    if(open("dcd/f", O_RDONLY) >= 0){
+    2c57:	83 ec 08             	sub    $0x8,%esp
+    2c5a:	6a 00                	push   $0x0
+    2c5c:	68 be 5c 00 00       	push   $0x5cbe
+    2c61:	e8 0d 1f 00 00       	call   4b73 <open>
+    2c66:	83 c4 10             	add    $0x10,%esp
+    2c69:	85 c0                	test   %eax,%eax
+    2c6b:	0f 89 f2 00 00 00    	jns    2d63 <dcachetest+0x133>
+    if((fd = open("dcd/f", O_CREATE|O_RDWR)) < 0){
+    2c71:	83 ec 08             	sub    $0x8,%esp
+    2c74:	68 02 02 00 00       	push   $0x202
+    2c79:	68 be 5c 00 00       	push   $0x5cbe
+    2c7e:	e8 f0 1e 00 00       	call   4b73 <open>
+    2c83:	83 c4 10             	add    $0x10,%esp
+    2c86:	85 c0                	test   %eax,%eax
+    2c88:	0f 88 11 01 00 00    	js     2d9f <dcachetest+0x16f>
+    close(fd);
+    2c8e:	83 ec 0c             	sub    $0xc,%esp
+    2c91:	50                   	push   %eax
+    2c92:	e8 c4 1e 00 00       	call   4b5b <close>
+    if((fd = open("dcd/f", O_RDONLY)) < 0){
+    2c97:	59                   	pop    %ecx
+    2c98:	58                   	pop    %eax
+    2c99:	6a 00                	push   $0x0
+    2c9b:	68 be 5c 00 00       	push   $0x5cbe
+    2ca0:	e8 ce 1e 00 00       	call   4b73 <open>
+    2ca5:	83 c4 10             	add    $0x10,%esp
+    2ca8:	85 c0                	test   %eax,%eax
+    2caa:	0f 88 db 00 00 00    	js     2d8b <dcachetest+0x15b>
+    close(fd);
+    2cb0:	83 ec 0c             	sub    $0xc,%esp
+    2cb3:	50                   	push   %eax
+    2cb4:	e8 a2 1e 00 00       	call   4b5b <close>
+    if(unlink("dcd/f") < 0){
+    2cb9:	c7 04 24 be 5c 00 00 	movl   $0x5cbe,(%esp)
+    2cc0:	e8 be 1e 00 00       	call   4b83 <unlink>
+    2cc5:	83 c4 10             	add    $0x10,%esp
+    2cc8:	85 c0                	test   %eax,%eax
+    2cca:	0f 88 a7 00 00 00    	js     2d77 <dcachetest+0x147>
+  for(i = 0; i < 3; i++){
+    2cd0:	83 eb 01             	sub    $0x1,%ebx
+    2cd3:	75 82                	jne    2c57 <dcachetest+0x27>
+  mkdir("dcd/d");
+    2cd5:	83 ec 0c             	sub    $0xc,%esp
+    2cd8:	68 f2 5c 00 00       	push   $0x5cf2
+    2cdd:	e8 b9 1e 00 00       	call   4b9b <mkdir>
+  close(open("dcd/d/x", O_CREATE|O_RDWR));
+    2ce2:	5b                   	pop    %ebx
+    2ce3:	58                   	pop    %eax
+    2ce4:	68 02 02 00 00       	push   $0x202
+    2ce9:	68 f8 5c 00 00       	push   $0x5cf8
+    2cee:	e8 80 1e 00 00       	call   4b73 <open>
+    2cf3:	89 04 24             	mov    %eax,(%esp)
+    2cf6:	e8 60 1e 00 00       	call   4b5b <close>
+  unlink("dcd/d/x");
+    2cfb:	c7 04 24 f8 5c 00 00 	movl   $0x5cf8,(%esp)
+    2d02:	e8 7c 1e 00 00       	call   4b83 <unlink>
+  unlink("dcd/d");
+    2d07:	c7 04 24 f2 5c 00 00 	movl   $0x5cf2,(%esp)
+    2d0e:	e8 70 1e 00 00       	call   4b83 <unlink>
+  mkdir("dcd/e");
+    2d13:	c7 04 24 00 5d 00 00 	movl   $0x5d00,(%esp)
+    2d1a:	e8 7c 1e 00 00       	call   4b9b <mkdir>
+  if(open("dcd/e/x", O_RDONLY) >= 0){
+    2d1f:	58                   	pop    %eax
+    2d20:	5a                   	pop    %edx
+    2d21:	6a 00                	push   $0x0
+    2d23:	68 06 5d 00 00       	push   $0x5d06
+    2d28:	e8 46 1e 00 00       	call   4b73 <open>
+    2d2d:	83 c4 10             	add    $0x10,%esp
+    2d30:	85 c0                	test   %eax,%eax
+    2d32:	79 7f                	jns    2db3 <dcachetest+0x183>
+  unlink("dcd/e");
+    2d34:	83 ec 0c             	sub    $0xc,%esp
+    2d37:	68 00 5d 00 00       	push   $0x5d00
+    2d3c:	e8 42 1e 00 00       	call   4b83 <unlink>
+  unlink("dcd");
+    2d41:	c7 04 24 ba 5c 00 00 	movl   $0x5cba,(%esp)
+    2d48:	e8 36 1e 00 00       	call   4b83 <unlink>
+  printf(1, "dcache ok\n");
+    2d4d:	58                   	pop    %eax
+    2d4e:	5a                   	pop    %edx
+    2d4f:	68 0e 5d 00 00       	push   $0x5d0e
+    2d54:	6a 01                	push   $0x1
+    2d56:	e8 65 1f 00 00       	call   4cc0 <printf>
+}
+    2d5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d5e:	83 c4 10             	add    $0x10,%esp
+    2d61:	c9                   	leave
+    2d62:	c3                   	ret
+      printf(1, "dcache: open of missing file succeeded\n");
+    2d63:	83 ec 08             	sub    $0x8,%esp
+    2d66:	68 a0 68 00 00       	push   $0x68a0
+    2d6b:	6a 01                	push   $0x1
+    2d6d:	e8 4e 1f 00 00       	call   4cc0 <printf>
+      exit();
+    2d72:	e8 bc 1d 00 00       	call   4b33 <exit>
+      printf(1, "dcache: unlink failed\n");
+    2d77:	83 ec 08             	sub    $0x8,%esp
+    2d7a:	68 db 5c 00 00       	push   $0x5cdb
+    2d7f:	6a 01                	push   $0x1
+    2d81:	e8 3a 1f 00 00       	call   4cc0 <printf>
+      exit();
+    2d86:	e8 a8 1d 00 00       	call   4b33 <exit>
+      printf(1, "dcache: open of new file failed\n");
+    2d8b:	83 ec 08             	sub    $0x8,%esp
+    2d8e:	68 c8 68 00 00       	push   $0x68c8
+    2d93:	6a 01                	push   $0x1
+    2d95:	e8 26 1f 00 00       	call   4cc0 <printf>
+      exit();
+    2d9a:	e8 94 1d 00 00       	call   4b33 <exit>
+      printf(1, "dcache: create failed\n");
+    2d9f:	83 ec 08             	sub    $0x8,%esp
+    2da2:	68 c4 5c 00 00       	push   $0x5cc4
+    2da7:	6a 01                	push   $0x1
+    2da9:	e8 12 1f 00 00       	call   4cc0 <printf>
+      exit();
+    2dae:	e8 80 1d 00 00       	call   4b33 <exit>
+    printf(1, "dcache: stale entry of removed directory\n");
+    2db3:	51                   	push   %ecx
+    2db4:	51                   	push   %ecx
+    2db5:	68 ec 68 00 00       	push   $0x68ec
+    2dba:	6a 01                	push   $0x1
+    2dbc:	e8 ff 1e 00 00       	call   4cc0 <printf>
+    exit();
+    2dc1:	e8 6d 1d 00 00       	call   4b33 <exit>
+    2dc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2dcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002dd0 <hashdir>:
+{
+    2dd0:	55                   	push   %ebp
+    2dd1:	89 e5                	mov    %esp,%ebp
+    2dd3:	57                   	push   %edi
+    2dd4:	56                   	push   %esi
+    2dd5:	53                   	push   %ebx
+    2dd6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "hashdir test\n");
+    2dd9:	68 19 5d 00 00       	push   $0x5d19
+    2dde:	6a 01                	push   $0x1
+    2de0:	e8 db 1e 00 00       	call   4cc0 <printf>
+  if(mkdir("hd") < 0){
+    2de5:	c7 04 24 27 5d 00 00 	movl   $0x5d27,(%esp)
+    2dec:	e8 aa 1d 00 00       	call   4b9b <mkdir>
+    2df1:	83 c4 10             	add    $0x10,%esp
+    2df4:	85 c0                	test   %eax,%eax
+    2df6:	0f 88 db 01 00 00    	js     2fd7 <hashdir+0x207>
+  if((fd = open("hd/f", O_CREATE|O_RDWR)) < 0){
+    2dfc:	83 ec 08             	sub    $0x8,%esp
+    2dff:	68 02 02 00 00       	push   $0x202
+    2e04:	68 41 5d 00 00       	push   $0x5d41
+    2e09:	e8 65 1d 00 00       	call   4b73 <open>
+    2e0e:	83 c4 10             	add    $0x10,%esp
+    2e11:	85 c0                	test   %eax,%eax
+    2e13:	0f 88 ab 01 00 00    	js     2fc4 <hashdir+0x1f4>
+  close(fd);
+    2e19:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 300; i++){
+    2e1c:	31 ff                	xor    %edi,%edi
+    name[3] = 'a' + i / 26;
+    2e1e:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+  close(fd);
+    2e23:	50                   	push   %eax
+    2e24:	e8 32 1d 00 00       	call   4b5b <close>
+  strcpy(name, "hd/xx");
+    2e29:	59                   	pop    %ecx
+    2e2a:	5b                   	pop    %ebx
+    2e2b:	8d 5d e0             	lea    -0x20(%ebp),%ebx
+    2e2e:	68 5e 5d 00 00       	push   $0x5d5e
+    2e33:	53                   	push   %ebx
+    2e34:	e8 b7 1a 00 00       	call   48f0 <strcpy>
+    2e39:	83 c4 10             	add    $0x10,%esp
+    2e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    name[3] = 'a' + i / 26;
+    2e40:	89 f8                	mov    %edi,%eax
+    if(link("hd/f", name) < 0){
+    2e42:	83 ec 08             	sub    $0x8,%esp
+    name[3] = 'a' + i / 26;
+    2e45:	f7 e6                	mul    %esi
+    2e47:	c1 ea 03             	shr    $0x3,%edx
+    2e4a:	8d 42 61             	lea    0x61(%edx),%eax
+    name[4] = 'a' + i % 26;
+    2e4d:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    name[3] = 'a' + i / 26;
+    2e50:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    name[4] = 'a' + i % 26;
+    2e53:	89 f8                	mov    %edi,%eax
+    2e55:	29 d0                	sub    %edx,%eax
+    2e57:	83 c0 61             	add    $0x61,%eax
+    2e5a:	88 45 e4             	mov    %al,-0x1c(%ebp)
+    if(link("hd/f", name) < 0){
+    2e5d:	53                   	push   %ebx
+    2e5e:	68 41 5d 00 00       	push   $0x5d41
+    2e63:	e8 2b 1d 00 00       	call   4b93 <link>
+    2e68:	83 c4 10             	add    $0x10,%esp
+    2e6b:	85 c0                	test   %eax,%eax
+    2e6d:	0f 88 ec 00 00 00    	js     2f5f <hashdir+0x18f>
+  for(i = 0; i < 300; i++){
+    2e73:	83 c7 01             	add    $0x1,%edi
+    2e76:	81 ff 2c 01 00 00    	cmp    $0x12c,%edi
+    2e7c:	75 c2                	jne    2e40 <hashdir+0x70>
+  for(i = 0; i < 300; i++){
+    2e7e:	31 ff                	xor    %edi,%edi
+    name[3] = 'a' + i / 26;
+    2e80:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    2e85:	8d 76 00             	lea    0x0(%esi),%esi
+    2e88:	89 f8                	mov    %edi,%eax
+    if((fd = open(name, O_RDONLY)) < 0){
+    2e8a:	83 ec 08             	sub    $0x8,%esp
+    name[3] = 'a' + i / 26;
+    2e8d:	f7 e6                	mul    %esi
+    2e8f:	c1 ea 03             	shr    $0x3,%edx
+    2e92:	8d 42 61             	lea    0x61(%edx),%eax
+    name[4] = 'a' + i % 26;
+    2e95:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    name[3] = 'a' + i / 26;
+    2e98:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    name[4] = 'a' + i % 26;
+    2e9b:	89 f8                	mov    %edi,%eax
+    2e9d:	29 d0                	sub    %edx,%eax
+    2e9f:	83 c0 61             	add    $0x61,%eax
+    2ea2:	88 45 e4             	mov    %al,-0x1c(%ebp)
+    if((fd = open(name, O_RDONLY)) < 0){
+    2ea5:	6a 00                	push   $0x0
+    2ea7:	53                   	push   %ebx
+    2ea8:	e8 c6 1c 00 00       	call   4b73 <open>
+    2ead:	83 c4 10             	add    $0x10,%esp
+    2eb0:	85 c0                	test   %eax,%eax
+    2eb2:	0f 88 d1 00 00 00    	js     2f89 <hashdir+0x1b9>
+    close(fd);
+    2eb8:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 300; i++){
+    2ebb:	83 c7 01             	add    $0x1,%edi
+    close(fd);
+    2ebe:	50                   	push   %eax
+    2ebf:	e8 97 1c 00 00       	call   4b5b <close>
+  for(i = 0; i < 300; i++){
+    2ec4:	83 c4 10             	add    $0x10,%esp
+    2ec7:	81 ff 2c 01 00 00    	cmp    $0x12c,%edi
+    2ecd:	75 b9                	jne    2e88 <hashdir+0xb8>
+  if(unlink("hd") == 0){
+    2ecf:	83 ec 0c             	sub    $0xc,%esp
+    2ed2:	68 27 5d 00 00       	push   $0x5d27
+    2ed7:	e8 a7 1c 00 00       	call   4b83 <unlink>
+    2edc:	83 c4 10             	add    $0x10,%esp
+    2edf:	85 c0                	test   %eax,%eax
+    2ee1:	0f 84 ca 00 00 00    	je     2fb1 <hashdir+0x1e1>
+  for(i = 0; i < 300; i++){
+    2ee7:	31 ff                	xor    %edi,%edi
+    name[3] = 'a' + i / 26;
+    2ee9:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    2eee:	66 90                	xchg   %ax,%ax
+    2ef0:	89 f8                	mov    %edi,%eax
+    if(unlink(name) < 0){
+    2ef2:	83 ec 0c             	sub    $0xc,%esp
+    name[3] = 'a' + i / 26;
+    2ef5:	f7 e6                	mul    %esi
+    2ef7:	c1 ea 03             	shr    $0x3,%edx
+    2efa:	8d 42 61             	lea    0x61(%edx),%eax
+    name[4] = 'a' + i % 26;
+    2efd:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    name[3] = 'a' + i / 26;
+    2f00:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    name[4] = 'a' + i % 26;
+    2f03:	89 f8                	mov    %edi,%eax
+    2f05:	29 d0                	sub    %edx,%eax
+    2f07:	83 c0 61             	add    $0x61,%eax
+    2f0a:	88 45 e4             	mov    %al,-0x1c(%ebp)
+    if(unlink(name) < 0){
+    2f0d:	53                   	push   %ebx
+    2f0e:	e8 70 1c 00 00       	call   4b83 <unlink>
+    2f13:	83 c4 10             	add    $0x10,%esp
+    2f16:	85 c0                	test   %eax,%eax
+    2f18:	78 5a                	js     2f74 <hashdir+0x1a4>
+  for(i = 0; i < 300; i++){
+    2f1a:	83 c7 01             	add    $0x1,%edi
+    2f1d:	81 ff 2c 01 00 00    	cmp    $0x12c,%edi
+    2f23:	75 cb                	jne    2ef0 <hashdir+0x120>
+  unlink("hd/f");
+    2f25:	83 ec 0c             	sub    $0xc,%esp
+    2f28:	68 41 5d 00 00       	push   $0x5d41
+    2f2d:	e8 51 1c 00 00       	call   4b83 <unlink>
+  if(unlink("hd") < 0){
+    2f32:	c7 04 24 27 5d 00 00 	movl   $0x5d27,(%esp)
+    2f39:	e8 45 1c 00 00       	call   4b83 <unlink>
+    2f3e:	83 c4 10             	add    $0x10,%esp
+    2f41:	85 c0                	test   %eax,%eax
+    2f43:	78 59                	js     2f9e <hashdir+0x1ce>
+  printf(1, "hashdir ok\n");
+    2f45:	83 ec 08             	sub    $0x8,%esp
+    2f48:	68 b1 5d 00 00       	push   $0x5db1
+    2f4d:	6a 01                	push   $0x1
+    2f4f:	e8 6c 1d 00 00       	call   4cc0 <printf>
+}
+    2f54:	83 c4 10             	add    $0x10,%esp
+    2f57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2f5a:	5b                   	pop    %ebx
+    2f5b:	5e                   	pop    %esi
+    2f5c:	5f                   	pop    %edi
+    2f5d:	5d                   	pop    %ebp
+    2f5e:	c3                   	ret
+      printf(1, "hashdir: link %s failed\n", name);
+    2f5f:	83 ec 04             	sub    $0x4,%esp
+    2f62:	53                   	push   %ebx
+    2f63:	68 64 5d 00 00       	push   $0x5d64
+    2f68:	6a 01                	push   $0x1
+    2f6a:	e8 51 1d 00 00       	call   4cc0 <printf>
+      exit();
+    2f6f:	e8 bf 1b 00 00       	call   4b33 <exit>
+      printf(1, "hashdir: unlink %s failed\n", name);
+    2f74:	83 ec 04             	sub    $0x4,%esp
+    2f77:	53                   	push   %ebx
+    2f78:	68 96 5d 00 00       	push   $0x5d96
+    2f7d:	6a 01                	push   $0x1
+    2f7f:	e8 3c 1d 00 00       	call   4cc0 <printf>
+      exit();
+    2f84:	e8 aa 1b 00 00       	call   4b33 <exit>
+      printf(1, "hashdir: open %s failed\n", name);
+    2f89:	83 ec 04             	sub    $0x4,%esp
+    2f8c:	53                   	push   %ebx
+    2f8d:	68 7d 5d 00 00       	push   $0x5d7d
+    2f92:	6a 01                	push   $0x1
+    2f94:	e8 27 1d 00 00       	call   4cc0 <printf>
+      exit();
+    2f99:	e8 95 1b 00 00       	call   4b33 <exit>
+    printf(1, "hashdir: unlink of emptied directory failed\n");
+    2f9e:	50                   	push   %eax
+    2f9f:	50                   	push   %eax
+    2fa0:	68 40 69 00 00       	push   $0x6940
+    2fa5:	6a 01                	push   $0x1
+    2fa7:	e8 14 1d 00 00       	call   4cc0 <printf>
+    exit();
+    2fac:	e8 82 1b 00 00       	call   4b33 <exit>
+    printf(1, "hashdir: unlinked non-empty directory\n");
+    2fb1:	52                   	push   %edx
+    2fb2:	52                   	push   %edx
+    2fb3:	68 18 69 00 00       	push   $0x6918
+    2fb8:	6a 01                	push   $0x1
+    2fba:	e8 01 1d 00 00       	call   4cc0 <printf>
+    exit();
+    2fbf:	e8 6f 1b 00 00       	call   4b33 <exit>
+    printf(1, "hashdir: create failed\n");
+    2fc4:	56                   	push   %esi
+    2fc5:	56                   	push   %esi
+    2fc6:	68 46 5d 00 00       	push   $0x5d46
+    2fcb:	6a 01                	push   $0x1
+    2fcd:	e8 ee 1c 00 00       	call   4cc0 <printf>
+    exit();
+    2fd2:	e8 5c 1b 00 00       	call   4b33 <exit>
+    printf(1, "hashdir: mkdir failed\n");
+    2fd7:	57                   	push   %edi
+    2fd8:	57                   	push   %edi
+    2fd9:	68 2a 5d 00 00       	push   $0x5d2a
+    2fde:	6a 01                	push   $0x1
+    2fe0:	e8 db 1c 00 00       	call   4cc0 <printf>
+    exit();
+    2fe5:	e8 49 1b 00 00       	call   4b33 <exit>
+    2fea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002ff0 <icachetest>:
+{
+    2ff0:	55                   	push   %ebp
+    2ff1:	89 e5                	mov    %esp,%ebp
+    2ff3:	57                   	push   %edi
+    2ff4:	56                   	push   %esi
+    2ff5:	53                   	push   %ebx
+    2ff6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "icache test\n");
+    2ff9:	68 bd 5d 00 00       	push   $0x5dbd
+    2ffe:	6a 01                	push   $0x1
+    3000:	e8 bb 1c 00 00       	call   4cc0 <printf>
+  if(mkdir("ic") < 0){
+    3005:	c7 04 24 ca 5d 00 00 	movl   $0x5dca,(%esp)
+    300c:	e8 8a 1b 00 00       	call   4b9b <mkdir>
+    3011:	83 c4 10             	add    $0x10,%esp
+    3014:	85 c0                	test   %eax,%eax
+    3016:	0f 88 86 02 00 00    	js     32a2 <icachetest+0x2b2>
+  for(i = 0; i < NICACHE; i++){
+    301c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    3023:	31 ff                	xor    %edi,%edi
+    3025:	8d 75 e0             	lea    -0x20(%ebp),%esi
+    if(write(fd, &i, sizeof(i)) != sizeof(i)){
+    3028:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    302b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    302f:	90                   	nop
+  strcpy(name, "ic/xx");
+    3030:	83 ec 08             	sub    $0x8,%esp
+    3033:	68 e3 5d 00 00       	push   $0x5de3
+    3038:	56                   	push   %esi
+    3039:	e8 b2 18 00 00       	call   48f0 <strcpy>
+  name[3] = 'a' + i / 26;
+    303e:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    3043:	f7 ef                	imul   %edi
+    3045:	89 f8                	mov    %edi,%eax
+    3047:	c1 f8 1f             	sar    $0x1f,%eax
+    304a:	c1 fa 03             	sar    $0x3,%edx
+    304d:	29 c2                	sub    %eax,%edx
+    304f:	8d 42 61             	lea    0x61(%edx),%eax
+  name[4] = 'a' + i % 26;
+    3052:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  name[3] = 'a' + i / 26;
+    3055:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  name[4] = 'a' + i % 26;
+    3058:	29 d7                	sub    %edx,%edi
+    305a:	8d 47 61             	lea    0x61(%edi),%eax
+    305d:	88 45 e4             	mov    %al,-0x1c(%ebp)
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+    3060:	5f                   	pop    %edi
+    3061:	58                   	pop    %eax
+    3062:	68 02 02 00 00       	push   $0x202
+    3067:	56                   	push   %esi
+    3068:	e8 06 1b 00 00       	call   4b73 <open>
+    306d:	83 c4 10             	add    $0x10,%esp
+    3070:	89 c7                	mov    %eax,%edi
+    3072:	85 c0                	test   %eax,%eax
+    3074:	0f 88 e4 01 00 00    	js     325e <icachetest+0x26e>
+    if(write(fd, &i, sizeof(i)) != sizeof(i)){
+    307a:	83 ec 04             	sub    $0x4,%esp
+    307d:	6a 04                	push   $0x4
+    307f:	53                   	push   %ebx
+    3080:	50                   	push   %eax
+    3081:	e8 cd 1a 00 00       	call   4b53 <write>
+    3086:	83 c4 10             	add    $0x10,%esp
+    3089:	83 f8 04             	cmp    $0x4,%eax
+    308c:	0f 85 f6 01 00 00    	jne    3288 <icachetest+0x298>
+    close(fd);
+    3092:	83 ec 0c             	sub    $0xc,%esp
+    3095:	57                   	push   %edi
+    3096:	e8 c0 1a 00 00       	call   4b5b <close>
+  for(i = 0; i < NICACHE; i++){
+    309b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    309e:	83 c4 10             	add    $0x10,%esp
+    30a1:	8d 78 01             	lea    0x1(%eax),%edi
+    30a4:	89 7d d8             	mov    %edi,-0x28(%ebp)
+    30a7:	81 ff f9 00 00 00    	cmp    $0xf9,%edi
+    30ad:	7e 81                	jle    3030 <icachetest+0x40>
+  pid = fork();
+    30af:	e8 77 1a 00 00       	call   4b2b <fork>
+    30b4:	89 c7                	mov    %eax,%edi
+  if(pid < 0){
+    30b6:	85 c0                	test   %eax,%eax
+    30b8:	0f 88 f7 01 00 00    	js     32b5 <icachetest+0x2c5>
+    30be:	b8 03 00 00 00       	mov    $0x3,%eax
+    for(i = 0; i < NICACHE; i++){
+    30c3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    30ca:	31 db                	xor    %ebx,%ebx
+  name[3] = 'a' + i / 26;
+    30cc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    30cf:	90                   	nop
+      icname(name, pid == 0 ? NICACHE - 1 - i : i);
+    30d0:	b8 f9 00 00 00       	mov    $0xf9,%eax
+    30d5:	29 d8                	sub    %ebx,%eax
+    30d7:	85 ff                	test   %edi,%edi
+    30d9:	0f 44 d8             	cmove  %eax,%ebx
+  strcpy(name, "ic/xx");
+    30dc:	83 ec 08             	sub    $0x8,%esp
+    30df:	68 e3 5d 00 00       	push   $0x5de3
+    30e4:	56                   	push   %esi
+    30e5:	e8 06 18 00 00       	call   48f0 <strcpy>
+  name[3] = 'a' + i / 26;
+    30ea:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+  name[4] = 'a' + i % 26;
+    30ef:	89 d9                	mov    %ebx,%ecx
+  name[3] = 'a' + i / 26;
+    30f1:	f7 eb                	imul   %ebx
+    30f3:	89 d8                	mov    %ebx,%eax
+    30f5:	c1 f8 1f             	sar    $0x1f,%eax
+    30f8:	c1 fa 03             	sar    $0x3,%edx
+    30fb:	29 c2                	sub    %eax,%edx
+    30fd:	8d 42 61             	lea    0x61(%edx),%eax
+  name[4] = 'a' + i % 26;
+    3100:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  name[3] = 'a' + i / 26;
+    3103:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  name[4] = 'a' + i % 26;
+    3106:	29 d1                	sub    %edx,%ecx
+    3108:	83 c1 61             	add    $0x61,%ecx
+    310b:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+      if((fd = open(name, O_RDONLY)) < 0){
+    310e:	5a                   	pop    %edx
+    310f:	59                   	pop    %ecx
+    3110:	6a 00                	push   $0x0
+    3112:	56                   	push   %esi
+    3113:	e8 5b 1a 00 00       	call   4b73 <open>
+    3118:	83 c4 10             	add    $0x10,%esp
+    311b:	89 c3                	mov    %eax,%ebx
+    311d:	85 c0                	test   %eax,%eax
+    311f:	0f 88 24 01 00 00    	js     3249 <icachetest+0x259>
+      if(read(fd, &v, sizeof(v)) != sizeof(v) ||
+    3125:	83 ec 04             	sub    $0x4,%esp
+    3128:	8d 45 dc             	lea    -0x24(%ebp),%eax
+      v = -1;
+    312b:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%ebp)
+      if(read(fd, &v, sizeof(v)) != sizeof(v) ||
+    3132:	6a 04                	push   $0x4
+    3134:	50                   	push   %eax
+    3135:	53                   	push   %ebx
+    3136:	e8 10 1a 00 00       	call   4b4b <read>
+    313b:	83 c4 10             	add    $0x10,%esp
+    313e:	83 f8 04             	cmp    $0x4,%eax
+    3141:	0f 85 ec 00 00 00    	jne    3233 <icachetest+0x243>
+         v != (pid == 0 ? NICACHE - 1 - i : i)){
+    3147:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    314a:	ba f9 00 00 00       	mov    $0xf9,%edx
+    314f:	29 c2                	sub    %eax,%edx
+    3151:	85 ff                	test   %edi,%edi
+    3153:	0f 44 c2             	cmove  %edx,%eax
+    3156:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      if(read(fd, &v, sizeof(v)) != sizeof(v) ||
+    3159:	39 c2                	cmp    %eax,%edx
+    315b:	0f 85 d5 00 00 00    	jne    3236 <icachetest+0x246>
+      close(fd);
+    3161:	83 ec 0c             	sub    $0xc,%esp
+    3164:	53                   	push   %ebx
+    3165:	e8 f1 19 00 00       	call   4b5b <close>
+    for(i = 0; i < NICACHE; i++){
+    316a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    316d:	83 c4 10             	add    $0x10,%esp
+    3170:	8d 58 01             	lea    0x1(%eax),%ebx
+    3173:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    3176:	81 fb f9 00 00 00    	cmp    $0xf9,%ebx
+    317c:	0f 8e 4e ff ff ff    	jle    30d0 <icachetest+0xe0>
+  for(j = 0; j < 3; j++){
+    3182:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    3185:	83 e8 01             	sub    $0x1,%eax
+    3188:	0f 85 35 ff ff ff    	jne    30c3 <icachetest+0xd3>
+  if(pid == 0)
+    318e:	85 ff                	test   %edi,%edi
+    3190:	0f 84 07 01 00 00    	je     329d <icachetest+0x2ad>
+  wait();
+    3196:	e8 a0 19 00 00       	call   4b3b <wait>
+  for(i = 0; i < NICACHE; i++){
+    319b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    31a2:	31 db                	xor    %ebx,%ebx
+  name[3] = 'a' + i / 26;
+    31a4:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+    31a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  strcpy(name, "ic/xx");
+    31b0:	83 ec 08             	sub    $0x8,%esp
+    31b3:	68 e3 5d 00 00       	push   $0x5de3
+    31b8:	56                   	push   %esi
+    31b9:	e8 32 17 00 00       	call   48f0 <strcpy>
+  name[3] = 'a' + i / 26;
+    31be:	89 d8                	mov    %ebx,%eax
+    31c0:	f7 ef                	imul   %edi
+    31c2:	89 d8                	mov    %ebx,%eax
+    31c4:	c1 f8 1f             	sar    $0x1f,%eax
+    31c7:	c1 fa 03             	sar    $0x3,%edx
+    31ca:	29 c2                	sub    %eax,%edx
+    31cc:	8d 42 61             	lea    0x61(%edx),%eax
+  name[4] = 'a' + i % 26;
+    31cf:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  name[3] = 'a' + i / 26;
+    31d2:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  name[4] = 'a' + i % 26;
+    31d5:	29 d3                	sub    %edx,%ebx
+    31d7:	83 c3 61             	add    $0x61,%ebx
+    31da:	88 5d e4             	mov    %bl,-0x1c(%ebp)
+    if(unlink(name) < 0){
+    31dd:	89 34 24             	mov    %esi,(%esp)
+    31e0:	e8 9e 19 00 00       	call   4b83 <unlink>
+    31e5:	83 c4 10             	add    $0x10,%esp
+    31e8:	85 c0                	test   %eax,%eax
+    31ea:	0f 88 83 00 00 00    	js     3273 <icachetest+0x283>
+  for(i = 0; i < NICACHE; i++){
+    31f0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    31f3:	8d 58 01             	lea    0x1(%eax),%ebx
+    31f6:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    31f9:	81 fb f9 00 00 00    	cmp    $0xf9,%ebx
+    31ff:	7e af                	jle    31b0 <icachetest+0x1c0>
+  if(unlink("ic") < 0){
+    3201:	83 ec 0c             	sub    $0xc,%esp
+    3204:	68 ca 5d 00 00       	push   $0x5dca
+    3209:	e8 75 19 00 00       	call   4b83 <unlink>
+    320e:	83 c4 10             	add    $0x10,%esp
+    3211:	85 c0                	test   %eax,%eax
+    3213:	0f 88 af 00 00 00    	js     32c8 <icachetest+0x2d8>
+  printf(1, "icache ok\n");
+    3219:	83 ec 08             	sub    $0x8,%esp
+    321c:	68 92 5e 00 00       	push   $0x5e92
+    3221:	6a 01                	push   $0x1
+    3223:	e8 98 1a 00 00       	call   4cc0 <printf>
+}
+    3228:	83 c4 10             	add    $0x10,%esp
+    322b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    322e:	5b                   	pop    %ebx
+    322f:	5e                   	pop    %esi
+    3230:	5f                   	pop    %edi
+    3231:	5d                   	pop    %ebp
+    3232:	c3                   	ret
+         v != (pid == 0 ? NICACHE - 1 - i : i)){
+    3233:	8b 55 dc             	mov    -0x24(%ebp),%edx
+        printf(1, "icache: %s holds %d\n", name, v);
+    3236:	52                   	push   %edx
+    3237:	56                   	push   %esi
+    3238:	68 49 5e 00 00       	push   $0x5e49
+    323d:	6a 01                	push   $0x1
+    323f:	e8 7c 1a 00 00       	call   4cc0 <printf>
+        exit();
+    3244:	e8 ea 18 00 00       	call   4b33 <exit>
+        printf(1, "icache: open %s failed\n", name);
+    3249:	83 ec 04             	sub    $0x4,%esp
+    324c:	56                   	push   %esi
+    324d:	68 31 5e 00 00       	push   $0x5e31
+    3252:	6a 01                	push   $0x1
+    3254:	e8 67 1a 00 00       	call   4cc0 <printf>
+        exit();
+    3259:	e8 d5 18 00 00       	call   4b33 <exit>
+      printf(1, "icache: create %s failed\n", name);
+    325e:	83 ec 04             	sub    $0x4,%esp
+    3261:	56                   	push   %esi
+    3262:	68 e9 5d 00 00       	push   $0x5de9
+    3267:	6a 01                	push   $0x1
+    3269:	e8 52 1a 00 00       	call   4cc0 <printf>
+      exit();
+    326e:	e8 c0 18 00 00       	call   4b33 <exit>
+      printf(1, "icache: unlink %s failed\n", name);
+    3273:	83 ec 04             	sub    $0x4,%esp
+    3276:	56                   	push   %esi
+    3277:	68 5e 5e 00 00       	push   $0x5e5e
+    327c:	6a 01                	push   $0x1
+    327e:	e8 3d 1a 00 00       	call   4cc0 <printf>
+      exit();
+    3283:	e8 ab 18 00 00       	call   4b33 <exit>
+      printf(1, "icache: write %s failed\n", name);
+    3288:	83 ec 04             	sub    $0x4,%esp
+    328b:	56                   	push   %esi
+    328c:	68 03 5e 00 00       	push   $0x5e03
+    3291:	6a 01                	push   $0x1
+    3293:	e8 28 1a 00 00       	call   4cc0 <printf>
+      exit();
+    3298:	e8 96 18 00 00       	call   4b33 <exit>
+    exit();
+    329d:	e8 91 18 00 00       	call   4b33 <exit>
+    printf(1, "icache: mkdir failed\n");
+    32a2:	50                   	push   %eax
+    32a3:	50                   	push   %eax
+    32a4:	68 cd 5d 00 00       	push   $0x5dcd
+    32a9:	6a 01                	push   $0x1
+    32ab:	e8 10 1a 00 00       	call   4cc0 <printf>
+    exit();
+    32b0:	e8 7e 18 00 00       	call   4b33 <exit>
+    printf(1, "icache: fork failed\n");
+    32b5:	53                   	push   %ebx
+    32b6:	53                   	push   %ebx
+    32b7:	68 1c 5e 00 00       	push   $0x5e1c
+    32bc:	6a 01                	push   $0x1
+    32be:	e8 fd 19 00 00       	call   4cc0 <printf>
+    exit();
+    32c3:	e8 6b 18 00 00       	call   4b33 <exit>
+    printf(1, "icache: unlink ic failed\n");
+    32c8:	50                   	push   %eax
+    32c9:	50                   	push   %eax
+    32ca:	68 78 5e 00 00       	push   $0x5e78
+    32cf:	6a 01                	push   $0x1
+    32d1:	e8 ea 19 00 00       	call   4cc0 <printf>
+    exit();
+    32d6:	e8 58 18 00 00       	call   4b33 <exit>
+    32db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    32df:	90                   	nop
+
+000032e0 <fragfile>:
+{
+    32e0:	55                   	push   %ebp
+    32e1:	89 e5                	mov    %esp,%ebp
+    32e3:	57                   	push   %edi
+    32e4:	56                   	push   %esi
+    32e5:	53                   	push   %ebx
+    32e6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "fragfile test\n");
+    32e9:	68 a3 5e 00 00       	push   $0x5ea3
+    32ee:	6a 01                	push   $0x1
+    32f0:	e8 cb 19 00 00       	call   4cc0 <printf>
+  fd[0] = open("frag0", O_CREATE|O_RDWR);
+    32f5:	5e                   	pop    %esi
+    32f6:	5f                   	pop    %edi
+    32f7:	68 02 02 00 00       	push   $0x202
+    32fc:	68 9d 5e 00 00       	push   $0x5e9d
+    3301:	e8 6d 18 00 00       	call   4b73 <open>
+    3306:	89 c7                	mov    %eax,%edi
+  fd[1] = open("frag1", O_CREATE|O_RDWR);
+    3308:	58                   	pop    %eax
+    3309:	5a                   	pop    %edx
+    330a:	68 02 02 00 00       	push   $0x202
+    330f:	68 b2 5e 00 00       	push   $0x5eb2
+    3314:	e8 5a 18 00 00       	call   4b73 <open>
+  if(fd[0] < 0 || fd[1] < 0){
+    3319:	83 c4 10             	add    $0x10,%esp
+  fd[1] = open("frag1", O_CREATE|O_RDWR);
+    331c:	89 c6                	mov    %eax,%esi
+  if(fd[0] < 0 || fd[1] < 0){
+    331e:	89 f8                	mov    %edi,%eax
+    3320:	09 f0                	or     %esi,%eax
+    3322:	0f 88 8c 01 00 00    	js     34b4 <fragfile+0x1d4>
+  for(i = 0; i < n; i++){
+    3328:	31 db                	xor    %ebx,%ebx
+    332a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(write(fd[j], buf, 512) != 512){
+    3330:	83 ec 04             	sub    $0x4,%esp
+      ((int*)buf)[0] = i;
+    3333:	89 1d 80 a0 00 00    	mov    %ebx,0xa080
+      ((int*)buf)[1] = j;
+    3339:	c7 05 84 a0 00 00 00 	movl   $0x0,0xa084
+    3340:	00 00 00 
+      if(write(fd[j], buf, 512) != 512){
+    3343:	68 00 02 00 00       	push   $0x200
+    3348:	68 80 a0 00 00       	push   $0xa080
+    334d:	57                   	push   %edi
+    334e:	e8 00 18 00 00       	call   4b53 <write>
+    3353:	83 c4 10             	add    $0x10,%esp
+    3356:	3d 00 02 00 00       	cmp    $0x200,%eax
+    335b:	0f 85 2c 01 00 00    	jne    348d <fragfile+0x1ad>
+    3361:	83 ec 04             	sub    $0x4,%esp
+      ((int*)buf)[0] = i;
+    3364:	89 1d 80 a0 00 00    	mov    %ebx,0xa080
+      ((int*)buf)[1] = j;
+    336a:	c7 05 84 a0 00 00 01 	movl   $0x1,0xa084
+    3371:	00 00 00 
+      if(write(fd[j], buf, 512) != 512){
+    3374:	68 00 02 00 00       	push   $0x200
+    3379:	68 80 a0 00 00       	push   $0xa080
+    337e:	56                   	push   %esi
+    337f:	e8 cf 17 00 00       	call   4b53 <write>
+    3384:	83 c4 10             	add    $0x10,%esp
+    3387:	3d 00 02 00 00       	cmp    $0x200,%eax
+    338c:	0f 85 fb 00 00 00    	jne    348d <fragfile+0x1ad>
+  for(i = 0; i < n; i++){
+    3392:	83 c3 01             	add    $0x1,%ebx
+    3395:	81 fb 87 00 00 00    	cmp    $0x87,%ebx
+    339b:	75 93                	jne    3330 <fragfile+0x50>
+  close(fd[0]);
+    339d:	83 ec 0c             	sub    $0xc,%esp
+    33a0:	57                   	push   %edi
+  for(j = 0; j < 2; j++){
+    33a1:	31 ff                	xor    %edi,%edi
+  close(fd[0]);
+    33a3:	e8 b3 17 00 00       	call   4b5b <close>
+  close(fd[1]);
+    33a8:	89 34 24             	mov    %esi,(%esp)
+    33ab:	e8 ab 17 00 00       	call   4b5b <close>
+    33b0:	83 c4 10             	add    $0x10,%esp
+    fd[j] = open(j ? "frag1" : "frag0", O_RDONLY);
+    33b3:	b8 9d 5e 00 00       	mov    $0x5e9d,%eax
+    33b8:	83 ec 08             	sub    $0x8,%esp
+    for(i = 0; i < n; i++){
+    33bb:	31 db                	xor    %ebx,%ebx
+    fd[j] = open(j ? "frag1" : "frag0", O_RDONLY);
+    33bd:	6a 00                	push   $0x0
+    33bf:	50                   	push   %eax
+    33c0:	e8 ae 17 00 00       	call   4b73 <open>
+    33c5:	83 c4 10             	add    $0x10,%esp
+    33c8:	89 c6                	mov    %eax,%esi
+    for(i = 0; i < n; i++){
+    33ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(read(fd[j], buf, 512) != 512 ||
+    33d0:	83 ec 04             	sub    $0x4,%esp
+    33d3:	68 00 02 00 00       	push   $0x200
+    33d8:	68 80 a0 00 00       	push   $0xa080
+    33dd:	56                   	push   %esi
+    33de:	e8 68 17 00 00       	call   4b4b <read>
+    33e3:	83 c4 10             	add    $0x10,%esp
+    33e6:	3d 00 02 00 00       	cmp    $0x200,%eax
+    33eb:	0f 85 87 00 00 00    	jne    3478 <fragfile+0x198>
+    33f1:	39 1d 80 a0 00 00    	cmp    %ebx,0xa080
+    33f7:	75 7f                	jne    3478 <fragfile+0x198>
+         ((int*)buf)[0] != i || ((int*)buf)[1] != j){
+    33f9:	39 3d 84 a0 00 00    	cmp    %edi,0xa084
+    33ff:	75 77                	jne    3478 <fragfile+0x198>
+    for(i = 0; i < n; i++){
+    3401:	83 c3 01             	add    $0x1,%ebx
+    3404:	81 fb 87 00 00 00    	cmp    $0x87,%ebx
+    340a:	75 c4                	jne    33d0 <fragfile+0xf0>
+    if(read(fd[j], buf, 512) != 0){
+    340c:	83 ec 04             	sub    $0x4,%esp
+    340f:	68 00 02 00 00       	push   $0x200
+    3414:	68 80 a0 00 00       	push   $0xa080
+    3419:	56                   	push   %esi
+    341a:	e8 2c 17 00 00       	call   4b4b <read>
+    341f:	83 c4 10             	add    $0x10,%esp
+    3422:	85 c0                	test   %eax,%eax
+    3424:	75 7b                	jne    34a1 <fragfile+0x1c1>
+    close(fd[j]);
+    3426:	83 ec 0c             	sub    $0xc,%esp
+    3429:	56                   	push   %esi
+    342a:	e8 2c 17 00 00       	call   4b5b <close>
+    fd[j] = open(j ? "frag1" : "frag0", O_RDONLY);
+    342f:	b8 b2 5e 00 00       	mov    $0x5eb2,%eax
+  for(j = 0; j < 2; j++){
+    3434:	83 c4 10             	add    $0x10,%esp
+    3437:	83 ff 01             	cmp    $0x1,%edi
+    343a:	74 0a                	je     3446 <fragfile+0x166>
+    343c:	bf 01 00 00 00       	mov    $0x1,%edi
+    3441:	e9 72 ff ff ff       	jmp    33b8 <fragfile+0xd8>
+  unlink("frag0");
+    3446:	83 ec 0c             	sub    $0xc,%esp
+    3449:	68 9d 5e 00 00       	push   $0x5e9d
+    344e:	e8 30 17 00 00       	call   4b83 <unlink>
+  unlink("frag1");
+    3453:	c7 04 24 b2 5e 00 00 	movl   $0x5eb2,(%esp)
+    345a:	e8 24 17 00 00       	call   4b83 <unlink>
+  printf(1, "fragfile ok\n");
+    345f:	58                   	pop    %eax
+    3460:	5a                   	pop    %edx
+    3461:	68 fd 5e 00 00       	push   $0x5efd
+    3466:	6a 01                	push   $0x1
+    3468:	e8 53 18 00 00       	call   4cc0 <printf>
+}
+    346d:	83 c4 10             	add    $0x10,%esp
+    3470:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3473:	5b                   	pop    %ebx
+    3474:	5e                   	pop    %esi
+    3475:	5f                   	pop    %edi
+    3476:	5d                   	pop    %ebp
+    3477:	c3                   	ret
+        printf(1, "fragfile: wrong content at block %d\n", i);
+    3478:	83 ec 04             	sub    $0x4,%esp
+    347b:	53                   	push   %ebx
+    347c:	68 70 69 00 00       	push   $0x6970
+    3481:	6a 01                	push   $0x1
+    3483:	e8 38 18 00 00       	call   4cc0 <printf>
+        exit();
+    3488:	e8 a6 16 00 00       	call   4b33 <exit>
+        printf(1, "fragfile: write failed\n");
+    348d:	83 ec 08             	sub    $0x8,%esp
+    3490:	68 d1 5e 00 00       	push   $0x5ed1
+    3495:	6a 01                	push   $0x1
+    3497:	e8 24 18 00 00       	call   4cc0 <printf>
+        exit();
+    349c:	e8 92 16 00 00       	call   4b33 <exit>
+      printf(1, "fragfile: too long\n");
+    34a1:	51                   	push   %ecx
+    34a2:	51                   	push   %ecx
+    34a3:	68 e9 5e 00 00       	push   $0x5ee9
+    34a8:	6a 01                	push   $0x1
+    34aa:	e8 11 18 00 00       	call   4cc0 <printf>
+      exit();
+    34af:	e8 7f 16 00 00       	call   4b33 <exit>
+    printf(1, "fragfile: create failed\n");
+    34b4:	53                   	push   %ebx
+    34b5:	53                   	push   %ebx
+    34b6:	68 b8 5e 00 00       	push   $0x5eb8
+    34bb:	6a 01                	push   $0x1
+    34bd:	e8 fe 17 00 00       	call   4cc0 <printf>
+    exit();
+    34c2:	e8 6c 16 00 00       	call   4b33 <exit>
+    34c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    34ce:	66 90                	xchg   %ax,%ax
+
+000034d0 <fourteen>:
+{
+    34d0:	55                   	push   %ebp
+    34d1:	89 e5                	mov    %esp,%ebp
+    34d3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    34d6:	68 0a 5f 00 00       	push   $0x5f0a
+    34db:	6a 01                	push   $0x1
+    34dd:	e8 de 17 00 00       	call   4cc0 <printf>
+  if(mkdir("12345678901234") != 0){
+    34e2:	c7 04 24 45 5f 00 00 	movl   $0x5f45,(%esp)
+    34e9:	e8 ad 16 00 00       	call   4b9b <mkdir>
+    34ee:	83 c4 10             	add    $0x10,%esp
+    34f1:	85 c0                	test   %eax,%eax
+    34f3:	0f 85 97 00 00 00    	jne    3590 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    34f9:	83 ec 0c             	sub    $0xc,%esp
+    34fc:	68 98 69 00 00       	push   $0x6998
+    3501:	e8 95 16 00 00       	call   4b9b <mkdir>
+    3506:	83 c4 10             	add    $0x10,%esp
+    3509:	85 c0                	test   %eax,%eax
+    350b:	0f 85 de 00 00 00    	jne    35ef <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3511:	83 ec 08             	sub    $0x8,%esp
+    3514:	68 00 02 00 00       	push   $0x200
+    3519:	68 e8 69 00 00       	push   $0x69e8
+    351e:	e8 50 16 00 00       	call   4b73 <open>
+  if(fd < 0){
+    3523:	83 c4 10             	add    $0x10,%esp
+    3526:	85 c0                	test   %eax,%eax
+    3528:	0f 88 ae 00 00 00    	js     35dc <fourteen+0x10c>
+  close(fd);
+    352e:	83 ec 0c             	sub    $0xc,%esp
+    3531:	50                   	push   %eax
+    3532:	e8 24 16 00 00       	call   4b5b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    3537:	58                   	pop    %eax
+    3538:	5a                   	pop    %edx
+    3539:	6a 00                	push   $0x0
+    353b:	68 58 6a 00 00       	push   $0x6a58
+    3540:	e8 2e 16 00 00       	call   4b73 <open>
+  if(fd < 0){
+    3545:	83 c4 10             	add    $0x10,%esp
+    3548:	85 c0                	test   %eax,%eax
+    354a:	78 7d                	js     35c9 <fourteen+0xf9>
+  close(fd);
+    354c:	83 ec 0c             	sub    $0xc,%esp
+    354f:	50                   	push   %eax
+    3550:	e8 06 16 00 00       	call   4b5b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    3555:	c7 04 24 36 5f 00 00 	movl   $0x5f36,(%esp)
+    355c:	e8 3a 16 00 00       	call   4b9b <mkdir>
+    3561:	83 c4 10             	add    $0x10,%esp
+    3564:	85 c0                	test   %eax,%eax
+    3566:	74 4e                	je     35b6 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    3568:	83 ec 0c             	sub    $0xc,%esp
+    356b:	68 f4 6a 00 00       	push   $0x6af4
+    3570:	e8 26 16 00 00       	call   4b9b <mkdir>
+    3575:	83 c4 10             	add    $0x10,%esp
+    3578:	85 c0                	test   %eax,%eax
+    357a:	74 27                	je     35a3 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    357c:	83 ec 08             	sub    $0x8,%esp
+    357f:	68 54 5f 00 00       	push   $0x5f54
+    3584:	6a 01                	push   $0x1
+    3586:	e8 35 17 00 00       	call   4cc0 <printf>
+}
+    358b:	83 c4 10             	add    $0x10,%esp
+    358e:	c9                   	leave
+    358f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    3590:	50                   	push   %eax
+    3591:	50                   	push   %eax
+    3592:	68 19 5f 00 00       	push   $0x5f19
+    3597:	6a 01                	push   $0x1
+    3599:	e8 22 17 00 00       	call   4cc0 <printf>
+    exit();
+    359e:	e8 90 15 00 00       	call   4b33 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    35a3:	50                   	push   %eax
+    35a4:	50                   	push   %eax
+    35a5:	68 14 6b 00 00       	push   $0x6b14
+    35aa:	6a 01                	push   $0x1
+    35ac:	e8 0f 17 00 00       	call   4cc0 <printf>
+    exit();
+    35b1:	e8 7d 15 00 00       	call   4b33 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    35b6:	52                   	push   %edx
+    35b7:	52                   	push   %edx
+    35b8:	68 c4 6a 00 00       	push   $0x6ac4
+    35bd:	6a 01                	push   $0x1
+    35bf:	e8 fc 16 00 00       	call   4cc0 <printf>
+    exit();
+    35c4:	e8 6a 15 00 00       	call   4b33 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    35c9:	51                   	push   %ecx
+    35ca:	51                   	push   %ecx
+    35cb:	68 88 6a 00 00       	push   $0x6a88
+    35d0:	6a 01                	push   $0x1
+    35d2:	e8 e9 16 00 00       	call   4cc0 <printf>
+    exit();
+    35d7:	e8 57 15 00 00       	call   4b33 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    35dc:	51                   	push   %ecx
+    35dd:	51                   	push   %ecx
+    35de:	68 18 6a 00 00       	push   $0x6a18
+    35e3:	6a 01                	push   $0x1
+    35e5:	e8 d6 16 00 00       	call   4cc0 <printf>
+    exit();
+    35ea:	e8 44 15 00 00       	call   4b33 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    35ef:	50                   	push   %eax
+    35f0:	50                   	push   %eax
+    35f1:	68 b8 69 00 00       	push   $0x69b8
+    35f6:	6a 01                	push   $0x1
+    35f8:	e8 c3 16 00 00       	call   4cc0 <printf>
+    exit();
+    35fd:	e8 31 15 00 00       	call   4b33 <exit>
+    3602:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003610 <rmdot>:
+{
+    3610:	55                   	push   %ebp
+    3611:	89 e5                	mov    %esp,%ebp
+    3613:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    3616:	68 61 5f 00 00       	push   $0x5f61
+    361b:	6a 01                	push   $0x1
+    361d:	e8 9e 16 00 00       	call   4cc0 <printf>
+  if(mkdir("dots") != 0){
+    3622:	c7 04 24 6d 5f 00 00 	movl   $0x5f6d,(%esp)
+    3629:	e8 6d 15 00 00       	call   4b9b <mkdir>
+    362e:	83 c4 10             	add    $0x10,%esp
+    3631:	85 c0                	test   %eax,%eax
+    3633:	0f 85 b0 00 00 00    	jne    36e9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    3639:	83 ec 0c             	sub    $0xc,%esp
+    363c:	68 6d 5f 00 00       	push   $0x5f6d
+    3641:	e8 5d 15 00 00       	call   4ba3 <chdir>
+    3646:	83 c4 10             	add    $0x10,%esp
+    3649:	85 c0                	test   %eax,%eax
+    364b:	0f 85 1d 01 00 00    	jne    376e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    3651:	83 ec 0c             	sub    $0xc,%esp
+    3654:	68 bb 59 00 00       	push   $0x59bb
+    3659:	e8 25 15 00 00       	call   4b83 <unlink>
+    365e:	83 c4 10             	add    $0x10,%esp
+    3661:	85 c0                	test   %eax,%eax
+    3663:	0f 84 f2 00 00 00    	je     375b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    3669:	83 ec 0c             	sub    $0xc,%esp
+    366c:	68 ba 59 00 00       	push   $0x59ba
+    3671:	e8 0d 15 00 00       	call   4b83 <unlink>
+    3676:	83 c4 10             	add    $0x10,%esp
+    3679:	85 c0                	test   %eax,%eax
+    367b:	0f 84 c7 00 00 00    	je     3748 <rmdot+0x138>
+  if(chdir("/") != 0){
+    3681:	83 ec 0c             	sub    $0xc,%esp
+    3684:	68 23 50 00 00       	push   $0x5023
+    3689:	e8 15 15 00 00       	call   4ba3 <chdir>
+    368e:	83 c4 10             	add    $0x10,%esp
+    3691:	85 c0                	test   %eax,%eax
+    3693:	0f 85 9c 00 00 00    	jne    3735 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    3699:	83 ec 0c             	sub    $0xc,%esp
+    369c:	68 b5 5f 00 00       	push   $0x5fb5
+    36a1:	e8 dd 14 00 00       	call   4b83 <unlink>
+    36a6:	83 c4 10             	add    $0x10,%esp
+    36a9:	85 c0                	test   %eax,%eax
+    36ab:	74 75                	je     3722 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    36ad:	83 ec 0c             	sub    $0xc,%esp
+    36b0:	68 d3 5f 00 00       	push   $0x5fd3
+    36b5:	e8 c9 14 00 00       	call   4b83 <unlink>
+    36ba:	83 c4 10             	add    $0x10,%esp
+    36bd:	85 c0                	test   %eax,%eax
+    36bf:	74 4e                	je     370f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    36c1:	83 ec 0c             	sub    $0xc,%esp
+    36c4:	68 6d 5f 00 00       	push   $0x5f6d
+    36c9:	e8 b5 14 00 00       	call   4b83 <unlink>
+    36ce:	83 c4 10             	add    $0x10,%esp
+    36d1:	85 c0                	test   %eax,%eax
+    36d3:	75 27                	jne    36fc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    36d5:	83 ec 08             	sub    $0x8,%esp
+    36d8:	68 08 60 00 00       	push   $0x6008
+    36dd:	6a 01                	push   $0x1
+    36df:	e8 dc 15 00 00       	call   4cc0 <printf>
+}
+    36e4:	83 c4 10             	add    $0x10,%esp
+    36e7:	c9                   	leave
+    36e8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    36e9:	50                   	push   %eax
+    36ea:	50                   	push   %eax
+    36eb:	68 72 5f 00 00       	push   $0x5f72
+    36f0:	6a 01                	push   $0x1
+    36f2:	e8 c9 15 00 00       	call   4cc0 <printf>
+    exit();
+    36f7:	e8 37 14 00 00       	call   4b33 <exit>
+    printf(1, "unlink dots failed!\n");
+    36fc:	50                   	push   %eax
+    36fd:	50                   	push   %eax
+    36fe:	68 f3 5f 00 00       	push   $0x5ff3
+    3703:	6a 01                	push   $0x1
+    3705:	e8 b6 15 00 00       	call   4cc0 <printf>
+    exit();
+    370a:	e8 24 14 00 00       	call   4b33 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    370f:	52                   	push   %edx
+    3710:	52                   	push   %edx
+    3711:	68 db 5f 00 00       	push   $0x5fdb
+    3716:	6a 01                	push   $0x1
+    3718:	e8 a3 15 00 00       	call   4cc0 <printf>
+    exit();
+    371d:	e8 11 14 00 00       	call   4b33 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    3722:	51                   	push   %ecx
+    3723:	51                   	push   %ecx
+    3724:	68 bc 5f 00 00       	push   $0x5fbc
+    3729:	6a 01                	push   $0x1
+    372b:	e8 90 15 00 00       	call   4cc0 <printf>
+    exit();
+    3730:	e8 fe 13 00 00       	call   4b33 <exit>
+    printf(1, "chdir / failed\n");
+    3735:	50                   	push   %eax
+    3736:	50                   	push   %eax
+    3737:	68 25 50 00 00       	push   $0x5025
+    373c:	6a 01                	push   $0x1
+    373e:	e8 7d 15 00 00       	call   4cc0 <printf>
+    exit();
+    3743:	e8 eb 13 00 00       	call   4b33 <exit>
+    printf(1, "rm .. worked!\n");
+    3748:	50                   	push   %eax
+    3749:	50                   	push   %eax
+    374a:	68 a6 5f 00 00       	push   $0x5fa6
+    374f:	6a 01                	push   $0x1
+    3751:	e8 6a 15 00 00       	call   4cc0 <printf>
+    exit();
+    3756:	e8 d8 13 00 00       	call   4b33 <exit>
+    printf(1, "rm . worked!\n");
+    375b:	50                   	push   %eax
+    375c:	50                   	push   %eax
+    375d:	68 98 5f 00 00       	push   $0x5f98
+    3762:	6a 01                	push   $0x1
+    3764:	e8 57 15 00 00       	call   4cc0 <printf>
+    exit();
+    3769:	e8 c5 13 00 00       	call   4b33 <exit>
+    printf(1, "chdir dots failed\n");
+    376e:	50                   	push   %eax
+    376f:	50                   	push   %eax
+    3770:	68 85 5f 00 00       	push   $0x5f85
+    3775:	6a 01                	push   $0x1
+    3777:	e8 44 15 00 00       	call   4cc0 <printf>
+    exit();
+    377c:	e8 b2 13 00 00       	call   4b33 <exit>
+    3781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    378f:	90                   	nop
+
+00003790 <dirfile>:
+{
+    3790:	55                   	push   %ebp
+    3791:	89 e5                	mov    %esp,%ebp
+    3793:	53                   	push   %ebx
+    3794:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    3797:	68 12 60 00 00       	push   $0x6012
+    379c:	6a 01                	push   $0x1
+    379e:	e8 1d 15 00 00       	call   4cc0 <printf>
+  fd = open("dirfile", O_CREATE);
+    37a3:	5b                   	pop    %ebx
+    37a4:	58                   	pop    %eax
+    37a5:	68 00 02 00 00       	push   $0x200
+    37aa:	68 1f 60 00 00       	push   $0x601f
+    37af:	e8 bf 13 00 00       	call   4b73 <open>
+  if(fd < 0){
+    37b4:	83 c4 10             	add    $0x10,%esp
+    37b7:	85 c0                	test   %eax,%eax
+    37b9:	0f 88 43 01 00 00    	js     3902 <dirfile+0x172>
+  close(fd);
+    37bf:	83 ec 0c             	sub    $0xc,%esp
+    37c2:	50                   	push   %eax
+    37c3:	e8 93 13 00 00       	call   4b5b <close>
+  if(chdir("dirfile") == 0){
+    37c8:	c7 04 24 1f 60 00 00 	movl   $0x601f,(%esp)
+    37cf:	e8 cf 13 00 00       	call   4ba3 <chdir>
+    37d4:	83 c4 10             	add    $0x10,%esp
+    37d7:	85 c0                	test   %eax,%eax
+    37d9:	0f 84 10 01 00 00    	je     38ef <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    37df:	83 ec 08             	sub    $0x8,%esp
+    37e2:	6a 00                	push   $0x0
+    37e4:	68 58 60 00 00       	push   $0x6058
+    37e9:	e8 85 13 00 00       	call   4b73 <open>
+  if(fd >= 0){
+    37ee:	83 c4 10             	add    $0x10,%esp
+    37f1:	85 c0                	test   %eax,%eax
+    37f3:	0f 89 e3 00 00 00    	jns    38dc <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    37f9:	83 ec 08             	sub    $0x8,%esp
+    37fc:	68 00 02 00 00       	push   $0x200
+    3801:	68 58 60 00 00       	push   $0x6058
+    3806:	e8 68 13 00 00       	call   4b73 <open>
+  if(fd >= 0){
+    380b:	83 c4 10             	add    $0x10,%esp
+    380e:	85 c0                	test   %eax,%eax
+    3810:	0f 89 c6 00 00 00    	jns    38dc <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    3816:	83 ec 0c             	sub    $0xc,%esp
+    3819:	68 58 60 00 00       	push   $0x6058
+    381e:	e8 78 13 00 00       	call   4b9b <mkdir>
+    3823:	83 c4 10             	add    $0x10,%esp
+    3826:	85 c0                	test   %eax,%eax
+    3828:	0f 84 46 01 00 00    	je     3974 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    382e:	83 ec 0c             	sub    $0xc,%esp
+    3831:	68 58 60 00 00       	push   $0x6058
+    3836:	e8 48 13 00 00       	call   4b83 <unlink>
+    383b:	83 c4 10             	add    $0x10,%esp
+    383e:	85 c0                	test   %eax,%eax
+    3840:	0f 84 1b 01 00 00    	je     3961 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    3846:	83 ec 08             	sub    $0x8,%esp
+    3849:	68 58 60 00 00       	push   $0x6058
+    384e:	68 bc 60 00 00       	push   $0x60bc
+    3853:	e8 3b 13 00 00       	call   4b93 <link>
+    3858:	83 c4 10             	add    $0x10,%esp
+    385b:	85 c0                	test   %eax,%eax
+    385d:	0f 84 eb 00 00 00    	je     394e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    3863:	83 ec 0c             	sub    $0xc,%esp
+    3866:	68 1f 60 00 00       	push   $0x601f
+    386b:	e8 13 13 00 00       	call   4b83 <unlink>
+    3870:	83 c4 10             	add    $0x10,%esp
+    3873:	85 c0                	test   %eax,%eax
+    3875:	0f 85 c0 00 00 00    	jne    393b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    387b:	83 ec 08             	sub    $0x8,%esp
+    387e:	6a 02                	push   $0x2
+    3880:	68 bb 59 00 00       	push   $0x59bb
+    3885:	e8 e9 12 00 00       	call   4b73 <open>
+  if(fd >= 0){
+    388a:	83 c4 10             	add    $0x10,%esp
+    388d:	85 c0                	test   %eax,%eax
+    388f:	0f 89 93 00 00 00    	jns    3928 <dirfile+0x198>
+  fd = open(".", 0);
+    3895:	83 ec 08             	sub    $0x8,%esp
+    3898:	6a 00                	push   $0x0
+    389a:	68 bb 59 00 00       	push   $0x59bb
+    389f:	e8 cf 12 00 00       	call   4b73 <open>
+  if(write(fd, "x", 1) > 0){
+    38a4:	83 c4 0c             	add    $0xc,%esp
+    38a7:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    38a9:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    38ab:	68 fe 5c 00 00       	push   $0x5cfe
+    38b0:	50                   	push   %eax
+    38b1:	e8 9d 12 00 00       	call   4b53 <write>
+    38b6:	83 c4 10             	add    $0x10,%esp
+    38b9:	85 c0                	test   %eax,%eax
+    38bb:	7f 58                	jg     3915 <dirfile+0x185>
+  close(fd);
+    38bd:	83 ec 0c             	sub    $0xc,%esp
+    38c0:	53                   	push   %ebx
+    38c1:	e8 95 12 00 00       	call   4b5b <close>
+  printf(1, "dir vs file OK\n");
+    38c6:	58                   	pop    %eax
+    38c7:	5a                   	pop    %edx
+    38c8:	68 ef 60 00 00       	push   $0x60ef
+    38cd:	6a 01                	push   $0x1
+    38cf:	e8 ec 13 00 00       	call   4cc0 <printf>
+}
+    38d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    38d7:	83 c4 10             	add    $0x10,%esp
+    38da:	c9                   	leave
+    38db:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    38dc:	50                   	push   %eax
+    38dd:	50                   	push   %eax
+    38de:	68 63 60 00 00       	push   $0x6063
+    38e3:	6a 01                	push   $0x1
+    38e5:	e8 d6 13 00 00       	call   4cc0 <printf>
+    exit();
+    38ea:	e8 44 12 00 00       	call   4b33 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    38ef:	52                   	push   %edx
+    38f0:	52                   	push   %edx
+    38f1:	68 3e 60 00 00       	push   $0x603e
+    38f6:	6a 01                	push   $0x1
+    38f8:	e8 c3 13 00 00       	call   4cc0 <printf>
+    exit();
+    38fd:	e8 31 12 00 00       	call   4b33 <exit>
+    printf(1, "create dirfile failed\n");
+    3902:	51                   	push   %ecx
+    3903:	51                   	push   %ecx
+    3904:	68 27 60 00 00       	push   $0x6027
+    3909:	6a 01                	push   $0x1
+    390b:	e8 b0 13 00 00       	call   4cc0 <printf>
+    exit();
+    3910:	e8 1e 12 00 00       	call   4b33 <exit>
+    printf(1, "write . succeeded!\n");
+    3915:	51                   	push   %ecx
+    3916:	51                   	push   %ecx
+    3917:	68 db 60 00 00       	push   $0x60db
+    391c:	6a 01                	push   $0x1
+    391e:	e8 9d 13 00 00       	call   4cc0 <printf>
+    exit();
+    3923:	e8 0b 12 00 00       	call   4b33 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    3928:	53                   	push   %ebx
+    3929:	53                   	push   %ebx
+    392a:	68 68 6b 00 00       	push   $0x6b68
+    392f:	6a 01                	push   $0x1
+    3931:	e8 8a 13 00 00       	call   4cc0 <printf>
+    exit();
+    3936:	e8 f8 11 00 00       	call   4b33 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    393b:	50                   	push   %eax
+    393c:	50                   	push   %eax
+    393d:	68 c3 60 00 00       	push   $0x60c3
+    3942:	6a 01                	push   $0x1
+    3944:	e8 77 13 00 00       	call   4cc0 <printf>
+    exit();
+    3949:	e8 e5 11 00 00       	call   4b33 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    394e:	50                   	push   %eax
+    394f:	50                   	push   %eax
+    3950:	68 48 6b 00 00       	push   $0x6b48
+    3955:	6a 01                	push   $0x1
+    3957:	e8 64 13 00 00       	call   4cc0 <printf>
+    exit();
+    395c:	e8 d2 11 00 00       	call   4b33 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    3961:	50                   	push   %eax
+    3962:	50                   	push   %eax
+    3963:	68 9e 60 00 00       	push   $0x609e
+    3968:	6a 01                	push   $0x1
+    396a:	e8 51 13 00 00       	call   4cc0 <printf>
+    exit();
+    396f:	e8 bf 11 00 00       	call   4b33 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3974:	50                   	push   %eax
+    3975:	50                   	push   %eax
+    3976:	68 81 60 00 00       	push   $0x6081
+    397b:	6a 01                	push   $0x1
+    397d:	e8 3e 13 00 00       	call   4cc0 <printf>
+    exit();
+    3982:	e8 ac 11 00 00       	call   4b33 <exit>
+    3987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    398e:	66 90                	xchg   %ax,%ax
+
+00003990 <iref>:
+{
+    3990:	55                   	push   %ebp
+    3991:	89 e5                	mov    %esp,%ebp
+    3993:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    3994:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    3999:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    399c:	68 ff 60 00 00       	push   $0x60ff
+    39a1:	6a 01                	push   $0x1
+    39a3:	e8 18 13 00 00       	call   4cc0 <printf>
+    39a8:	83 c4 10             	add    $0x10,%esp
+    39ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    39af:	90                   	nop
+    if(mkdir("irefd") != 0){
+    39b0:	83 ec 0c             	sub    $0xc,%esp
+    39b3:	68 10 61 00 00       	push   $0x6110
+    39b8:	e8 de 11 00 00       	call   4b9b <mkdir>
+    39bd:	83 c4 10             	add    $0x10,%esp
+    39c0:	85 c0                	test   %eax,%eax
+    39c2:	0f 85 bb 00 00 00    	jne    3a83 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    39c8:	83 ec 0c             	sub    $0xc,%esp
+    39cb:	68 10 61 00 00       	push   $0x6110
+    39d0:	e8 ce 11 00 00       	call   4ba3 <chdir>
+    39d5:	83 c4 10             	add    $0x10,%esp
+    39d8:	85 c0                	test   %eax,%eax
+    39da:	0f 85 b7 00 00 00    	jne    3a97 <iref+0x107>
+    mkdir("");
+    39e0:	83 ec 0c             	sub    $0xc,%esp
+    39e3:	68 68 55 00 00       	push   $0x5568
+    39e8:	e8 ae 11 00 00       	call   4b9b <mkdir>
+    link("README", "");
+    39ed:	59                   	pop    %ecx
+    39ee:	58                   	pop    %eax
+    39ef:	68 68 55 00 00       	push   $0x5568
+    39f4:	68 bc 60 00 00       	push   $0x60bc
+    39f9:	e8 95 11 00 00       	call   4b93 <link>
+    fd = open("", O_CREATE);
+    39fe:	58                   	pop    %eax
+    39ff:	5a                   	pop    %edx
+    3a00:	68 00 02 00 00       	push   $0x200
+    3a05:	68 68 55 00 00       	push   $0x5568
+    3a0a:	e8 64 11 00 00       	call   4b73 <open>
+    if(fd >= 0)
+    3a0f:	83 c4 10             	add    $0x10,%esp
+    3a12:	85 c0                	test   %eax,%eax
+    3a14:	78 0c                	js     3a22 <iref+0x92>
+      close(fd);
+    3a16:	83 ec 0c             	sub    $0xc,%esp
+    3a19:	50                   	push   %eax
+    3a1a:	e8 3c 11 00 00       	call   4b5b <close>
+    3a1f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3a22:	83 ec 08             	sub    $0x8,%esp
+    3a25:	68 00 02 00 00       	push   $0x200
+    3a2a:	68 e6 5d 00 00       	push   $0x5de6
+    3a2f:	e8 3f 11 00 00       	call   4b73 <open>
+    if(fd >= 0)
+    3a34:	83 c4 10             	add    $0x10,%esp
+    3a37:	85 c0                	test   %eax,%eax
+    3a39:	78 0c                	js     3a47 <iref+0xb7>
+      close(fd);
+    3a3b:	83 ec 0c             	sub    $0xc,%esp
+    3a3e:	50                   	push   %eax
+    3a3f:	e8 17 11 00 00       	call   4b5b <close>
+    3a44:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    3a47:	83 ec 0c             	sub    $0xc,%esp
+    3a4a:	68 e6 5d 00 00       	push   $0x5de6
+    3a4f:	e8 2f 11 00 00       	call   4b83 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    3a54:	83 c4 10             	add    $0x10,%esp
+    3a57:	83 eb 01             	sub    $0x1,%ebx
+    3a5a:	0f 85 50 ff ff ff    	jne    39b0 <iref+0x20>
+  chdir("/");
+    3a60:	83 ec 0c             	sub    $0xc,%esp
+    3a63:	68 23 50 00 00       	push   $0x5023
+    3a68:	e8 36 11 00 00       	call   4ba3 <chdir>
+  printf(1, "empty file name OK\n");
+    3a6d:	58                   	pop    %eax
+    3a6e:	5a                   	pop    %edx
+    3a6f:	68 3e 61 00 00       	push   $0x613e
+    3a74:	6a 01                	push   $0x1
+    3a76:	e8 45 12 00 00       	call   4cc0 <printf>
+}
+    3a7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3a7e:	83 c4 10             	add    $0x10,%esp
+    3a81:	c9                   	leave
+    3a82:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    3a83:	83 ec 08             	sub    $0x8,%esp
+    3a86:	68 16 61 00 00       	push   $0x6116
+    3a8b:	6a 01                	push   $0x1
+    3a8d:	e8 2e 12 00 00       	call   4cc0 <printf>
+      exit();
+    3a92:	e8 9c 10 00 00       	call   4b33 <exit>
+      printf(1, "chdir irefd failed\n");
+    3a97:	83 ec 08             	sub    $0x8,%esp
+    3a9a:	68 2a 61 00 00       	push   $0x612a
+    3a9f:	6a 01                	push   $0x1
+    3aa1:	e8 1a 12 00 00       	call   4cc0 <printf>
+      exit();
+    3aa6:	e8 88 10 00 00       	call   4b33 <exit>
+    3aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3aaf:	90                   	nop
+
+00003ab0 <forktest>:
+{
+    3ab0:	55                   	push   %ebp
+    3ab1:	89 e5                	mov    %esp,%ebp
+    3ab3:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    3ab4:	31 db                	xor    %ebx,%ebx
+{
+    3ab6:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    3ab9:	68 52 61 00 00       	push   $0x6152
+    3abe:	6a 01                	push   $0x1
+    3ac0:	e8 fb 11 00 00       	call   4cc0 <printf>
+    3ac5:	83 c4 10             	add    $0x10,%esp
+    3ac8:	eb 13                	jmp    3add <forktest+0x2d>
+    3aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    3ad0:	74 4d                	je     3b1f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    3ad2:	83 c3 01             	add    $0x1,%ebx
+    3ad5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    3adb:	74 6e                	je     3b4b <forktest+0x9b>
+    pid = fork();
+    3add:	e8 49 10 00 00       	call   4b2b <fork>
+    if(pid < 0)
+    3ae2:	85 c0                	test   %eax,%eax
+    3ae4:	79 ea                	jns    3ad0 <forktest+0x20>
+  for(; n > 0; n--){
+    3ae6:	85 db                	test   %ebx,%ebx
+    3ae8:	74 14                	je     3afe <forktest+0x4e>
+    3aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    3af0:	e8 46 10 00 00       	call   4b3b <wait>
+    3af5:	85 c0                	test   %eax,%eax
+    3af7:	78 2b                	js     3b24 <forktest+0x74>
+  for(; n > 0; n--){
+    3af9:	83 eb 01             	sub    $0x1,%ebx
+    3afc:	75 f2                	jne    3af0 <forktest+0x40>
+  if(wait() != -1){
+    3afe:	e8 38 10 00 00       	call   4b3b <wait>
+    3b03:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3b06:	75 30                	jne    3b38 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    3b08:	83 ec 08             	sub    $0x8,%esp
+    3b0b:	68 84 61 00 00       	push   $0x6184
+    3b10:	6a 01                	push   $0x1
+    3b12:	e8 a9 11 00 00       	call   4cc0 <printf>
+}
+    3b17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3b1a:	83 c4 10             	add    $0x10,%esp
+    3b1d:	c9                   	leave
+    3b1e:	c3                   	ret
+      exit();
+    3b1f:	e8 0f 10 00 00       	call   4b33 <exit>
+      printf(1, "wait stopped early\n");
+    3b24:	83 ec 08             	sub    $0x8,%esp
+    3b27:	68 5d 61 00 00       	push   $0x615d
+    3b2c:	6a 01                	push   $0x1
+    3b2e:	e8 8d 11 00 00       	call   4cc0 <printf>
+      exit();
+    3b33:	e8 fb 0f 00 00       	call   4b33 <exit>
+    printf(1, "wait got too many\n");
+    3b38:	50                   	push   %eax
+    3b39:	50                   	push   %eax
+    3b3a:	68 71 61 00 00       	push   $0x6171
+    3b3f:	6a 01                	push   $0x1
+    3b41:	e8 7a 11 00 00       	call   4cc0 <printf>
+    exit();
+    3b46:	e8 e8 0f 00 00       	call   4b33 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    3b4b:	52                   	push   %edx
+    3b4c:	52                   	push   %edx
+    3b4d:	68 88 6b 00 00       	push   $0x6b88
+    3b52:	6a 01                	push   $0x1
+    3b54:	e8 67 11 00 00       	call   4cc0 <printf>
+    exit();
+    3b59:	e8 d5 0f 00 00       	call   4b33 <exit>
+    3b5e:	66 90                	xchg   %ax,%ax
+
+00003b60 <sbrktest>:
+{
+    3b60:	55                   	push   %ebp
+    3b61:	89 e5                	mov    %esp,%ebp
+    3b63:	57                   	push   %edi
+    3b64:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    3b65:	31 f6                	xor    %esi,%esi
+{
+    3b67:	53                   	push   %ebx
+    3b68:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    3b6b:	68 92 61 00 00       	push   $0x6192
+    3b70:	ff 35 38 79 00 00    	push   0x7938
+    3b76:	e8 45 11 00 00       	call   4cc0 <printf>
+  oldbrk = sbrk(0);
+    3b7b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3b82:	e8 34 10 00 00       	call   4bbb <sbrk>
+    3b87:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    3b8a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3b91:	e8 25 10 00 00       	call   4bbb <sbrk>
+    3b96:	83 c4 10             	add    $0x10,%esp
+    3b99:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    3b9b:	eb 05                	jmp    3ba2 <sbrktest+0x42>
+    3b9d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3ba0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3ba2:	83 ec 0c             	sub    $0xc,%esp
+    3ba5:	6a 01                	push   $0x1
+    3ba7:	e8 0f 10 00 00       	call   4bbb <sbrk>
+    if(b != a){
+    3bac:	83 c4 10             	add    $0x10,%esp
+    3baf:	39 d8                	cmp    %ebx,%eax
+    3bb1:	0f 85 9c 02 00 00    	jne    3e53 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    3bb7:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    3bba:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    3bbd:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3bc0:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3bc6:	75 d8                	jne    3ba0 <sbrktest+0x40>
+  pid = fork();
+    3bc8:	e8 5e 0f 00 00       	call   4b2b <fork>
+    3bcd:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    3bcf:	85 c0                	test   %eax,%eax
+    3bd1:	0f 88 02 03 00 00    	js     3ed9 <sbrktest+0x379>
+  c = sbrk(1);
+    3bd7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    3bda:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    3bdd:	6a 01                	push   $0x1
+    3bdf:	e8 d7 0f 00 00       	call   4bbb <sbrk>
+  c = sbrk(1);
+    3be4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3beb:	e8 cb 0f 00 00       	call   4bbb <sbrk>
+  if(c != a + 1){
+    3bf0:	83 c4 10             	add    $0x10,%esp
+    3bf3:	39 c3                	cmp    %eax,%ebx
+    3bf5:	0f 85 3b 03 00 00    	jne    3f36 <sbrktest+0x3d6>
+  if(pid == 0)
+    3bfb:	85 f6                	test   %esi,%esi
+    3bfd:	0f 84 2e 03 00 00    	je     3f31 <sbrktest+0x3d1>
+  wait();
+    3c03:	e8 33 0f 00 00       	call   4b3b <wait>
+  a = sbrk(0);
+    3c08:	83 ec 0c             	sub    $0xc,%esp
+    3c0b:	6a 00                	push   $0x0
+    3c0d:	e8 a9 0f 00 00       	call   4bbb <sbrk>
+    3c12:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3c14:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3c19:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    3c1b:	89 04 24             	mov    %eax,(%esp)
+    3c1e:	e8 98 0f 00 00       	call   4bbb <sbrk>
+  if (p != a) {
+    3c23:	83 c4 10             	add    $0x10,%esp
+    3c26:	39 c3                	cmp    %eax,%ebx
+    3c28:	0f 85 94 02 00 00    	jne    3ec2 <sbrktest+0x362>
+  a = sbrk(0);
+    3c2e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3c31:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3c38:	6a 00                	push   $0x0
+    3c3a:	e8 7c 0f 00 00       	call   4bbb <sbrk>
+  c = sbrk(-4096);
+    3c3f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3c46:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3c48:	e8 6e 0f 00 00       	call   4bbb <sbrk>
+  if(c == (char*)0xffffffff){
+    3c4d:	83 c4 10             	add    $0x10,%esp
+    3c50:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3c53:	0f 84 22 03 00 00    	je     3f7b <sbrktest+0x41b>
+  c = sbrk(0);
+    3c59:	83 ec 0c             	sub    $0xc,%esp
+    3c5c:	6a 00                	push   $0x0
+    3c5e:	e8 58 0f 00 00       	call   4bbb <sbrk>
+  if(c != a - 4096){
+    3c63:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3c69:	83 c4 10             	add    $0x10,%esp
+    3c6c:	39 d0                	cmp    %edx,%eax
+    3c6e:	0f 85 f0 02 00 00    	jne    3f64 <sbrktest+0x404>
+  a = sbrk(0);
+    3c74:	83 ec 0c             	sub    $0xc,%esp
+    3c77:	6a 00                	push   $0x0
+    3c79:	e8 3d 0f 00 00       	call   4bbb <sbrk>
+  c = sbrk(4096);
+    3c7e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3c85:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3c87:	e8 2f 0f 00 00       	call   4bbb <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    3c8c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    3c8f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3c91:	39 c3                	cmp    %eax,%ebx
+    3c93:	0f 85 b4 02 00 00    	jne    3f4d <sbrktest+0x3ed>
+    3c99:	83 ec 0c             	sub    $0xc,%esp
+    3c9c:	6a 00                	push   $0x0
+    3c9e:	e8 18 0f 00 00       	call   4bbb <sbrk>
+    3ca3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3ca9:	83 c4 10             	add    $0x10,%esp
+    3cac:	39 c2                	cmp    %eax,%edx
+    3cae:	0f 85 99 02 00 00    	jne    3f4d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3cb4:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    3cbb:	0f 84 2f 02 00 00    	je     3ef0 <sbrktest+0x390>
+  a = sbrk(0);
+    3cc1:	83 ec 0c             	sub    $0xc,%esp
+    3cc4:	6a 00                	push   $0x0
+    3cc6:	e8 f0 0e 00 00       	call   4bbb <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3ccb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3cd2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3cd4:	e8 e2 0e 00 00       	call   4bbb <sbrk>
+    3cd9:	89 c2                	mov    %eax,%edx
+    3cdb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3cde:	29 d0                	sub    %edx,%eax
+    3ce0:	89 04 24             	mov    %eax,(%esp)
+    3ce3:	e8 d3 0e 00 00       	call   4bbb <sbrk>
+  if(c != a){
+    3ce8:	83 c4 10             	add    $0x10,%esp
+    3ceb:	39 c3                	cmp    %eax,%ebx
+    3ced:	0f 85 b8 01 00 00    	jne    3eab <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3cf3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3cff:	90                   	nop
+    ppid = getpid();
+    3d00:	e8 ae 0e 00 00       	call   4bb3 <getpid>
+    3d05:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3d07:	e8 1f 0e 00 00       	call   4b2b <fork>
+    if(pid < 0){
+    3d0c:	85 c0                	test   %eax,%eax
+    3d0e:	0f 88 5d 01 00 00    	js     3e71 <sbrktest+0x311>
+    if(pid == 0){
+    3d14:	0f 84 6f 01 00 00    	je     3e89 <sbrktest+0x329>
+    wait();
+    3d1a:	e8 1c 0e 00 00       	call   4b3b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3d1f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3d25:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    3d2b:	75 d3                	jne    3d00 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    3d2d:	83 ec 0c             	sub    $0xc,%esp
+    3d30:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3d33:	50                   	push   %eax
+    3d34:	e8 0a 0e 00 00       	call   4b43 <pipe>
+    3d39:	83 c4 10             	add    $0x10,%esp
+    3d3c:	85 c0                	test   %eax,%eax
+    3d3e:	0f 85 da 01 00 00    	jne    3f1e <sbrktest+0x3be>
+    3d44:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3d47:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    3d4a:	89 df                	mov    %ebx,%edi
+    3d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3d50:	e8 d6 0d 00 00       	call   4b2b <fork>
+    3d55:	89 07                	mov    %eax,(%edi)
+    3d57:	85 c0                	test   %eax,%eax
+    3d59:	0f 84 91 00 00 00    	je     3df0 <sbrktest+0x290>
+    if(pids[i] != -1)
+    3d5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d62:	74 14                	je     3d78 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3d64:	83 ec 04             	sub    $0x4,%esp
+    3d67:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    3d6a:	6a 01                	push   $0x1
+    3d6c:	50                   	push   %eax
+    3d6d:	ff 75 b8             	push   -0x48(%ebp)
+    3d70:	e8 d6 0d 00 00       	call   4b4b <read>
+    3d75:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3d78:	83 c7 04             	add    $0x4,%edi
+    3d7b:	39 f7                	cmp    %esi,%edi
+    3d7d:	75 d1                	jne    3d50 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    3d7f:	83 ec 0c             	sub    $0xc,%esp
+    3d82:	68 00 10 00 00       	push   $0x1000
+    3d87:	e8 2f 0e 00 00       	call   4bbb <sbrk>
+    3d8c:	83 c4 10             	add    $0x10,%esp
+    3d8f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3d91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3d98:	8b 03                	mov    (%ebx),%eax
+    3d9a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d9d:	74 11                	je     3db0 <sbrktest+0x250>
+    kill(pids[i]);
+    3d9f:	83 ec 0c             	sub    $0xc,%esp
+    3da2:	50                   	push   %eax
+    3da3:	e8 bb 0d 00 00       	call   4b63 <kill>
+    wait();
+    3da8:	e8 8e 0d 00 00       	call   4b3b <wait>
+    3dad:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3db0:	83 c3 04             	add    $0x4,%ebx
+    3db3:	39 f3                	cmp    %esi,%ebx
+    3db5:	75 e1                	jne    3d98 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3db7:	83 ff ff             	cmp    $0xffffffff,%edi
+    3dba:	0f 84 47 01 00 00    	je     3f07 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3dc0:	83 ec 0c             	sub    $0xc,%esp
+    3dc3:	6a 00                	push   $0x0
+    3dc5:	e8 f1 0d 00 00       	call   4bbb <sbrk>
+    3dca:	83 c4 10             	add    $0x10,%esp
+    3dcd:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3dd0:	72 60                	jb     3e32 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3dd2:	83 ec 08             	sub    $0x8,%esp
+    3dd5:	68 3a 62 00 00       	push   $0x623a
+    3dda:	ff 35 38 79 00 00    	push   0x7938
+    3de0:	e8 db 0e 00 00       	call   4cc0 <printf>
+}
+    3de5:	83 c4 10             	add    $0x10,%esp
+    3de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3deb:	5b                   	pop    %ebx
+    3dec:	5e                   	pop    %esi
+    3ded:	5f                   	pop    %edi
+    3dee:	5d                   	pop    %ebp
+    3def:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3df0:	83 ec 0c             	sub    $0xc,%esp
+    3df3:	6a 00                	push   $0x0
+    3df5:	e8 c1 0d 00 00       	call   4bbb <sbrk>
+    3dfa:	89 c2                	mov    %eax,%edx
+    3dfc:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3e01:	29 d0                	sub    %edx,%eax
+    3e03:	89 04 24             	mov    %eax,(%esp)
+    3e06:	e8 b0 0d 00 00       	call   4bbb <sbrk>
+      write(fds[1], "x", 1);
+    3e0b:	83 c4 0c             	add    $0xc,%esp
+    3e0e:	6a 01                	push   $0x1
+    3e10:	68 fe 5c 00 00       	push   $0x5cfe
+    3e15:	ff 75 bc             	push   -0x44(%ebp)
+    3e18:	e8 36 0d 00 00       	call   4b53 <write>
+    3e1d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3e20:	83 ec 0c             	sub    $0xc,%esp
+    3e23:	68 e8 03 00 00       	push   $0x3e8
+    3e28:	e8 96 0d 00 00       	call   4bc3 <sleep>
+    3e2d:	83 c4 10             	add    $0x10,%esp
+    3e30:	eb ee                	jmp    3e20 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3e32:	83 ec 0c             	sub    $0xc,%esp
+    3e35:	6a 00                	push   $0x0
+    3e37:	e8 7f 0d 00 00       	call   4bbb <sbrk>
+    3e3c:	89 c2                	mov    %eax,%edx
+    3e3e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3e41:	29 d0                	sub    %edx,%eax
+    3e43:	89 04 24             	mov    %eax,(%esp)
+    3e46:	e8 70 0d 00 00       	call   4bbb <sbrk>
+    3e4b:	83 c4 10             	add    $0x10,%esp
+    3e4e:	e9 7f ff ff ff       	jmp    3dd2 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3e53:	83 ec 0c             	sub    $0xc,%esp
+    3e56:	50                   	push   %eax
+    3e57:	53                   	push   %ebx
+    3e58:	56                   	push   %esi
+    3e59:	68 9d 61 00 00       	push   $0x619d
+    3e5e:	ff 35 38 79 00 00    	push   0x7938
+    3e64:	e8 57 0e 00 00       	call   4cc0 <printf>
+      exit();
+    3e69:	83 c4 20             	add    $0x20,%esp
+    3e6c:	e8 c2 0c 00 00       	call   4b33 <exit>
+      printf(stdout, "fork failed\n");
+    3e71:	83 ec 08             	sub    $0x8,%esp
+    3e74:	68 25 54 00 00       	push   $0x5425
+    3e79:	ff 35 38 79 00 00    	push   0x7938
+    3e7f:	e8 3c 0e 00 00       	call   4cc0 <printf>
+      exit();
+    3e84:	e8 aa 0c 00 00       	call   4b33 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3e89:	0f be 03             	movsbl (%ebx),%eax
+    3e8c:	50                   	push   %eax
+    3e8d:	53                   	push   %ebx
+    3e8e:	68 06 62 00 00       	push   $0x6206
+    3e93:	ff 35 38 79 00 00    	push   0x7938
+    3e99:	e8 22 0e 00 00       	call   4cc0 <printf>
+      kill(ppid);
+    3e9e:	89 34 24             	mov    %esi,(%esp)
+    3ea1:	e8 bd 0c 00 00       	call   4b63 <kill>
+      exit();
+    3ea6:	e8 88 0c 00 00       	call   4b33 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3eab:	50                   	push   %eax
+    3eac:	53                   	push   %ebx
+    3ead:	68 7c 6c 00 00       	push   $0x6c7c
+    3eb2:	ff 35 38 79 00 00    	push   0x7938
+    3eb8:	e8 03 0e 00 00       	call   4cc0 <printf>
+    exit();
+    3ebd:	e8 71 0c 00 00       	call   4b33 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3ec2:	56                   	push   %esi
+    3ec3:	56                   	push   %esi
+    3ec4:	68 ac 6b 00 00       	push   $0x6bac
+    3ec9:	ff 35 38 79 00 00    	push   0x7938
+    3ecf:	e8 ec 0d 00 00       	call   4cc0 <printf>
+    exit();
+    3ed4:	e8 5a 0c 00 00       	call   4b33 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3ed9:	50                   	push   %eax
+    3eda:	50                   	push   %eax
+    3edb:	68 b8 61 00 00       	push   $0x61b8
+    3ee0:	ff 35 38 79 00 00    	push   0x7938
+    3ee6:	e8 d5 0d 00 00       	call   4cc0 <printf>
+    exit();
+    3eeb:	e8 43 0c 00 00       	call   4b33 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3ef0:	51                   	push   %ecx
+    3ef1:	51                   	push   %ecx
+    3ef2:	68 4c 6c 00 00       	push   $0x6c4c
+    3ef7:	ff 35 38 79 00 00    	push   0x7938
+    3efd:	e8 be 0d 00 00       	call   4cc0 <printf>
+    exit();
+    3f02:	e8 2c 0c 00 00       	call   4b33 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3f07:	50                   	push   %eax
+    3f08:	50                   	push   %eax
+    3f09:	68 1f 62 00 00       	push   $0x621f
+    3f0e:	ff 35 38 79 00 00    	push   0x7938
+    3f14:	e8 a7 0d 00 00       	call   4cc0 <printf>
+    exit();
+    3f19:	e8 15 0c 00 00       	call   4b33 <exit>
+    printf(1, "pipe() failed\n");
+    3f1e:	52                   	push   %edx
+    3f1f:	52                   	push   %edx
+    3f20:	68 0e 54 00 00       	push   $0x540e
+    3f25:	6a 01                	push   $0x1
+    3f27:	e8 94 0d 00 00       	call   4cc0 <printf>
+    exit();
+    3f2c:	e8 02 0c 00 00       	call   4b33 <exit>
+    exit();
+    3f31:	e8 fd 0b 00 00       	call   4b33 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3f36:	57                   	push   %edi
+    3f37:	57                   	push   %edi
+    3f38:	68 cf 61 00 00       	push   $0x61cf
+    3f3d:	ff 35 38 79 00 00    	push   0x7938
+    3f43:	e8 78 0d 00 00       	call   4cc0 <printf>
+    exit();
+    3f48:	e8 e6 0b 00 00       	call   4b33 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3f4d:	56                   	push   %esi
+    3f4e:	53                   	push   %ebx
+    3f4f:	68 24 6c 00 00       	push   $0x6c24
+    3f54:	ff 35 38 79 00 00    	push   0x7938
+    3f5a:	e8 61 0d 00 00       	call   4cc0 <printf>
+    exit();
+    3f5f:	e8 cf 0b 00 00       	call   4b33 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3f64:	50                   	push   %eax
+    3f65:	53                   	push   %ebx
+    3f66:	68 ec 6b 00 00       	push   $0x6bec
+    3f6b:	ff 35 38 79 00 00    	push   0x7938
+    3f71:	e8 4a 0d 00 00       	call   4cc0 <printf>
+    exit();
+    3f76:	e8 b8 0b 00 00       	call   4b33 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    3f7b:	53                   	push   %ebx
+    3f7c:	53                   	push   %ebx
+    3f7d:	68 eb 61 00 00       	push   $0x61eb
+    3f82:	ff 35 38 79 00 00    	push   0x7938
+    3f88:	e8 33 0d 00 00       	call   4cc0 <printf>
+    exit();
+    3f8d:	e8 a1 0b 00 00       	call   4b33 <exit>
+    3f92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003fa0 <validateint>:
+}
+    3fa0:	c3                   	ret
+    3fa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3faf:	90                   	nop
+
+00003fb0 <validatetest>:
+{
+    3fb0:	55                   	push   %ebp
+    3fb1:	89 e5                	mov    %esp,%ebp
+    3fb3:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3fb4:	31 f6                	xor    %esi,%esi
+{
+    3fb6:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3fb7:	83 ec 08             	sub    $0x8,%esp
+    3fba:	68 48 62 00 00       	push   $0x6248
+    3fbf:	ff 35 38 79 00 00    	push   0x7938
+    3fc5:	e8 f6 0c 00 00       	call   4cc0 <printf>
+    3fca:	83 c4 10             	add    $0x10,%esp
+    3fcd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3fd0:	e8 56 0b 00 00       	call   4b2b <fork>
+    3fd5:	89 c3                	mov    %eax,%ebx
+    3fd7:	85 c0                	test   %eax,%eax
+    3fd9:	74 63                	je     403e <validatetest+0x8e>
+    sleep(0);
+    3fdb:	83 ec 0c             	sub    $0xc,%esp
+    3fde:	6a 00                	push   $0x0
+    3fe0:	e8 de 0b 00 00       	call   4bc3 <sleep>
+    sleep(0);
+    3fe5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3fec:	e8 d2 0b 00 00       	call   4bc3 <sleep>
+    kill(pid);
+    3ff1:	89 1c 24             	mov    %ebx,(%esp)
+    3ff4:	e8 6a 0b 00 00       	call   4b63 <kill>
+    wait();
+    3ff9:	e8 3d 0b 00 00       	call   4b3b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3ffe:	58                   	pop    %eax
+    3fff:	5a                   	pop    %edx
+    4000:	56                   	push   %esi
+    4001:	68 57 62 00 00       	push   $0x6257
+    4006:	e8 88 0b 00 00       	call   4b93 <link>
+    400b:	83 c4 10             	add    $0x10,%esp
+    400e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4011:	75 30                	jne    4043 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4013:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    4019:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    401f:	75 af                	jne    3fd0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    4021:	83 ec 08             	sub    $0x8,%esp
+    4024:	68 7b 62 00 00       	push   $0x627b
+    4029:	ff 35 38 79 00 00    	push   0x7938
+    402f:	e8 8c 0c 00 00       	call   4cc0 <printf>
+}
+    4034:	83 c4 10             	add    $0x10,%esp
+    4037:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    403a:	5b                   	pop    %ebx
+    403b:	5e                   	pop    %esi
+    403c:	5d                   	pop    %ebp
+    403d:	c3                   	ret
+      exit();
+    403e:	e8 f0 0a 00 00       	call   4b33 <exit>
+      printf(stdout, "link should not succeed\n");
+    4043:	83 ec 08             	sub    $0x8,%esp
+    4046:	68 62 62 00 00       	push   $0x6262
+    404b:	ff 35 38 79 00 00    	push   0x7938
+    4051:	e8 6a 0c 00 00       	call   4cc0 <printf>
+      exit();
+    4056:	e8 d8 0a 00 00       	call   4b33 <exit>
+    405b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    405f:	90                   	nop
+
+00004060 <bsstest>:
+{
+    4060:	55                   	push   %ebp
+    4061:	89 e5                	mov    %esp,%ebp
+    4063:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    4066:	68 88 62 00 00       	push   $0x6288
+    406b:	ff 35 38 79 00 00    	push   0x7938
+    4071:	e8 4a 0c 00 00       	call   4cc0 <printf>
+    4076:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    4079:	31 c0                	xor    %eax,%eax
+    407b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    407f:	90                   	nop
+    if(uninit[i] != '\0'){
+    4080:	80 b8 60 79 00 00 00 	cmpb   $0x0,0x7960(%eax)
+    4087:	75 22                	jne    40ab <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    4089:	83 c0 01             	add    $0x1,%eax
+    408c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    4091:	75 ed                	jne    4080 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    4093:	83 ec 08             	sub    $0x8,%esp
+    4096:	68 a3 62 00 00       	push   $0x62a3
+    409b:	ff 35 38 79 00 00    	push   0x7938
+    40a1:	e8 1a 0c 00 00       	call   4cc0 <printf>
+}
+    40a6:	83 c4 10             	add    $0x10,%esp
+    40a9:	c9                   	leave
+    40aa:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    40ab:	83 ec 08             	sub    $0x8,%esp
+    40ae:	68 92 62 00 00       	push   $0x6292
+    40b3:	ff 35 38 79 00 00    	push   0x7938
+    40b9:	e8 02 0c 00 00       	call   4cc0 <printf>
+      exit();
+    40be:	e8 70 0a 00 00       	call   4b33 <exit>
+    40c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    40ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000040d0 <bigargtest>:
+{
+    40d0:	55                   	push   %ebp
+    40d1:	89 e5                	mov    %esp,%ebp
+    40d3:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    40d6:	68 b0 62 00 00       	push   $0x62b0
+    40db:	e8 a3 0a 00 00       	call   4b83 <unlink>
+  pid = fork();
+    40e0:	e8 46 0a 00 00       	call   4b2b <fork>
+  if(pid == 0){
+    40e5:	83 c4 10             	add    $0x10,%esp
+    40e8:	85 c0                	test   %eax,%eax
+    40ea:	74 44                	je     4130 <bigargtest+0x60>
+  } else if(pid < 0){
+    40ec:	0f 88 c3 00 00 00    	js     41b5 <bigargtest+0xe5>
+  wait();
+    40f2:	e8 44 0a 00 00       	call   4b3b <wait>
+  fd = open("bigarg-ok", 0);
+    40f7:	83 ec 08             	sub    $0x8,%esp
+    40fa:	6a 00                	push   $0x0
+    40fc:	68 b0 62 00 00       	push   $0x62b0
+    4101:	e8 6d 0a 00 00       	call   4b73 <open>
+  if(fd < 0){
+    4106:	83 c4 10             	add    $0x10,%esp
+    4109:	85 c0                	test   %eax,%eax
+    410b:	0f 88 8d 00 00 00    	js     419e <bigargtest+0xce>
+  close(fd);
+    4111:	83 ec 0c             	sub    $0xc,%esp
+    4114:	50                   	push   %eax
+    4115:	e8 41 0a 00 00       	call   4b5b <close>
+  unlink("bigarg-ok");
+    411a:	c7 04 24 b0 62 00 00 	movl   $0x62b0,(%esp)
+    4121:	e8 5d 0a 00 00       	call   4b83 <unlink>
+}
+    4126:	83 c4 10             	add    $0x10,%esp
+    4129:	c9                   	leave
+    412a:	c3                   	ret
+    412b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    412f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    4130:	c7 04 85 80 c0 00 00 	movl   $0x6ca0,0xc080(,%eax,4)
+    4137:	a0 6c 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    413b:	83 c0 01             	add    $0x1,%eax
+    413e:	83 f8 1f             	cmp    $0x1f,%eax
+    4141:	75 ed                	jne    4130 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    4143:	31 c9                	xor    %ecx,%ecx
+    4145:	89 0d fc c0 00 00    	mov    %ecx,0xc0fc
+    printf(stdout, "bigarg test\n");
+    414b:	50                   	push   %eax
+    414c:	50                   	push   %eax
+    414d:	68 ba 62 00 00       	push   $0x62ba
+    4152:	ff 35 38 79 00 00    	push   0x7938
+    4158:	e8 63 0b 00 00       	call   4cc0 <printf>
+    exec("echo", args);
+    415d:	58                   	pop    %eax
+    415e:	5a                   	pop    %edx
+    415f:	68 80 c0 00 00       	push   $0xc080
+    4164:	68 b0 50 00 00       	push   $0x50b0
+    4169:	e8 fd 09 00 00       	call   4b6b <exec>
+    printf(stdout, "bigarg test ok\n");
+    416e:	59                   	pop    %ecx
+    416f:	58                   	pop    %eax
+    4170:	68 c7 62 00 00       	push   $0x62c7
+    4175:	ff 35 38 79 00 00    	push   0x7938
+    417b:	e8 40 0b 00 00       	call   4cc0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    4180:	58                   	pop    %eax
+    4181:	5a                   	pop    %edx
+    4182:	68 00 02 00 00       	push   $0x200
+    4187:	68 b0 62 00 00       	push   $0x62b0
+    418c:	e8 e2 09 00 00       	call   4b73 <open>
+    close(fd);
+    4191:	89 04 24             	mov    %eax,(%esp)
+    4194:	e8 c2 09 00 00       	call   4b5b <close>
+    exit();
+    4199:	e8 95 09 00 00       	call   4b33 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    419e:	50                   	push   %eax
+    419f:	50                   	push   %eax
+    41a0:	68 f0 62 00 00       	push   $0x62f0
+    41a5:	ff 35 38 79 00 00    	push   0x7938
+    41ab:	e8 10 0b 00 00       	call   4cc0 <printf>
+    exit();
+    41b0:	e8 7e 09 00 00       	call   4b33 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    41b5:	52                   	push   %edx
+    41b6:	52                   	push   %edx
+    41b7:	68 d7 62 00 00       	push   $0x62d7
+    41bc:	ff 35 38 79 00 00    	push   0x7938
+    41c2:	e8 f9 0a 00 00       	call   4cc0 <printf>
+    exit();
+    41c7:	e8 67 09 00 00       	call   4b33 <exit>
+    41cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000041d0 <fsfull>:
+{
+    41d0:	55                   	push   %ebp
+    41d1:	89 e5                	mov    %esp,%ebp
+    41d3:	57                   	push   %edi
+    41d4:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    41d5:	31 f6                	xor    %esi,%esi
+{
+    41d7:	53                   	push   %ebx
+    41d8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    41db:	68 05 63 00 00       	push   $0x6305
+    41e0:	6a 01                	push   $0x1
+    41e2:	e8 d9 0a 00 00       	call   4cc0 <printf>
+    41e7:	83 c4 10             	add    $0x10,%esp
+    41ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    41f0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    41f5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    41fa:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    41fd:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4201:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    4203:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4207:	c1 ea 06             	shr    $0x6,%edx
+    420a:	8d 42 30             	lea    0x30(%edx),%eax
+    420d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4210:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4216:	89 f2                	mov    %esi,%edx
+    4218:	29 c2                	sub    %eax,%edx
+    421a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    421f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4221:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4226:	c1 ea 05             	shr    $0x5,%edx
+    4229:	83 c2 30             	add    $0x30,%edx
+    422c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    422f:	f7 e6                	mul    %esi
+    4231:	c1 ea 05             	shr    $0x5,%edx
+    4234:	6b c2 64             	imul   $0x64,%edx,%eax
+    4237:	89 f2                	mov    %esi,%edx
+    4239:	29 c2                	sub    %eax,%edx
+    423b:	89 d0                	mov    %edx,%eax
+    423d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    423f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4241:	c1 ea 03             	shr    $0x3,%edx
+    4244:	83 c2 30             	add    $0x30,%edx
+    4247:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    424a:	f7 e1                	mul    %ecx
+    424c:	89 f0                	mov    %esi,%eax
+    424e:	c1 ea 03             	shr    $0x3,%edx
+    4251:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4254:	01 d2                	add    %edx,%edx
+    4256:	29 d0                	sub    %edx,%eax
+    4258:	83 c0 30             	add    $0x30,%eax
+    425b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    425e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4261:	50                   	push   %eax
+    4262:	68 12 63 00 00       	push   $0x6312
+    4267:	6a 01                	push   $0x1
+    4269:	e8 52 0a 00 00       	call   4cc0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    426e:	58                   	pop    %eax
+    426f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4272:	5a                   	pop    %edx
+    4273:	68 02 02 00 00       	push   $0x202
+    4278:	50                   	push   %eax
+    4279:	e8 f5 08 00 00       	call   4b73 <open>
+    if(fd < 0){
+    427e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    4281:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    4283:	85 c0                	test   %eax,%eax
+    4285:	78 4f                	js     42d6 <fsfull+0x106>
+    int total = 0;
+    4287:	31 db                	xor    %ebx,%ebx
+    4289:	eb 07                	jmp    4292 <fsfull+0xc2>
+    428b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    428f:	90                   	nop
+      total += cc;
+    4290:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4292:	83 ec 04             	sub    $0x4,%esp
+    4295:	68 00 02 00 00       	push   $0x200
+    429a:	68 80 a0 00 00       	push   $0xa080
+    429f:	57                   	push   %edi
+    42a0:	e8 ae 08 00 00       	call   4b53 <write>
+      if(cc < 512)
+    42a5:	83 c4 10             	add    $0x10,%esp
+    42a8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    42ad:	7f e1                	jg     4290 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    42af:	83 ec 04             	sub    $0x4,%esp
+    42b2:	53                   	push   %ebx
+    42b3:	68 1e 63 00 00       	push   $0x631e
+    42b8:	6a 01                	push   $0x1
+    42ba:	e8 01 0a 00 00       	call   4cc0 <printf>
+    close(fd);
+    42bf:	89 3c 24             	mov    %edi,(%esp)
+    42c2:	e8 94 08 00 00       	call   4b5b <close>
+    if(total == 0)
+    42c7:	83 c4 10             	add    $0x10,%esp
+    42ca:	85 db                	test   %ebx,%ebx
+    42cc:	74 1e                	je     42ec <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    42ce:	83 c6 01             	add    $0x1,%esi
+    42d1:	e9 1a ff ff ff       	jmp    41f0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    42d6:	83 ec 04             	sub    $0x4,%esp
+    42d9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    42dc:	50                   	push   %eax
+    42dd:	68 39 5e 00 00       	push   $0x5e39
+    42e2:	6a 01                	push   $0x1
+    42e4:	e8 d7 09 00 00       	call   4cc0 <printf>
+      break;
+    42e9:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    42ec:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    42f1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    42f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42fd:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4300:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    4302:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    4305:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4309:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    430b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    430f:	c1 ea 06             	shr    $0x6,%edx
+    4312:	8d 42 30             	lea    0x30(%edx),%eax
+    4315:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4318:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    431e:	89 f2                	mov    %esi,%edx
+    4320:	29 c2                	sub    %eax,%edx
+    4322:	89 d0                	mov    %edx,%eax
+    4324:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4326:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4328:	c1 ea 05             	shr    $0x5,%edx
+    432b:	83 c2 30             	add    $0x30,%edx
+    432e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4331:	f7 e3                	mul    %ebx
+    4333:	c1 ea 05             	shr    $0x5,%edx
+    4336:	6b ca 64             	imul   $0x64,%edx,%ecx
+    4339:	89 f2                	mov    %esi,%edx
+    433b:	29 ca                	sub    %ecx,%edx
+    433d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    4342:	89 d0                	mov    %edx,%eax
+    4344:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4346:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4348:	c1 ea 03             	shr    $0x3,%edx
+    434b:	83 c2 30             	add    $0x30,%edx
+    434e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4351:	f7 e1                	mul    %ecx
+    4353:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    4355:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    4358:	c1 ea 03             	shr    $0x3,%edx
+    435b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    435e:	01 d2                	add    %edx,%edx
+    4360:	29 d0                	sub    %edx,%eax
+    4362:	83 c0 30             	add    $0x30,%eax
+    4365:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    4368:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    436b:	50                   	push   %eax
+    436c:	e8 12 08 00 00       	call   4b83 <unlink>
+  while(nfiles >= 0){
+    4371:	83 c4 10             	add    $0x10,%esp
+    4374:	83 fe ff             	cmp    $0xffffffff,%esi
+    4377:	75 87                	jne    4300 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    4379:	83 ec 08             	sub    $0x8,%esp
+    437c:	68 2e 63 00 00       	push   $0x632e
+    4381:	6a 01                	push   $0x1
+    4383:	e8 38 09 00 00       	call   4cc0 <printf>
+}
+    4388:	83 c4 10             	add    $0x10,%esp
+    438b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    438e:	5b                   	pop    %ebx
+    438f:	5e                   	pop    %esi
+    4390:	5f                   	pop    %edi
+    4391:	5d                   	pop    %ebp
+    4392:	c3                   	ret
+    4393:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    439a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000043a0 <uio>:
+{
+    43a0:	55                   	push   %ebp
+    43a1:	89 e5                	mov    %esp,%ebp
+    43a3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    43a6:	68 44 63 00 00       	push   $0x6344
+    43ab:	6a 01                	push   $0x1
+    43ad:	e8 0e 09 00 00       	call   4cc0 <printf>
+  pid = fork();
+    43b2:	e8 74 07 00 00       	call   4b2b <fork>
+  if(pid == 0){
+    43b7:	83 c4 10             	add    $0x10,%esp
+    43ba:	85 c0                	test   %eax,%eax
+    43bc:	74 1b                	je     43d9 <uio+0x39>
+  } else if(pid < 0){
+    43be:	78 3d                	js     43fd <uio+0x5d>
+  wait();
+    43c0:	e8 76 07 00 00       	call   4b3b <wait>
+  printf(1, "uio test done\n");
+    43c5:	83 ec 08             	sub    $0x8,%esp
+    43c8:	68 4e 63 00 00       	push   $0x634e
+    43cd:	6a 01                	push   $0x1
+    43cf:	e8 ec 08 00 00       	call   4cc0 <printf>
+}
+    43d4:	83 c4 10             	add    $0x10,%esp
+    43d7:	c9                   	leave
+    43d8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    43d9:	b8 09 00 00 00       	mov    $0x9,%eax
+    43de:	ba 70 00 00 00       	mov    $0x70,%edx
+    43e3:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    43e4:	ba 71 00 00 00       	mov    $0x71,%edx
+    43e9:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    43ea:	52                   	push   %edx
+    43eb:	52                   	push   %edx
+    43ec:	68 80 6d 00 00       	push   $0x6d80
+    43f1:	6a 01                	push   $0x1
+    43f3:	e8 c8 08 00 00       	call   4cc0 <printf>
+    exit();
+    43f8:	e8 36 07 00 00       	call   4b33 <exit>
+    printf (1, "fork failed\n");
+    43fd:	50                   	push   %eax
+    43fe:	50                   	push   %eax
+    43ff:	68 25 54 00 00       	push   $0x5425
+    4404:	6a 01                	push   $0x1
+    4406:	e8 b5 08 00 00       	call   4cc0 <printf>
+    exit();
+    440b:	e8 23 07 00 00       	call   4b33 <exit>
+
+00004410 <argptest>:
+{
+    4410:	55                   	push   %ebp
+    4411:	89 e5                	mov    %esp,%ebp
+    4413:	53                   	push   %ebx
+    4414:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    4417:	6a 00                	push   $0x0
+    4419:	68 5d 63 00 00       	push   $0x635d
+    441e:	e8 50 07 00 00       	call   4b73 <open>
+  if (fd < 0) {
+    4423:	83 c4 10             	add    $0x10,%esp
+    4426:	85 c0                	test   %eax,%eax
+    4428:	78 39                	js     4463 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    442a:	83 ec 0c             	sub    $0xc,%esp
+    442d:	89 c3                	mov    %eax,%ebx
+    442f:	6a 00                	push   $0x0
+    4431:	e8 85 07 00 00       	call   4bbb <sbrk>
+    4436:	83 c4 0c             	add    $0xc,%esp
+    4439:	83 e8 01             	sub    $0x1,%eax
+    443c:	6a ff                	push   $0xffffffff
+    443e:	50                   	push   %eax
+    443f:	53                   	push   %ebx
+    4440:	e8 06 07 00 00       	call   4b4b <read>
+  close(fd);
+    4445:	89 1c 24             	mov    %ebx,(%esp)
+    4448:	e8 0e 07 00 00       	call   4b5b <close>
+  printf(1, "arg test passed\n");
+    444d:	58                   	pop    %eax
+    444e:	5a                   	pop    %edx
+    444f:	68 6f 63 00 00       	push   $0x636f
+    4454:	6a 01                	push   $0x1
+    4456:	e8 65 08 00 00       	call   4cc0 <printf>
+}
+    445b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    445e:	83 c4 10             	add    $0x10,%esp
+    4461:	c9                   	leave
+    4462:	c3                   	ret
+    printf(2, "open failed\n");
+    4463:	51                   	push   %ecx
+    4464:	51                   	push   %ecx
+    4465:	68 62 63 00 00       	push   $0x6362
+    446a:	6a 02                	push   $0x2
+    446c:	e8 4f 08 00 00       	call   4cc0 <printf>
+    exit();
+    4471:	e8 bd 06 00 00       	call   4b33 <exit>
+    4476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    447d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004480 <bcachetest>:
+{
+    4480:	55                   	push   %ebp
+    4481:	89 e5                	mov    %esp,%ebp
+    4483:	53                   	push   %ebx
+    4484:	83 ec 3c             	sub    $0x3c,%esp
+  printf(1, "bcache test\n");
+    4487:	68 80 63 00 00       	push   $0x6380
+    448c:	6a 01                	push   $0x1
+    448e:	e8 2d 08 00 00       	call   4cc0 <printf>
+  fd = open("bcachefile", O_CREATE|O_RDWR);
+    4493:	58                   	pop    %eax
+    4494:	5a                   	pop    %edx
+    4495:	68 02 02 00 00       	push   $0x202
+    449a:	68 8d 63 00 00       	push   $0x638d
+    449f:	e8 cf 06 00 00       	call   4b73 <open>
+  if(fd < 0 || write(fd, buf, 512) != 512){
+    44a4:	83 c4 10             	add    $0x10,%esp
+    44a7:	85 c0                	test   %eax,%eax
+    44a9:	0f 88 f8 00 00 00    	js     45a7 <bcachetest+0x127>
+    44af:	83 ec 04             	sub    $0x4,%esp
+    44b2:	89 c3                	mov    %eax,%ebx
+    44b4:	68 00 02 00 00       	push   $0x200
+    44b9:	68 80 a0 00 00       	push   $0xa080
+    44be:	50                   	push   %eax
+    44bf:	e8 8f 06 00 00       	call   4b53 <write>
+    44c4:	83 c4 10             	add    $0x10,%esp
+    44c7:	3d 00 02 00 00       	cmp    $0x200,%eax
+    44cc:	0f 85 d5 00 00 00    	jne    45a7 <bcachetest+0x127>
+  close(fd);
+    44d2:	83 ec 0c             	sub    $0xc,%esp
+    44d5:	53                   	push   %ebx
+    44d6:	e8 80 06 00 00       	call   4b5b <close>
+  if(bcstat(&a) < 0 || a.nbuf != NBUF || a.nhot > a.nbuf){
+    44db:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    44de:	89 04 24             	mov    %eax,(%esp)
+    44e1:	e8 25 07 00 00       	call   4c0b <bcstat>
+    44e6:	83 c4 10             	add    $0x10,%esp
+    44e9:	85 c0                	test   %eax,%eax
+    44eb:	0f 88 a2 00 00 00    	js     4593 <bcachetest+0x113>
+    44f1:	83 7d c8 50          	cmpl   $0x50,-0x38(%ebp)
+    44f5:	0f 85 98 00 00 00    	jne    4593 <bcachetest+0x113>
+    44fb:	83 7d cc 50          	cmpl   $0x50,-0x34(%ebp)
+    44ff:	0f 87 8e 00 00 00    	ja     4593 <bcachetest+0x113>
+  fd = open("bcachefile", O_RDONLY);
+    4505:	83 ec 08             	sub    $0x8,%esp
+    4508:	6a 00                	push   $0x0
+    450a:	68 8d 63 00 00       	push   $0x638d
+    450f:	e8 5f 06 00 00       	call   4b73 <open>
+  if(fd < 0 || read(fd, buf, 512) != 512){
+    4514:	83 c4 10             	add    $0x10,%esp
+  fd = open("bcachefile", O_RDONLY);
+    4517:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || read(fd, buf, 512) != 512){
+    4519:	85 c0                	test   %eax,%eax
+    451b:	0f 88 ac 00 00 00    	js     45cd <bcachetest+0x14d>
+    4521:	83 ec 04             	sub    $0x4,%esp
+    4524:	68 00 02 00 00       	push   $0x200
+    4529:	68 80 a0 00 00       	push   $0xa080
+    452e:	50                   	push   %eax
+    452f:	e8 17 06 00 00       	call   4b4b <read>
+    4534:	83 c4 10             	add    $0x10,%esp
+    4537:	3d 00 02 00 00       	cmp    $0x200,%eax
+    453c:	0f 85 8b 00 00 00    	jne    45cd <bcachetest+0x14d>
+  close(fd);
+    4542:	83 ec 0c             	sub    $0xc,%esp
+    4545:	53                   	push   %ebx
+    4546:	e8 10 06 00 00       	call   4b5b <close>
+  bcstat(&b);
+    454b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    454e:	89 04 24             	mov    %eax,(%esp)
+    4551:	e8 b5 06 00 00       	call   4c0b <bcstat>
+  if(b.hits == a.hits || b.hits + b.misses < a.hits + a.misses + 2){
+    4556:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    4559:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    455c:	83 c4 10             	add    $0x10,%esp
+    455f:	39 c2                	cmp    %eax,%edx
+    4561:	74 57                	je     45ba <bcachetest+0x13a>
+    4563:	03 45 d4             	add    -0x2c(%ebp),%eax
+    4566:	03 55 ec             	add    -0x14(%ebp),%edx
+    4569:	83 c0 02             	add    $0x2,%eax
+    456c:	39 c2                	cmp    %eax,%edx
+    456e:	72 4a                	jb     45ba <bcachetest+0x13a>
+  unlink("bcachefile");
+    4570:	83 ec 0c             	sub    $0xc,%esp
+    4573:	68 8d 63 00 00       	push   $0x638d
+    4578:	e8 06 06 00 00       	call   4b83 <unlink>
+  printf(1, "bcache ok\n");
+    457d:	58                   	pop    %eax
+    457e:	5a                   	pop    %edx
+    457f:	68 db 63 00 00       	push   $0x63db
+    4584:	6a 01                	push   $0x1
+    4586:	e8 35 07 00 00       	call   4cc0 <printf>
+}
+    458b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    458e:	83 c4 10             	add    $0x10,%esp
+    4591:	c9                   	leave
+    4592:	c3                   	ret
+    printf(1, "bcache: bcstat failed\n");
+    4593:	83 ec 08             	sub    $0x8,%esp
+    4596:	68 af 63 00 00       	push   $0x63af
+    459b:	6a 01                	push   $0x1
+    459d:	e8 1e 07 00 00       	call   4cc0 <printf>
+    exit();
+    45a2:	e8 8c 05 00 00       	call   4b33 <exit>
+    printf(1, "bcache: create failed\n");
+    45a7:	50                   	push   %eax
+    45a8:	50                   	push   %eax
+    45a9:	68 98 63 00 00       	push   $0x6398
+    45ae:	6a 01                	push   $0x1
+    45b0:	e8 0b 07 00 00       	call   4cc0 <printf>
+    exit();
+    45b5:	e8 79 05 00 00       	call   4b33 <exit>
+    printf(1, "bcache: counters did not move\n");
+    45ba:	51                   	push   %ecx
+    45bb:	51                   	push   %ecx
+    45bc:	68 a4 6d 00 00       	push   $0x6da4
+    45c1:	6a 01                	push   $0x1
+    45c3:	e8 f8 06 00 00       	call   4cc0 <printf>
+    exit();
+    45c8:	e8 66 05 00 00       	call   4b33 <exit>
+    printf(1, "bcache: read failed\n");
+    45cd:	53                   	push   %ebx
+    45ce:	53                   	push   %ebx
+    45cf:	68 c6 63 00 00       	push   $0x63c6
+    45d4:	6a 01                	push   $0x1
+    45d6:	e8 e5 06 00 00       	call   4cc0 <printf>
+    exit();
+    45db:	e8 53 05 00 00       	call   4b33 <exit>
+
+000045e0 <mmaptest>:
+{
+    45e0:	55                   	push   %ebp
+    45e1:	89 e5                	mov    %esp,%ebp
+    45e3:	56                   	push   %esi
+    45e4:	53                   	push   %ebx
+    buf[i] = 'a' + i % 26;
+    45e5:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+  printf(1, "mmap test\n");
+    45ea:	83 ec 08             	sub    $0x8,%esp
+    45ed:	68 e6 63 00 00       	push   $0x63e6
+    45f2:	6a 01                	push   $0x1
+    45f4:	e8 c7 06 00 00       	call   4cc0 <printf>
+    45f9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(buf); i++)
+    45fc:	31 c9                	xor    %ecx,%ecx
+    45fe:	66 90                	xchg   %ax,%ax
+    buf[i] = 'a' + i % 26;
+    4600:	89 c8                	mov    %ecx,%eax
+    4602:	f7 e3                	mul    %ebx
+    4604:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < sizeof(buf); i++)
+    4606:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 26;
+    4609:	c1 ea 03             	shr    $0x3,%edx
+    460c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    460f:	29 d0                	sub    %edx,%eax
+    4611:	83 c0 61             	add    $0x61,%eax
+    4614:	88 81 7f a0 00 00    	mov    %al,0xa07f(%ecx)
+  for(i = 0; i < sizeof(buf); i++)
+    461a:	81 f9 00 20 00 00    	cmp    $0x2000,%ecx
+    4620:	75 de                	jne    4600 <mmaptest+0x20>
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    4622:	83 ec 08             	sub    $0x8,%esp
+    4625:	68 02 02 00 00       	push   $0x202
+    462a:	68 f1 63 00 00       	push   $0x63f1
+    462f:	e8 3f 05 00 00       	call   4b73 <open>
+  if(fd < 0 || write(fd, buf, n) != n){
+    4634:	83 c4 10             	add    $0x10,%esp
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    4637:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || write(fd, buf, n) != n){
+    4639:	85 c0                	test   %eax,%eax
+    463b:	0f 88 64 02 00 00    	js     48a5 <mmaptest+0x2c5>
+    4641:	83 ec 04             	sub    $0x4,%esp
+    4644:	68 d0 17 00 00       	push   $0x17d0
+    4649:	68 80 a0 00 00       	push   $0xa080
+    464e:	50                   	push   %eax
+    464f:	e8 ff 04 00 00       	call   4b53 <write>
+    4654:	83 c4 10             	add    $0x10,%esp
+    4657:	3d d0 17 00 00       	cmp    $0x17d0,%eax
+    465c:	0f 85 43 02 00 00    	jne    48a5 <mmaptest+0x2c5>
+  p = mmap(0, n, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    4662:	83 ec 08             	sub    $0x8,%esp
+    4665:	6a 00                	push   $0x0
+    4667:	56                   	push   %esi
+    4668:	6a 02                	push   $0x2
+    466a:	6a 03                	push   $0x3
+    466c:	68 d0 17 00 00       	push   $0x17d0
+    4671:	6a 00                	push   $0x0
+    4673:	e8 83 05 00 00       	call   4bfb <mmap>
+  if(p == (char*)-1){
+    4678:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, n, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    467b:	89 c3                	mov    %eax,%ebx
+  if(p == (char*)-1){
+    467d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4680:	0f 84 32 02 00 00    	je     48b8 <mmaptest+0x2d8>
+  for(i = 0; i < n; i++){
+    4686:	31 c0                	xor    %eax,%eax
+    4688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    468f:	90                   	nop
+    if(p[i] != buf[i]){
+    4690:	0f b6 88 80 a0 00 00 	movzbl 0xa080(%eax),%ecx
+    4697:	38 0c 03             	cmp    %cl,(%ebx,%eax,1)
+    469a:	0f 85 91 01 00 00    	jne    4831 <mmaptest+0x251>
+  for(i = 0; i < n; i++){
+    46a0:	83 c0 01             	add    $0x1,%eax
+    46a3:	3d d0 17 00 00       	cmp    $0x17d0,%eax
+    46a8:	75 e6                	jne    4690 <mmaptest+0xb0>
+  p[0] = 'X';
+    46aa:	c6 03 58             	movb   $0x58,(%ebx)
+  pid = fork();
+    46ad:	e8 79 04 00 00       	call   4b2b <fork>
+  if(pid < 0){
+    46b2:	85 c0                	test   %eax,%eax
+    46b4:	0f 88 d8 01 00 00    	js     4892 <mmaptest+0x2b2>
+  if(pid == 0){
+    46ba:	75 2c                	jne    46e8 <mmaptest+0x108>
+    if(p[0] != 'X' || p[n-1] != buf[n-1]){
+    46bc:	80 3b 58             	cmpb   $0x58,(%ebx)
+    46bf:	75 13                	jne    46d4 <mmaptest+0xf4>
+    46c1:	0f b6 05 4f b8 00 00 	movzbl 0xb84f,%eax
+    46c8:	38 83 cf 17 00 00    	cmp    %al,0x17cf(%ebx)
+    46ce:	0f 84 58 01 00 00    	je     482c <mmaptest+0x24c>
+      printf(1, "mmap: child sees wrong content\n");
+    46d4:	83 ec 08             	sub    $0x8,%esp
+    46d7:	68 c4 6d 00 00       	push   $0x6dc4
+    46dc:	6a 01                	push   $0x1
+    46de:	e8 dd 05 00 00       	call   4cc0 <printf>
+      exit();
+    46e3:	e8 4b 04 00 00       	call   4b33 <exit>
+  wait();
+    46e8:	e8 4e 04 00 00       	call   4b3b <wait>
+  if(munmap(p, n) < 0){
+    46ed:	83 ec 08             	sub    $0x8,%esp
+    46f0:	68 d0 17 00 00       	push   $0x17d0
+    46f5:	53                   	push   %ebx
+    46f6:	e8 08 05 00 00       	call   4c03 <munmap>
+    46fb:	83 c4 10             	add    $0x10,%esp
+    46fe:	85 c0                	test   %eax,%eax
+    4700:	0f 88 40 01 00 00    	js     4846 <mmaptest+0x266>
+  p = mmap(0, n, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    4706:	83 ec 08             	sub    $0x8,%esp
+    4709:	6a 00                	push   $0x0
+    470b:	56                   	push   %esi
+    470c:	6a 01                	push   $0x1
+    470e:	6a 03                	push   $0x3
+    4710:	68 d0 17 00 00       	push   $0x17d0
+    4715:	6a 00                	push   $0x0
+    4717:	e8 df 04 00 00       	call   4bfb <mmap>
+  if(p == (char*)-1){
+    471c:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, n, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    471f:	89 c3                	mov    %eax,%ebx
+  if(p == (char*)-1){
+    4721:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4724:	0f 84 2f 01 00 00    	je     4859 <mmaptest+0x279>
+  close(fd);
+    472a:	83 ec 0c             	sub    $0xc,%esp
+  p[4096] = 'Y';
+    472d:	c6 80 00 10 00 00 59 	movb   $0x59,0x1000(%eax)
+  close(fd);
+    4734:	56                   	push   %esi
+    4735:	e8 21 04 00 00       	call   4b5b <close>
+  fd = open("mmapcopy", O_CREATE|O_RDWR);
+    473a:	58                   	pop    %eax
+    473b:	5a                   	pop    %edx
+    473c:	68 02 02 00 00       	push   $0x202
+    4741:	68 85 64 00 00       	push   $0x6485
+    4746:	e8 28 04 00 00       	call   4b73 <open>
+  if(fd < 0 || write(fd, p + 4000, 200) != 200){
+    474b:	83 c4 10             	add    $0x10,%esp
+  fd = open("mmapcopy", O_CREATE|O_RDWR);
+    474e:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || write(fd, p + 4000, 200) != 200){
+    4750:	85 c0                	test   %eax,%eax
+    4752:	0f 88 14 01 00 00    	js     486c <mmaptest+0x28c>
+    4758:	83 ec 04             	sub    $0x4,%esp
+    475b:	8d 83 a0 0f 00 00    	lea    0xfa0(%ebx),%eax
+    4761:	68 c8 00 00 00       	push   $0xc8
+    4766:	50                   	push   %eax
+    4767:	56                   	push   %esi
+    4768:	e8 e6 03 00 00       	call   4b53 <write>
+    476d:	83 c4 10             	add    $0x10,%esp
+    4770:	3d c8 00 00 00       	cmp    $0xc8,%eax
+    4775:	0f 85 f1 00 00 00    	jne    486c <mmaptest+0x28c>
+  close(fd);
+    477b:	83 ec 0c             	sub    $0xc,%esp
+    477e:	56                   	push   %esi
+    477f:	e8 d7 03 00 00       	call   4b5b <close>
+  if(munmap(p, n) < 0){
+    4784:	5e                   	pop    %esi
+    4785:	58                   	pop    %eax
+    4786:	68 d0 17 00 00       	push   $0x17d0
+    478b:	53                   	push   %ebx
+    478c:	e8 72 04 00 00       	call   4c03 <munmap>
+    4791:	83 c4 10             	add    $0x10,%esp
+    4794:	85 c0                	test   %eax,%eax
+    4796:	0f 88 aa 00 00 00    	js     4846 <mmaptest+0x266>
+  fd = open("mmapfile", O_RDONLY);
+    479c:	83 ec 08             	sub    $0x8,%esp
+    479f:	6a 00                	push   $0x0
+    47a1:	68 f1 63 00 00       	push   $0x63f1
+    47a6:	e8 c8 03 00 00       	call   4b73 <open>
+  if(fd < 0 || read(fd, buf, n) != n || buf[0] != 'a' || buf[4096] != 'Y'){
+    47ab:	83 c4 10             	add    $0x10,%esp
+  fd = open("mmapfile", O_RDONLY);
+    47ae:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || read(fd, buf, n) != n || buf[0] != 'a' || buf[4096] != 'Y'){
+    47b0:	85 c0                	test   %eax,%eax
+    47b2:	0f 88 c7 00 00 00    	js     487f <mmaptest+0x29f>
+    47b8:	83 ec 04             	sub    $0x4,%esp
+    47bb:	68 d0 17 00 00       	push   $0x17d0
+    47c0:	68 80 a0 00 00       	push   $0xa080
+    47c5:	50                   	push   %eax
+    47c6:	e8 80 03 00 00       	call   4b4b <read>
+    47cb:	83 c4 10             	add    $0x10,%esp
+    47ce:	3d d0 17 00 00       	cmp    $0x17d0,%eax
+    47d3:	0f 85 a6 00 00 00    	jne    487f <mmaptest+0x29f>
+    47d9:	80 3d 80 a0 00 00 61 	cmpb   $0x61,0xa080
+    47e0:	0f 85 99 00 00 00    	jne    487f <mmaptest+0x29f>
+    47e6:	80 3d 80 b0 00 00 59 	cmpb   $0x59,0xb080
+    47ed:	0f 85 8c 00 00 00    	jne    487f <mmaptest+0x29f>
+  close(fd);
+    47f3:	83 ec 0c             	sub    $0xc,%esp
+    47f6:	53                   	push   %ebx
+    47f7:	e8 5f 03 00 00       	call   4b5b <close>
+  unlink("mmapfile");
+    47fc:	c7 04 24 f1 63 00 00 	movl   $0x63f1,(%esp)
+    4803:	e8 7b 03 00 00       	call   4b83 <unlink>
+  unlink("mmapcopy");
+    4808:	c7 04 24 85 64 00 00 	movl   $0x6485,(%esp)
+    480f:	e8 6f 03 00 00       	call   4b83 <unlink>
+  printf(1, "mmap test ok\n");
+    4814:	58                   	pop    %eax
+    4815:	5a                   	pop    %edx
+    4816:	68 8e 64 00 00       	push   $0x648e
+    481b:	6a 01                	push   $0x1
+    481d:	e8 9e 04 00 00       	call   4cc0 <printf>
+}
+    4822:	83 c4 10             	add    $0x10,%esp
+    4825:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4828:	5b                   	pop    %ebx
+    4829:	5e                   	pop    %esi
+    482a:	5d                   	pop    %ebp
+    482b:	c3                   	ret
+    exit();
+    482c:	e8 02 03 00 00       	call   4b33 <exit>
+      printf(1, "mmap: wrong content at %d\n", i);
+    4831:	83 ec 04             	sub    $0x4,%esp
+    4834:	50                   	push   %eax
+    4835:	68 29 64 00 00       	push   $0x6429
+    483a:	6a 01                	push   $0x1
+    483c:	e8 7f 04 00 00       	call   4cc0 <printf>
+      exit();
+    4841:	e8 ed 02 00 00       	call   4b33 <exit>
+    printf(1, "mmap: munmap failed\n");
+    4846:	53                   	push   %ebx
+    4847:	53                   	push   %ebx
+    4848:	68 57 64 00 00       	push   $0x6457
+    484d:	6a 01                	push   $0x1
+    484f:	e8 6c 04 00 00       	call   4cc0 <printf>
+    exit();
+    4854:	e8 da 02 00 00       	call   4b33 <exit>
+    printf(1, "mmap: MAP_SHARED failed\n");
+    4859:	51                   	push   %ecx
+    485a:	51                   	push   %ecx
+    485b:	68 6c 64 00 00       	push   $0x646c
+    4860:	6a 01                	push   $0x1
+    4862:	e8 59 04 00 00       	call   4cc0 <printf>
+    exit();
+    4867:	e8 c7 02 00 00       	call   4b33 <exit>
+    printf(1, "mmap: write from mapping failed\n");
+    486c:	50                   	push   %eax
+    486d:	50                   	push   %eax
+    486e:	68 e4 6d 00 00       	push   $0x6de4
+    4873:	6a 01                	push   $0x1
+    4875:	e8 46 04 00 00       	call   4cc0 <printf>
+    exit();
+    487a:	e8 b4 02 00 00       	call   4b33 <exit>
+    printf(1, "mmap: shared store not written back\n");
+    487f:	51                   	push   %ecx
+    4880:	51                   	push   %ecx
+    4881:	68 08 6e 00 00       	push   $0x6e08
+    4886:	6a 01                	push   $0x1
+    4888:	e8 33 04 00 00       	call   4cc0 <printf>
+    exit();
+    488d:	e8 a1 02 00 00       	call   4b33 <exit>
+    printf(1, "mmap: fork failed\n");
+    4892:	56                   	push   %esi
+    4893:	56                   	push   %esi
+    4894:	68 44 64 00 00       	push   $0x6444
+    4899:	6a 01                	push   $0x1
+    489b:	e8 20 04 00 00       	call   4cc0 <printf>
+    exit();
+    48a0:	e8 8e 02 00 00       	call   4b33 <exit>
+    printf(1, "mmap: create failed\n");
+    48a5:	50                   	push   %eax
+    48a6:	50                   	push   %eax
+    48a7:	68 fa 63 00 00       	push   $0x63fa
+    48ac:	6a 01                	push   $0x1
+    48ae:	e8 0d 04 00 00       	call   4cc0 <printf>
+    exit();
+    48b3:	e8 7b 02 00 00       	call   4b33 <exit>
+    printf(1, "mmap: MAP_PRIVATE failed\n");
+    48b8:	50                   	push   %eax
+    48b9:	50                   	push   %eax
+    48ba:	68 0f 64 00 00       	push   $0x640f
+    48bf:	6a 01                	push   $0x1
+    48c1:	e8 fa 03 00 00       	call   4cc0 <printf>
+    exit();
+    48c6:	e8 68 02 00 00       	call   4b33 <exit>
+    48cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    48cf:	90                   	nop
+
+000048d0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    48d0:	69 05 34 79 00 00 0d 	imul   $0x19660d,0x7934,%eax
+    48d7:	66 19 00 
+    48da:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    48df:	a3 34 79 00 00       	mov    %eax,0x7934
+}
+    48e4:	c3                   	ret
+    48e5:	66 90                	xchg   %ax,%ax
+    48e7:	66 90                	xchg   %ax,%ax
+    48e9:	66 90                	xchg   %ax,%ax
+    48eb:	66 90                	xchg   %ax,%ax
+    48ed:	66 90                	xchg   %ax,%ax
+    48ef:	90                   	nop
+
+000048f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    48f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    48f1:	31 c0                	xor    %eax,%eax
+{
+    48f3:	89 e5                	mov    %esp,%ebp
+    48f5:	53                   	push   %ebx
+    48f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    48f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    48fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4900:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4904:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4907:	83 c0 01             	add    $0x1,%eax
+    490a:	84 d2                	test   %dl,%dl
+    490c:	75 f2                	jne    4900 <strcpy+0x10>
+    ;
+  return os;
+}
+    490e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4911:	89 c8                	mov    %ecx,%eax
+    4913:	c9                   	leave
+    4914:	c3                   	ret
+    4915:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    491c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004920 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    4920:	55                   	push   %ebp
+    4921:	89 e5                	mov    %esp,%ebp
+    4923:	53                   	push   %ebx
+    4924:	8b 55 08             	mov    0x8(%ebp),%edx
+    4927:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    492a:	0f b6 02             	movzbl (%edx),%eax
+    492d:	84 c0                	test   %al,%al
+    492f:	75 17                	jne    4948 <strcmp+0x28>
+    4931:	eb 3a                	jmp    496d <strcmp+0x4d>
+    4933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4937:	90                   	nop
+    4938:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    493c:	83 c2 01             	add    $0x1,%edx
+    493f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    4942:	84 c0                	test   %al,%al
+    4944:	74 1a                	je     4960 <strcmp+0x40>
+    p++, q++;
+    4946:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    4948:	0f b6 19             	movzbl (%ecx),%ebx
+    494b:	38 c3                	cmp    %al,%bl
+    494d:	74 e9                	je     4938 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    494f:	29 d8                	sub    %ebx,%eax
+}
+    4951:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4954:	c9                   	leave
+    4955:	c3                   	ret
+    4956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    495d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    4960:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    4964:	31 c0                	xor    %eax,%eax
+    4966:	29 d8                	sub    %ebx,%eax
+}
+    4968:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    496b:	c9                   	leave
+    496c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    496d:	0f b6 19             	movzbl (%ecx),%ebx
+    4970:	31 c0                	xor    %eax,%eax
+    4972:	eb db                	jmp    494f <strcmp+0x2f>
+    4974:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    497b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    497f:	90                   	nop
+
+00004980 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    4980:	55                   	push   %ebp
+    4981:	89 e5                	mov    %esp,%ebp
+    4983:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    4986:	80 3a 00             	cmpb   $0x0,(%edx)
+    4989:	74 15                	je     49a0 <strlen+0x20>
+    498b:	31 c0                	xor    %eax,%eax
+    498d:	8d 76 00             	lea    0x0(%esi),%esi
+    4990:	83 c0 01             	add    $0x1,%eax
+    4993:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    4997:	89 c1                	mov    %eax,%ecx
+    4999:	75 f5                	jne    4990 <strlen+0x10>
+    ;
+  return n;
+}
+    499b:	89 c8                	mov    %ecx,%eax
+    499d:	5d                   	pop    %ebp
+    499e:	c3                   	ret
+    499f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    49a0:	31 c9                	xor    %ecx,%ecx
+}
+    49a2:	5d                   	pop    %ebp
+    49a3:	89 c8                	mov    %ecx,%eax
+    49a5:	c3                   	ret
+    49a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000049b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    49b0:	55                   	push   %ebp
+    49b1:	89 e5                	mov    %esp,%ebp
+    49b3:	57                   	push   %edi
+    49b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    49b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    49ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+    49bd:	89 d7                	mov    %edx,%edi
+    49bf:	fc                   	cld
+    49c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    49c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    49c5:	89 d0                	mov    %edx,%eax
+    49c7:	c9                   	leave
+    49c8:	c3                   	ret
+    49c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000049d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    49d0:	55                   	push   %ebp
+    49d1:	89 e5                	mov    %esp,%ebp
+    49d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    49d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    49da:	0f b6 10             	movzbl (%eax),%edx
+    49dd:	84 d2                	test   %dl,%dl
+    49df:	75 12                	jne    49f3 <strchr+0x23>
+    49e1:	eb 1d                	jmp    4a00 <strchr+0x30>
+    49e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    49e7:	90                   	nop
+    49e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    49ec:	83 c0 01             	add    $0x1,%eax
+    49ef:	84 d2                	test   %dl,%dl
+    49f1:	74 0d                	je     4a00 <strchr+0x30>
+    if(*s == c)
+    49f3:	38 d1                	cmp    %dl,%cl
+    49f5:	75 f1                	jne    49e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    49f7:	5d                   	pop    %ebp
+    49f8:	c3                   	ret
+    49f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4a00:	31 c0                	xor    %eax,%eax
+}
+    4a02:	5d                   	pop    %ebp
+    4a03:	c3                   	ret
+    4a04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4a0f:	90                   	nop
+
+00004a10 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4a10:	55                   	push   %ebp
+    4a11:	89 e5                	mov    %esp,%ebp
+    4a13:	57                   	push   %edi
+    4a14:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4a15:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4a18:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4a19:	31 db                	xor    %ebx,%ebx
+{
+    4a1b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    4a1e:	eb 27                	jmp    4a47 <gets+0x37>
+    cc = read(0, &c, 1);
+    4a20:	83 ec 04             	sub    $0x4,%esp
+    4a23:	6a 01                	push   $0x1
+    4a25:	56                   	push   %esi
+    4a26:	6a 00                	push   $0x0
+    4a28:	e8 1e 01 00 00       	call   4b4b <read>
+    if(cc < 1)
+    4a2d:	83 c4 10             	add    $0x10,%esp
+    4a30:	85 c0                	test   %eax,%eax
+    4a32:	7e 1d                	jle    4a51 <gets+0x41>
+      break;
+    buf[i++] = c;
+    4a34:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    4a38:	8b 55 08             	mov    0x8(%ebp),%edx
+    4a3b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    4a3f:	3c 0a                	cmp    $0xa,%al
+    4a41:	74 10                	je     4a53 <gets+0x43>
+    4a43:	3c 0d                	cmp    $0xd,%al
+    4a45:	74 0c                	je     4a53 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    4a47:	89 df                	mov    %ebx,%edi
+    4a49:	83 c3 01             	add    $0x1,%ebx
+    4a4c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    4a4f:	7c cf                	jl     4a20 <gets+0x10>
+    4a51:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    4a53:	8b 45 08             	mov    0x8(%ebp),%eax
+    4a56:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    4a5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4a5d:	5b                   	pop    %ebx
+    4a5e:	5e                   	pop    %esi
+    4a5f:	5f                   	pop    %edi
+    4a60:	5d                   	pop    %ebp
+    4a61:	c3                   	ret
+    4a62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004a70 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    4a70:	55                   	push   %ebp
+    4a71:	89 e5                	mov    %esp,%ebp
+    4a73:	56                   	push   %esi
+    4a74:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    4a75:	83 ec 08             	sub    $0x8,%esp
+    4a78:	6a 00                	push   $0x0
+    4a7a:	ff 75 08             	push   0x8(%ebp)
+    4a7d:	e8 f1 00 00 00       	call   4b73 <open>
+  if(fd < 0)
+    4a82:	83 c4 10             	add    $0x10,%esp
+    4a85:	85 c0                	test   %eax,%eax
+    4a87:	78 27                	js     4ab0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    4a89:	83 ec 08             	sub    $0x8,%esp
+    4a8c:	ff 75 0c             	push   0xc(%ebp)
+    4a8f:	89 c3                	mov    %eax,%ebx
+    4a91:	50                   	push   %eax
+    4a92:	e8 f4 00 00 00       	call   4b8b <fstat>
+  close(fd);
+    4a97:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    4a9a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    4a9c:	e8 ba 00 00 00       	call   4b5b <close>
+  return r;
+    4aa1:	83 c4 10             	add    $0x10,%esp
+}
+    4aa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4aa7:	89 f0                	mov    %esi,%eax
+    4aa9:	5b                   	pop    %ebx
+    4aaa:	5e                   	pop    %esi
+    4aab:	5d                   	pop    %ebp
+    4aac:	c3                   	ret
+    4aad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    4ab0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    4ab5:	eb ed                	jmp    4aa4 <stat+0x34>
+    4ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4abe:	66 90                	xchg   %ax,%ax
+
+00004ac0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    4ac0:	55                   	push   %ebp
+    4ac1:	89 e5                	mov    %esp,%ebp
+    4ac3:	53                   	push   %ebx
+    4ac4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    4ac7:	0f be 02             	movsbl (%edx),%eax
+    4aca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    4acd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    4ad0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    4ad5:	77 1e                	ja     4af5 <atoi+0x35>
+    4ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4ade:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4ae0:	83 c2 01             	add    $0x1,%edx
+    4ae3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4ae6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    4aea:	0f be 02             	movsbl (%edx),%eax
+    4aed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4af0:	80 fb 09             	cmp    $0x9,%bl
+    4af3:	76 eb                	jbe    4ae0 <atoi+0x20>
+  return n;
+}
+    4af5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4af8:	89 c8                	mov    %ecx,%eax
+    4afa:	c9                   	leave
+    4afb:	c3                   	ret
+    4afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004b00 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4b00:	55                   	push   %ebp
+    4b01:	89 e5                	mov    %esp,%ebp
+    4b03:	57                   	push   %edi
+    4b04:	56                   	push   %esi
+    4b05:	8b 45 10             	mov    0x10(%ebp),%eax
+    4b08:	8b 55 08             	mov    0x8(%ebp),%edx
+    4b0b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    4b0e:	85 c0                	test   %eax,%eax
+    4b10:	7e 13                	jle    4b25 <memmove+0x25>
+    4b12:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4b14:	89 d7                	mov    %edx,%edi
+    4b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    4b20:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    4b21:	39 f8                	cmp    %edi,%eax
+    4b23:	75 fb                	jne    4b20 <memmove+0x20>
+  return vdst;
+}
+    4b25:	5e                   	pop    %esi
+    4b26:	89 d0                	mov    %edx,%eax
+    4b28:	5f                   	pop    %edi
+    4b29:	5d                   	pop    %ebp
+    4b2a:	c3                   	ret
+
+00004b2b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    4b2b:	b8 01 00 00 00       	mov    $0x1,%eax
+    4b30:	cd 40                	int    $0x40
+    4b32:	c3                   	ret
+
+00004b33 <exit>:
+SYSCALL(exit)
+    4b33:	b8 02 00 00 00       	mov    $0x2,%eax
+    4b38:	cd 40                	int    $0x40
+    4b3a:	c3                   	ret
+
+00004b3b <wait>:
+SYSCALL(wait)
+    4b3b:	b8 03 00 00 00       	mov    $0x3,%eax
+    4b40:	cd 40                	int    $0x40
+    4b42:	c3                   	ret
+
+00004b43 <pipe>:
+SYSCALL(pipe)
+    4b43:	b8 04 00 00 00       	mov    $0x4,%eax
+    4b48:	cd 40                	int    $0x40
+    4b4a:	c3                   	ret
+
+00004b4b <read>:
+SYSCALL(read)
+    4b4b:	b8 05 00 00 00       	mov    $0x5,%eax
+    4b50:	cd 40                	int    $0x40
+    4b52:	c3                   	ret
+
+00004b53 <write>:
+SYSCALL(write)
+    4b53:	b8 10 00 00 00       	mov    $0x10,%eax
+    4b58:	cd 40                	int    $0x40
+    4b5a:	c3                   	ret
+
+00004b5b <close>:
+SYSCALL(close)
+    4b5b:	b8 15 00 00 00       	mov    $0x15,%eax
+    4b60:	cd 40                	int    $0x40
+    4b62:	c3                   	ret
+
+00004b63 <kill>:
+SYSCALL(kill)
+    4b63:	b8 06 00 00 00       	mov    $0x6,%eax
+    4b68:	cd 40                	int    $0x40
+    4b6a:	c3                   	ret
+
+00004b6b <exec>:
+SYSCALL(exec)
+    4b6b:	b8 07 00 00 00       	mov    $0x7,%eax
+    4b70:	cd 40                	int    $0x40
+    4b72:	c3                   	ret
+
+00004b73 <open>:
+SYSCALL(open)
+    4b73:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4b78:	cd 40                	int    $0x40
+    4b7a:	c3                   	ret
+
+00004b7b <mknod>:
+SYSCALL(mknod)
+    4b7b:	b8 11 00 00 00       	mov    $0x11,%eax
+    4b80:	cd 40                	int    $0x40
+    4b82:	c3                   	ret
+
+00004b83 <unlink>:
+SYSCALL(unlink)
+    4b83:	b8 12 00 00 00       	mov    $0x12,%eax
+    4b88:	cd 40                	int    $0x40
+    4b8a:	c3                   	ret
+
+00004b8b <fstat>:
+SYSCALL(fstat)
+    4b8b:	b8 08 00 00 00       	mov    $0x8,%eax
+    4b90:	cd 40                	int    $0x40
+    4b92:	c3                   	ret
+
+00004b93 <link>:
+SYSCALL(link)
+    4b93:	b8 13 00 00 00       	mov    $0x13,%eax
+    4b98:	cd 40                	int    $0x40
+    4b9a:	c3                   	ret
+
+00004b9b <mkdir>:
+SYSCALL(mkdir)
+    4b9b:	b8 14 00 00 00       	mov    $0x14,%eax
+    4ba0:	cd 40                	int    $0x40
+    4ba2:	c3                   	ret
+
+00004ba3 <chdir>:
+SYSCALL(chdir)
+    4ba3:	b8 09 00 00 00       	mov    $0x9,%eax
+    4ba8:	cd 40                	int    $0x40
+    4baa:	c3                   	ret
+
+00004bab <dup>:
+SYSCALL(dup)
+    4bab:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4bb0:	cd 40                	int    $0x40
+    4bb2:	c3                   	ret
+
+00004bb3 <getpid>:
+SYSCALL(getpid)
+    4bb3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    4bb8:	cd 40                	int    $0x40
+    4bba:	c3                   	ret
+
+00004bbb <sbrk>:
+SYSCALL(sbrk)
+    4bbb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4bc0:	cd 40                	int    $0x40
+    4bc2:	c3                   	ret
+
+00004bc3 <sleep>:
+SYSCALL(sleep)
+    4bc3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4bc8:	cd 40                	int    $0x40
+    4bca:	c3                   	ret
+
+00004bcb <uptime>:
+SYSCALL(uptime)
+    4bcb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    4bd0:	cd 40                	int    $0x40
+    4bd2:	c3                   	ret
+
+00004bd3 <printinfo>:
+SYSCALL(printinfo)
+    4bd3:	b8 16 00 00 00       	mov    $0x16,%eax
+    4bd8:	cd 40                	int    $0x40
+    4bda:	c3                   	ret
+
+00004bdb <sched_policy>:
+SYSCALL(sched_policy)
+    4bdb:	b8 17 00 00 00       	mov    $0x17,%eax
+    4be0:	cd 40                	int    $0x40
+    4be2:	c3                   	ret
+
+00004be3 <exec_time>:
+SYSCALL(exec_time)
+    4be3:	b8 18 00 00 00       	mov    $0x18,%eax
+    4be8:	cd 40                	int    $0x40
+    4bea:	c3                   	ret
+
+00004beb <deadline>:
+SYSCALL(deadline)
+    4beb:	b8 19 00 00 00       	mov    $0x19,%eax
+    4bf0:	cd 40                	int    $0x40
+    4bf2:	c3                   	ret
+
+00004bf3 <rate>:
+SYSCALL(rate)
+    4bf3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4bf8:	cd 40                	int    $0x40
+    4bfa:	c3                   	ret
+
+00004bfb <mmap>:
+SYSCALL(mmap)
+    4bfb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4c00:	cd 40                	int    $0x40
+    4c02:	c3                   	ret
+
+00004c03 <munmap>:
+SYSCALL(munmap)
+    4c03:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    4c08:	cd 40                	int    $0x40
+    4c0a:	c3                   	ret
+
+00004c0b <bcstat>:
+SYSCALL(bcstat)
+    4c0b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    4c10:	cd 40                	int    $0x40
+    4c12:	c3                   	ret
+
+00004c13 <splice>:
+SYSCALL(splice)
+    4c13:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    4c18:	cd 40                	int    $0x40
+    4c1a:	c3                   	ret
+    4c1b:	66 90                	xchg   %ax,%ax
+    4c1d:	66 90                	xchg   %ax,%ax
+    4c1f:	90                   	nop
+
+00004c20 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4c20:	55                   	push   %ebp
+    4c21:	89 e5                	mov    %esp,%ebp
+    4c23:	57                   	push   %edi
+    4c24:	56                   	push   %esi
+    4c25:	53                   	push   %ebx
+    4c26:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4c28:	89 d1                	mov    %edx,%ecx
+{
+    4c2a:	83 ec 3c             	sub    $0x3c,%esp
+    4c2d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4c30:	85 d2                	test   %edx,%edx
+    4c32:	0f 89 80 00 00 00    	jns    4cb8 <printint+0x98>
+    4c38:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    4c3c:	74 7a                	je     4cb8 <printint+0x98>
+    x = -xx;
+    4c3e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4c40:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4c45:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4c48:	31 f6                	xor    %esi,%esi
+    4c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4c50:	89 c8                	mov    %ecx,%eax
+    4c52:	31 d2                	xor    %edx,%edx
+    4c54:	89 f7                	mov    %esi,%edi
+    4c56:	f7 f3                	div    %ebx
+    4c58:	8d 76 01             	lea    0x1(%esi),%esi
+    4c5b:	0f b6 92 bc 6e 00 00 	movzbl 0x6ebc(%edx),%edx
+    4c62:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4c66:	89 ca                	mov    %ecx,%edx
+    4c68:	89 c1                	mov    %eax,%ecx
+    4c6a:	39 da                	cmp    %ebx,%edx
+    4c6c:	73 e2                	jae    4c50 <printint+0x30>
+  if(neg)
+    4c6e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4c71:	85 c0                	test   %eax,%eax
+    4c73:	74 07                	je     4c7c <printint+0x5c>
+    buf[i++] = '-';
+    4c75:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    4c7a:	89 f7                	mov    %esi,%edi
+    4c7c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    4c7f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    4c82:	01 df                	add    %ebx,%edi
+    4c84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    4c88:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    4c8b:	83 ec 04             	sub    $0x4,%esp
+    4c8e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    4c91:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    4c94:	6a 01                	push   $0x1
+    4c96:	50                   	push   %eax
+    4c97:	56                   	push   %esi
+    4c98:	e8 b6 fe ff ff       	call   4b53 <write>
+  while(--i >= 0)
+    4c9d:	89 f8                	mov    %edi,%eax
+    4c9f:	83 c4 10             	add    $0x10,%esp
+    4ca2:	83 ef 01             	sub    $0x1,%edi
+    4ca5:	39 d8                	cmp    %ebx,%eax
+    4ca7:	75 df                	jne    4c88 <printint+0x68>
+}
+    4ca9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4cac:	5b                   	pop    %ebx
+    4cad:	5e                   	pop    %esi
+    4cae:	5f                   	pop    %edi
+    4caf:	5d                   	pop    %ebp
+    4cb0:	c3                   	ret
+    4cb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    4cb8:	31 c0                	xor    %eax,%eax
+    4cba:	eb 89                	jmp    4c45 <printint+0x25>
+    4cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004cc0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    4cc0:	55                   	push   %ebp
+    4cc1:	89 e5                	mov    %esp,%ebp
+    4cc3:	57                   	push   %edi
+    4cc4:	56                   	push   %esi
+    4cc5:	53                   	push   %ebx
+    4cc6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    4cc9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    4ccc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    4ccf:	0f b6 1e             	movzbl (%esi),%ebx
+    4cd2:	83 c6 01             	add    $0x1,%esi
+    4cd5:	84 db                	test   %bl,%bl
+    4cd7:	74 67                	je     4d40 <printf+0x80>
+    4cd9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    4cdc:	31 d2                	xor    %edx,%edx
+    4cde:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    4ce1:	eb 34                	jmp    4d17 <printf+0x57>
+    4ce3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4ce7:	90                   	nop
+    4ce8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    4ceb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    4cf0:	83 f8 25             	cmp    $0x25,%eax
+    4cf3:	74 18                	je     4d0d <printf+0x4d>
+  write(fd, &c, 1);
+    4cf5:	83 ec 04             	sub    $0x4,%esp
+    4cf8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    4cfb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4cfe:	6a 01                	push   $0x1
+    4d00:	50                   	push   %eax
+    4d01:	57                   	push   %edi
+    4d02:	e8 4c fe ff ff       	call   4b53 <write>
+    4d07:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    4d0a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    4d0d:	0f b6 1e             	movzbl (%esi),%ebx
+    4d10:	83 c6 01             	add    $0x1,%esi
+    4d13:	84 db                	test   %bl,%bl
+    4d15:	74 29                	je     4d40 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4d17:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    4d1a:	85 d2                	test   %edx,%edx
+    4d1c:	74 ca                	je     4ce8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    4d1e:	83 fa 25             	cmp    $0x25,%edx
+    4d21:	75 ea                	jne    4d0d <printf+0x4d>
+      if(c == 'd'){
+    4d23:	83 f8 25             	cmp    $0x25,%eax
+    4d26:	0f 84 24 01 00 00    	je     4e50 <printf+0x190>
+    4d2c:	83 e8 63             	sub    $0x63,%eax
+    4d2f:	83 f8 15             	cmp    $0x15,%eax
+    4d32:	77 1c                	ja     4d50 <printf+0x90>
+    4d34:	ff 24 85 64 6e 00 00 	jmp    *0x6e64(,%eax,4)
+    4d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4d3f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4d40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4d43:	5b                   	pop    %ebx
+    4d44:	5e                   	pop    %esi
+    4d45:	5f                   	pop    %edi
+    4d46:	5d                   	pop    %ebp
+    4d47:	c3                   	ret
+    4d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4d4f:	90                   	nop
+  write(fd, &c, 1);
+    4d50:	83 ec 04             	sub    $0x4,%esp
+    4d53:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4d56:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    4d5a:	6a 01                	push   $0x1
+    4d5c:	52                   	push   %edx
+    4d5d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    4d60:	57                   	push   %edi
+    4d61:	e8 ed fd ff ff       	call   4b53 <write>
+    4d66:	83 c4 0c             	add    $0xc,%esp
+    4d69:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4d6c:	6a 01                	push   $0x1
+    4d6e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    4d71:	52                   	push   %edx
+    4d72:	57                   	push   %edi
+    4d73:	e8 db fd ff ff       	call   4b53 <write>
+        putc(fd, c);
+    4d78:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4d7b:	31 d2                	xor    %edx,%edx
+    4d7d:	eb 8e                	jmp    4d0d <printf+0x4d>
+    4d7f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    4d80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4d83:	83 ec 0c             	sub    $0xc,%esp
+    4d86:	b9 10 00 00 00       	mov    $0x10,%ecx
+    4d8b:	8b 13                	mov    (%ebx),%edx
+    4d8d:	6a 00                	push   $0x0
+    4d8f:	89 f8                	mov    %edi,%eax
+        ap++;
+    4d91:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    4d94:	e8 87 fe ff ff       	call   4c20 <printint>
+        ap++;
+    4d99:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4d9c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4d9f:	31 d2                	xor    %edx,%edx
+    4da1:	e9 67 ff ff ff       	jmp    4d0d <printf+0x4d>
+    4da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4dad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    4db0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4db3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    4db5:	83 c0 04             	add    $0x4,%eax
+    4db8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    4dbb:	85 db                	test   %ebx,%ebx
+    4dbd:	0f 84 9d 00 00 00    	je     4e60 <printf+0x1a0>
+        while(*s != 0){
+    4dc3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    4dc6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    4dc8:	84 c0                	test   %al,%al
+    4dca:	0f 84 3d ff ff ff    	je     4d0d <printf+0x4d>
+    4dd0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4dd3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    4dd6:	89 de                	mov    %ebx,%esi
+    4dd8:	89 d3                	mov    %edx,%ebx
+    4dda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    4de0:	83 ec 04             	sub    $0x4,%esp
+    4de3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    4de6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    4de9:	6a 01                	push   $0x1
+    4deb:	53                   	push   %ebx
+    4dec:	57                   	push   %edi
+    4ded:	e8 61 fd ff ff       	call   4b53 <write>
+        while(*s != 0){
+    4df2:	0f b6 06             	movzbl (%esi),%eax
+    4df5:	83 c4 10             	add    $0x10,%esp
+    4df8:	84 c0                	test   %al,%al
+    4dfa:	75 e4                	jne    4de0 <printf+0x120>
+      state = 0;
+    4dfc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    4dff:	31 d2                	xor    %edx,%edx
+    4e01:	e9 07 ff ff ff       	jmp    4d0d <printf+0x4d>
+    4e06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4e0d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4e10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4e13:	83 ec 0c             	sub    $0xc,%esp
+    4e16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    4e1b:	8b 13                	mov    (%ebx),%edx
+    4e1d:	6a 01                	push   $0x1
+    4e1f:	e9 6b ff ff ff       	jmp    4d8f <printf+0xcf>
+    4e24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4e28:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    4e2b:	83 ec 04             	sub    $0x4,%esp
+    4e2e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4e31:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4e33:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4e36:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4e39:	6a 01                	push   $0x1
+    4e3b:	52                   	push   %edx
+    4e3c:	57                   	push   %edi
+    4e3d:	e8 11 fd ff ff       	call   4b53 <write>
+        ap++;
+    4e42:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4e45:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4e48:	31 d2                	xor    %edx,%edx
+    4e4a:	e9 be fe ff ff       	jmp    4d0d <printf+0x4d>
+    4e4f:	90                   	nop
+  write(fd, &c, 1);
+    4e50:	83 ec 04             	sub    $0x4,%esp
+    4e53:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4e56:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4e59:	6a 01                	push   $0x1
+    4e5b:	e9 11 ff ff ff       	jmp    4d71 <printf+0xb1>
+    4e60:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4e65:	bb 5a 6e 00 00       	mov    $0x6e5a,%ebx
+    4e6a:	e9 61 ff ff ff       	jmp    4dd0 <printf+0x110>
+    4e6f:	90                   	nop
+
+00004e70 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4e70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4e71:	a1 00 c1 00 00       	mov    0xc100,%eax
+{
+    4e76:	89 e5                	mov    %esp,%ebp
+    4e78:	57                   	push   %edi
+    4e79:	56                   	push   %esi
+    4e7a:	53                   	push   %ebx
+    4e7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    4e7e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4e81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4e88:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4e8a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4e8c:	39 ca                	cmp    %ecx,%edx
+    4e8e:	73 30                	jae    4ec0 <free+0x50>
+    4e90:	39 c1                	cmp    %eax,%ecx
+    4e92:	72 04                	jb     4e98 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4e94:	39 c2                	cmp    %eax,%edx
+    4e96:	72 f0                	jb     4e88 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4e98:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    4e9b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    4e9e:	39 f8                	cmp    %edi,%eax
+    4ea0:	74 2e                	je     4ed0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4ea2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4ea5:	8b 42 04             	mov    0x4(%edx),%eax
+    4ea8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4eab:	39 f1                	cmp    %esi,%ecx
+    4ead:	74 38                	je     4ee7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    4eaf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4eb1:	5b                   	pop    %ebx
+  freep = p;
+    4eb2:	89 15 00 c1 00 00    	mov    %edx,0xc100
+}
+    4eb8:	5e                   	pop    %esi
+    4eb9:	5f                   	pop    %edi
+    4eba:	5d                   	pop    %ebp
+    4ebb:	c3                   	ret
+    4ebc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4ec0:	39 c1                	cmp    %eax,%ecx
+    4ec2:	72 d0                	jb     4e94 <free+0x24>
+    4ec4:	eb c2                	jmp    4e88 <free+0x18>
+    4ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4ecd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    4ed0:	03 70 04             	add    0x4(%eax),%esi
+    4ed3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4ed6:	8b 02                	mov    (%edx),%eax
+    4ed8:	8b 00                	mov    (%eax),%eax
+    4eda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    4edd:	8b 42 04             	mov    0x4(%edx),%eax
+    4ee0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4ee3:	39 f1                	cmp    %esi,%ecx
+    4ee5:	75 c8                	jne    4eaf <free+0x3f>
+    p->s.size += bp->s.size;
+    4ee7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    4eea:	89 15 00 c1 00 00    	mov    %edx,0xc100
+    p->s.size += bp->s.size;
+    4ef0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4ef3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4ef6:	89 0a                	mov    %ecx,(%edx)
+}
+    4ef8:	5b                   	pop    %ebx
+    4ef9:	5e                   	pop    %esi
+    4efa:	5f                   	pop    %edi
+    4efb:	5d                   	pop    %ebp
+    4efc:	c3                   	ret
+    4efd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004f00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4f00:	55                   	push   %ebp
+    4f01:	89 e5                	mov    %esp,%ebp
+    4f03:	57                   	push   %edi
+    4f04:	56                   	push   %esi
+    4f05:	53                   	push   %ebx
+    4f06:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4f09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    4f0c:	8b 15 00 c1 00 00    	mov    0xc100,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4f12:	8d 78 07             	lea    0x7(%eax),%edi
+    4f15:	c1 ef 03             	shr    $0x3,%edi
+    4f18:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    4f1b:	85 d2                	test   %edx,%edx
+    4f1d:	0f 84 8d 00 00 00    	je     4fb0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4f23:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4f25:	8b 48 04             	mov    0x4(%eax),%ecx
+    4f28:	39 f9                	cmp    %edi,%ecx
+    4f2a:	73 64                	jae    4f90 <malloc+0x90>
+  if(nu < 4096)
+    4f2c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4f31:	39 df                	cmp    %ebx,%edi
+    4f33:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4f36:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    4f3d:	eb 0a                	jmp    4f49 <malloc+0x49>
+    4f3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4f40:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4f42:	8b 48 04             	mov    0x4(%eax),%ecx
+    4f45:	39 f9                	cmp    %edi,%ecx
+    4f47:	73 47                	jae    4f90 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4f49:	89 c2                	mov    %eax,%edx
+    4f4b:	39 05 00 c1 00 00    	cmp    %eax,0xc100
+    4f51:	75 ed                	jne    4f40 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4f53:	83 ec 0c             	sub    $0xc,%esp
+    4f56:	56                   	push   %esi
+    4f57:	e8 5f fc ff ff       	call   4bbb <sbrk>
+  if(p == (char*)-1)
+    4f5c:	83 c4 10             	add    $0x10,%esp
+    4f5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4f62:	74 1c                	je     4f80 <malloc+0x80>
+  hp->s.size = nu;
+    4f64:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4f67:	83 ec 0c             	sub    $0xc,%esp
+    4f6a:	83 c0 08             	add    $0x8,%eax
+    4f6d:	50                   	push   %eax
+    4f6e:	e8 fd fe ff ff       	call   4e70 <free>
+  return freep;
+    4f73:	8b 15 00 c1 00 00    	mov    0xc100,%edx
+      if((p = morecore(nunits)) == 0)
+    4f79:	83 c4 10             	add    $0x10,%esp
+    4f7c:	85 d2                	test   %edx,%edx
+    4f7e:	75 c0                	jne    4f40 <malloc+0x40>
+        return 0;
+  }
+}
+    4f80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4f83:	31 c0                	xor    %eax,%eax
+}
+    4f85:	5b                   	pop    %ebx
+    4f86:	5e                   	pop    %esi
+    4f87:	5f                   	pop    %edi
+    4f88:	5d                   	pop    %ebp
+    4f89:	c3                   	ret
+    4f8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4f90:	39 cf                	cmp    %ecx,%edi
+    4f92:	74 4c                	je     4fe0 <malloc+0xe0>
+        p->s.size -= nunits;
+    4f94:	29 f9                	sub    %edi,%ecx
+    4f96:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4f99:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    4f9c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    4f9f:	89 15 00 c1 00 00    	mov    %edx,0xc100
+}
+    4fa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4fa8:	83 c0 08             	add    $0x8,%eax
+}
+    4fab:	5b                   	pop    %ebx
+    4fac:	5e                   	pop    %esi
+    4fad:	5f                   	pop    %edi
+    4fae:	5d                   	pop    %ebp
+    4faf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4fb0:	c7 05 00 c1 00 00 04 	movl   $0xc104,0xc100
+    4fb7:	c1 00 00 
+    base.s.size = 0;
+    4fba:	b8 04 c1 00 00       	mov    $0xc104,%eax
+    base.s.ptr = freep = prevp = &base;
+    4fbf:	c7 05 04 c1 00 00 04 	movl   $0xc104,0xc104
+    4fc6:	c1 00 00 
+    base.s.size = 0;
+    4fc9:	c7 05 08 c1 00 00 00 	movl   $0x0,0xc108
+    4fd0:	00 00 00 
+    if(p->s.size >= nunits){
+    4fd3:	e9 54 ff ff ff       	jmp    4f2c <malloc+0x2c>
+    4fd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4fdf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4fe0:	8b 08                	mov    (%eax),%ecx
+    4fe2:	89 0a                	mov    %ecx,(%edx)
+    4fe4:	eb b9                	jmp    4f9f <malloc+0x9f>
@@ -7,6 +7,7 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "bcstat.h"
 
 char buf[8192];
 char name[3];
@@ -184,6 +185,8 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+#define BIGBLOCKS 1024  // blocks in writetest1's file
+
 void
 writetest1(void)
 {
@@ -197,7 +200,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGBLOCKS; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +220,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n == BIGBLOCKS - 1){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -354,6 +357,165 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+#define PIPEBENCHKB 16384  // data pipebench sends, in KB
+#define OLDPIPESIZE 512    // pipe buffer before it grew to pages
+
+// Send PIPEBENCHKB KB through a pipe in buf-sized writes and
+// count the reads it takes.  Every read that finds the pipe
+// empty sleeps until the writer wakes it, so bytes per read
+// measures the pipe directly: with the old 512-byte ring, no
+// read could return more than 512 bytes.  The elapsed ticks
+// are printed for comparison between builds.
+void
+pipebench(void)
+{
+  int fds[2], pid, n, nread, start, ticks;
+  uint total;
+
+  printf(1, "pipebench test\n");
+  if(pipe(fds) != 0){
+    printf(1, "pipebench: pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "pipebench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    memset(buf, 'p', sizeof(buf));
+    for(total = 0; total < PIPEBENCHKB*1024; total += sizeof(buf)){
+      if(write(fds[1], buf, sizeof(buf)) != sizeof(buf)){
+        printf(1, "pipebench: write failed\n");
+        exit();
+      }
+    }
+    exit();
+  }
+  close(fds[1]);
+  start = uptime();
+  total = 0;
+  nread = 0;
+  while((n = read(fds[0], buf, sizeof(buf))) > 0){
+    total += n;
+    nread++;
+  }
+  ticks = uptime() - start;
+  close(fds[0]);
+  wait();
+  if(total != PIPEBENCHKB*1024){
+    printf(1, "pipebench: read %d bytes\n", total);
+    exit();
+  }
+  printf(1, "pipebench: %d KB in %d ticks, %d reads, %d bytes per read\n",
+         PIPEBENCHKB, ticks, nread, total / nread);
+  if(total / nread <= OLDPIPESIZE){
+    printf(1, "pipebench: reads no bigger than the old pipe buffer\n");
+    exit();
+  }
+  printf(1, "pipebench ok\n");
+}
+
+// Copy a file to another through a pipe with splice().
+void
+splicetest(void)
+{
+  int fds[2], fd, pid, i, n, total;
+
+  printf(1, "splice test\n");
+  unlink("splice0");
+  unlink("splice1");
+  fd = open("splice0", O_CREATE|O_RDWR);
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = i * 7;
+  for(i = 0; i < 3; i++){
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "splice: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  if(pipe(fds) != 0){
+    printf(1, "splice: pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "splice: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    fd = open("splice0", O_RDONLY);
+    while((n = splice(fd, fds[1], 5000)) > 0)
+      ;
+    if(n < 0)
+      printf(1, "splice: file to pipe failed\n");
+    exit();
+  }
+  close(fds[1]);
+  fd = open("splice1", O_CREATE|O_RDWR);
+  total = 0;
+  while((n = splice(fds[0], fd, 3000)) > 0)
+    total += n;
+  close(fds[0]);
+  close(fd);
+  wait();
+  if(n < 0 || total != 3*sizeof(buf)){
+    printf(1, "splice: moved %d bytes\n", total);
+    exit();
+  }
+  if(splice(0, 1, 1) >= 0){
+    printf(1, "splice: worked without a pipe\n");
+    exit();
+  }
+
+  fd = open("splice1", O_RDONLY);
+  for(total = 0; (n = read(fd, buf, sizeof(buf))) > 0; total += n){
+    for(i = 0; i < n; i++){
+      if(buf[i] != (char)((total + i) % sizeof(buf) * 7)){
+        printf(1, "splice: wrong data\n");
+        exit();
+      }
+    }
+  }
+  close(fd);
+  unlink("splice0");
+  unlink("splice1");
+  printf(1, "splice ok\n");
+}
+
+// Fill the file descriptor table, and check that
+// new descriptors are always the lowest free ones.
+void
+fdtest(void)
+{
+  int fd, n;
+
+  printf(1, "fd test\n");
+  for(n = 0; (fd = dup(1)) >= 0; n++){
+    if(fd != 3 + n){
+      printf(1, "fdtest: dup gave %d, not %d\n", fd, 3 + n);
+      exit();
+    }
+  }
+  if(n != NOFILE - 3){
+    printf(1, "fdtest: only %d descriptors\n", n + 3);
+    exit();
+  }
+  close(40);
+  close(7);
+  if(dup(1) != 7 || dup(1) != 40 || dup(1) >= 0){
+    printf(1, "fdtest: wrong fd reused\n");
+    exit();
+  }
+  for(fd = 3; fd < NOFILE; fd++)
+    close(fd);
+  printf(1, "fd ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -1200,6 +1362,238 @@ bigfile(void)
   printf(1, "bigfile test ok\n");
 }
 
+// Lookups that failed or succeeded before must not be
+// remembered once the name is created or removed.
+void
+dcachetest(void)
+{
+  int i, fd;
+
+  printf(1, "dcache test\n");
+  mkdir("dcd");
+  for(i = 0; i < 3; i++){
+    if(open("dcd/f", O_RDONLY) >= 0){
+      printf(1, "dcache: open of missing file succeeded\n");
+      exit();
+    }
+    if((fd = open("dcd/f", O_CREATE|O_RDWR)) < 0){
+      printf(1, "dcache: create failed\n");
+      exit();
+    }
+    close(fd);
+    if((fd = open("dcd/f", O_RDONLY)) < 0){
+      printf(1, "dcache: open of new file failed\n");
+      exit();
+    }
+    close(fd);
+    if(unlink("dcd/f") < 0){
+      printf(1, "dcache: unlink failed\n");
+      exit();
+    }
+  }
+
+  // A new directory may get the inode of one that was removed.
+  mkdir("dcd/d");
+  close(open("dcd/d/x", O_CREATE|O_RDWR));
+  unlink("dcd/d/x");
+  unlink("dcd/d");
+  mkdir("dcd/e");
+  if(open("dcd/e/x", O_RDONLY) >= 0){
+    printf(1, "dcache: stale entry of removed directory\n");
+    exit();
+  }
+  unlink("dcd/e");
+  unlink("dcd");
+  printf(1, "dcache ok\n");
+}
+
+// Enough names in one directory to split its blocks several
+// times; every name must still be found after the splits.
+void
+hashdir(void)
+{
+  int i, fd;
+  char name[8];
+
+  printf(1, "hashdir test\n");
+  if(mkdir("hd") < 0){
+    printf(1, "hashdir: mkdir failed\n");
+    exit();
+  }
+  if((fd = open("hd/f", O_CREATE|O_RDWR)) < 0){
+    printf(1, "hashdir: create failed\n");
+    exit();
+  }
+  close(fd);
+  strcpy(name, "hd/xx");
+  for(i = 0; i < 300; i++){
+    name[3] = 'a' + i / 26;
+    name[4] = 'a' + i % 26;
+    if(link("hd/f", name) < 0){
+      printf(1, "hashdir: link %s failed\n", name);
+      exit();
+    }
+  }
+  for(i = 0; i < 300; i++){
+    name[3] = 'a' + i / 26;
+    name[4] = 'a' + i % 26;
+    if((fd = open(name, O_RDONLY)) < 0){
+      printf(1, "hashdir: open %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  if(unlink("hd") == 0){
+    printf(1, "hashdir: unlinked non-empty directory\n");
+    exit();
+  }
+  for(i = 0; i < 300; i++){
+    name[3] = 'a' + i / 26;
+    name[4] = 'a' + i % 26;
+    if(unlink(name) < 0){
+      printf(1, "hashdir: unlink %s failed\n", name);
+      exit();
+    }
+  }
+  unlink("hd/f");
+  if(unlink("hd") < 0){
+    printf(1, "hashdir: unlink of emptied directory failed\n");
+    exit();
+  }
+  printf(1, "hashdir ok\n");
+}
+
+#define NICACHE (NINODE + 50)  // files icachetest uses
+
+static void
+icname(char *name, int i)
+{
+  strcpy(name, "ic/xx");
+  name[3] = 'a' + i / 26;
+  name[4] = 'a' + i % 26;
+}
+
+// Use more inodes than the inode cache holds, from several
+// processes at once, so that iget() must keep evicting
+// entries, some of which the others are looking up.  The
+// files are visited in order of inum modulo NIHASH in fs.c,
+// with consecutive inums assumed, so that the processes
+// evict entries of the same hash bucket at the same time.
+void
+icachetest(void)
+{
+  int i, j, k, fd, pid, v;
+  char name[8];
+
+  printf(1, "icache test\n");
+  if(mkdir("ic") < 0){
+    printf(1, "icache: mkdir failed\n");
+    exit();
+  }
+  for(i = 0; i < NICACHE; i++){
+    icname(name, i);
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(1, "icache: create %s failed\n", name);
+      exit();
+    }
+    if(write(fd, &i, sizeof(i)) != sizeof(i)){
+      printf(1, "icache: write %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+
+  pid = 1;
+  for(k = 0; k < 3 && pid > 0; k++){
+    if((pid = fork()) < 0){
+      printf(1, "icache: fork failed\n");
+      exit();
+    }
+  }
+  for(j = 0; j < 3; j++){
+    for(k = 0; k < 61; k++){
+      for(i = k; i < NICACHE; i += 61){
+        icname(name, i);
+        if((fd = open(name, O_RDONLY)) < 0){
+          printf(1, "icache: open %s failed\n", name);
+          exit();
+        }
+        v = -1;
+        if(read(fd, &v, sizeof(v)) != sizeof(v) || v != i){
+          printf(1, "icache: %s holds %d\n", name, v);
+          exit();
+        }
+        close(fd);
+      }
+    }
+  }
+  if(pid == 0)
+    exit();
+  for(k = 0; k < 3; k++)
+    wait();
+
+  for(i = 0; i < NICACHE; i++){
+    icname(name, i);
+    if(unlink(name) < 0){
+      printf(1, "icache: unlink %s failed\n", name);
+      exit();
+    }
+  }
+  if(unlink("ic") < 0){
+    printf(1, "icache: unlink ic failed\n");
+    exit();
+  }
+  printf(1, "icache ok\n");
+}
+
+// Two files written a block at a time in turn get an extent
+// per block, more than fit in the inode and one extent block.
+void
+fragfile(void)
+{
+  int fd[2], i, j, n;
+
+  printf(1, "fragfile test\n");
+  n = NEXTENT + 2*NIEXTENT + 1;
+  fd[0] = open("frag0", O_CREATE|O_RDWR);
+  fd[1] = open("frag1", O_CREATE|O_RDWR);
+  if(fd[0] < 0 || fd[1] < 0){
+    printf(1, "fragfile: create failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    for(j = 0; j < 2; j++){
+      ((int*)buf)[0] = i;
+      ((int*)buf)[1] = j;
+      if(write(fd[j], buf, 512) != 512){
+        printf(1, "fragfile: write failed\n");
+        exit();
+      }
+    }
+  }
+  close(fd[0]);
+  close(fd[1]);
+
+  for(j = 0; j < 2; j++){
+    fd[j] = open(j ? "frag1" : "frag0", O_RDONLY);
+    for(i = 0; i < n; i++){
+      if(read(fd[j], buf, 512) != 512 ||
+         ((int*)buf)[0] != i || ((int*)buf)[1] != j){
+        printf(1, "fragfile: wrong content at block %d\n", i);
+        exit();
+      }
+    }
+    if(read(fd[j], buf, 512) != 0){
+      printf(1, "fragfile: too long\n");
+      exit();
+    }
+    close(fd[j]);
+  }
+  unlink("frag0");
+  unlink("frag1");
+  printf(1, "fragfile ok\n");
+}
+
 void
 fourteen(void)
 {
@@ -1737,6 +2131,143 @@ void argptest()
   printf(1, "arg test passed\n");
 }
 
+// Buffer cache counters move, and a cached block is a hit.
+void
+bcachetest(void)
+{
+  struct bcstat a, b;
+  int fd;
+
+  printf(1, "bcache test\n");
+  fd = open("bcachefile", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, buf, 512) != 512){
+    printf(1, "bcache: create failed\n");
+    exit();
+  }
+  close(fd);
+  if(bcstat(&a) < 0 || a.nbuf != NBUF || a.nhot > a.nbuf){
+    printf(1, "bcache: bcstat failed\n");
+    exit();
+  }
+  fd = open("bcachefile", O_RDONLY);
+  if(fd < 0 || read(fd, buf, 512) != 512){
+    printf(1, "bcache: read failed\n");
+    exit();
+  }
+  close(fd);
+  bcstat(&b);
+  if(b.hits == a.hits || b.hits + b.misses < a.hits + a.misses + 2){
+    printf(1, "bcache: counters did not move\n");
+    exit();
+  }
+  unlink("bcachefile");
+  printf(1, "bcache ok\n");
+}
+
+// mmap() of a file, private and shared, across fork.
+void
+mmaptest(void)
+{
+  int fd, i, n, pid;
+  char *p;
+
+  printf(1, "mmap test\n");
+  n = 4096 + 2000;
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = 'a' + i % 26;
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, buf, n) != n){
+    printf(1, "mmap: create failed\n");
+    exit();
+  }
+
+  // Private: stores are not written back.
+  p = mmap(0, n, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(p == (char*)-1){
+    printf(1, "mmap: MAP_PRIVATE failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    if(p[i] != buf[i]){
+      printf(1, "mmap: wrong content at %d\n", i);
+      exit();
+    }
+  }
+  p[0] = 'X';
+  pid = fork();
+  if(pid < 0){
+    printf(1, "mmap: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(p[0] != 'X' || p[n-1] != buf[n-1]){
+      printf(1, "mmap: child sees wrong content\n");
+      exit();
+    }
+    exit();
+  }
+  wait();
+  if(munmap(p, n) < 0){
+    printf(1, "mmap: munmap failed\n");
+    exit();
+  }
+
+  // Shared: dirty pages go back to the file on munmap(),
+  // and mapped memory can be passed to system calls.
+  p = mmap(0, n, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == (char*)-1){
+    printf(1, "mmap: MAP_SHARED failed\n");
+    exit();
+  }
+  p[4096] = 'Y';
+  close(fd);
+  fd = open("mmapcopy", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, p + 4000, 200) != 200){
+    printf(1, "mmap: write from mapping failed\n");
+    exit();
+  }
+  close(fd);
+  if(munmap(p, n) < 0){
+    printf(1, "mmap: munmap failed\n");
+    exit();
+  }
+  fd = open("mmapfile", O_RDONLY);
+  if(fd < 0 || read(fd, buf, n) != n || buf[0] != 'a' || buf[4096] != 'Y'){
+    printf(1, "mmap: shared store not written back\n");
+    exit();
+  }
+  close(fd);
+
+  // A path in pages of a mapping that nothing has touched yet,
+  // straddling a page boundary.
+  memset(buf, 0, sizeof(buf));
+  strcpy(buf + 4092, "mmapcopy");
+  fd = open("mmapfile", O_RDWR);
+  if(fd < 0 || write(fd, buf, 4096 + 16) != 4096 + 16){
+    printf(1, "mmap: rewrite failed\n");
+    exit();
+  }
+  p = mmap(0, 4096 + 16, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(p == (char*)-1){
+    printf(1, "mmap: MAP_PRIVATE failed\n");
+    exit();
+  }
+  if((fd = open(p + 4092, O_RDONLY)) < 0){
+    printf(1, "mmap: open of a name in a mapping failed\n");
+    exit();
+  }
+  close(fd);
+  if(munmap(p, 4096 + 16) < 0){
+    printf(1, "mmap: munmap failed\n");
+    exit();
+  }
+
+  unlink("mmapfile");
+  unlink("mmapcopy");
+  printf(1, "mmap test ok\n");
+}
+
 unsigned long randstate = 1;
 unsigned int
 rand()
@@ -1781,12 +2312,19 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  pipebench();
+  splicetest();
+  fdtest();
   preempt();
   exitwait();
 
   rmdot();
   fourteen();
   bigfile();
+  fragfile();
+  dcachetest();
+  hashdir();
+  icachetest();
   subdir();
   linktest();
   unlinkread();
@@ -1797,6 +2335,9 @@ main(int argc, char *argv[])
 
   uio();
 
+  mmaptest();
+  bcachetest();
+
   exectest();
 
   exit();
@@ -0,0 +1,259 @@
+// Virtio block device driver, a replacement for ide.c
+// selected by DISK=virtio in the Makefile.
+//
+// The file system disk is a legacy virtio-blk PCI device.
+// Each request is a chain of three descriptors in the device's
+// single virtqueue: a header, the buffer data, and a status
+// byte for the device to fill in.  The device works on as many
+// requests at once as there are descriptors for, so a batch
+// handed to idesubmit() is in flight all together.
+//
+// The boot disk stays on the IDE controller, where the BIOS
+// finds it; the kernel never reads it.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "pci.h"
+#include "virtio.h"
+
+#define NVRING 256  // largest queue size supported
+
+static struct spinlock vlock;
+static ushort vbase;             // I/O base of the device registers
+static uint vqsize;              // descriptors in the queue
+static struct vring_desc *desc;
+static struct vring_avail *avail;
+static struct vring_used *used;
+static ushort usedidx;           // next used ring entry to look at
+static char vfree[NVRING];       // is descriptor i free?
+static uint nfree;
+
+// Per request, indexed by the head descriptor of its chain.
+static struct virtio_blk_req vreq[NVRING];
+static struct {
+  struct buf *b;
+  uchar status;  // written by the device; 0 means success
+} vinfo[NVRING];
+
+// The queue itself: descriptors, then the available ring,
+// then, on the next page, the used ring.
+static char vring[3*PGSIZE] __attribute__((__aligned__(PGSIZE)));
+
+void
+ideinit(void)
+{
+  struct pcidev d;
+  uint i, a;
+
+  initlock(&vlock, "virtio");
+  if(pcifindid(VIRTIO_VENDOR, VIRTIO_DEV_BLK, &d) < 0 ||
+     (d.bar[0] & PCI_BAR_IO) == 0)
+    panic("virtio: no block device");
+  pcienable(&d);
+  vbase = d.bar[0] & ~3;
+
+  outb(vbase + VIRTIO_STATUS, 0);  // reset
+  outb(vbase + VIRTIO_STATUS, VIRTIO_ST_ACK);
+  outb(vbase + VIRTIO_STATUS, VIRTIO_ST_ACK | VIRTIO_ST_DRIVER);
+  outl(vbase + VIRTIO_GUESTFEAT, 0);  // no optional features
+
+  outw(vbase + VIRTIO_QSEL, 0);
+  vqsize = inw(vbase + VIRTIO_QSIZE);
+  if(vqsize == 0 || vqsize > NVRING)
+    panic("virtio: queue size");
+  a = vqsize*sizeof(struct vring_desc);
+  desc = (struct vring_desc*)vring;
+  avail = (struct vring_avail*)(vring + a);
+  a = PGROUNDUP(a + sizeof(ushort)*(3 + vqsize));  // flags, idx, ring, used_event
+  used = (struct vring_used*)(vring + a);
+  if(a + 3*sizeof(ushort) + vqsize*sizeof(struct vring_used_elem) > sizeof(vring))
+    panic("virtio: vring");
+  memset(vring, 0, sizeof(vring));
+  outl(vbase + VIRTIO_QADDR, V2P(vring) / VRING_ALIGN);
+
+  for(i = 0; i < vqsize; i++)
+    vfree[i] = 1;
+  nfree = vqsize;
+
+  outb(vbase + VIRTIO_STATUS,
+       VIRTIO_ST_ACK | VIRTIO_ST_DRIVER | VIRTIO_ST_DRIVER_OK);
+  ioapicroute(d.irq, IRQ_IDE, ncpu - 1);
+}
+
+// Take a free descriptor.  Caller must hold vlock
+// and know that there is one.
+static int
+allocdesc(void)
+{
+  int i;
+
+  for(i = 0; i < vqsize; i++){
+    if(vfree[i]){
+      vfree[i] = 0;
+      nfree--;
+      return i;
+    }
+  }
+  panic("virtio: allocdesc");
+}
+
+// Free the chain of descriptors starting at i.
+// Caller must hold vlock.
+static void
+freechain(int i)
+{
+  for(;;){
+    vfree[i] = 1;
+    nfree++;
+    if((desc[i].flags & VRING_DESC_NEXT) == 0)
+      break;
+    i = desc[i].next;
+  }
+  wakeup(&nfree);
+}
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+  struct buf *b;
+  int h;
+
+  acquire(&vlock);
+
+  // Reading the ISR acknowledges the interrupt;
+  // a request that finishes after that interrupts again.
+  inb(vbase + VIRTIO_ISR);
+  __sync_synchronize();
+
+  while(usedidx != used->idx){
+    __sync_synchronize();
+    h = used->ring[usedidx % vqsize].id;
+    b = vinfo[h].b;
+    if(b == 0 || vinfo[h].status != 0)
+      panic("virtio: request failed");
+    vinfo[h].b = 0;
+    freechain(h);
+    usedidx++;
+
+    // Wake the process waiting for this buf's group,
+    // or release the buf if nobody is waiting.
+    biodone(b);
+  }
+
+  release(&vlock);
+}
+
+//PAGEBREAK!
+// Queue n locked bufs for the disk and return without waiting.
+// Each buf is synced as iderw() describes.  If g is not 0, it
+// counts the requests still pending, and idewaitgroup(g) waits
+// until they are all done; otherwise each buf must be B_ASYNC.
+void
+idesubmit(struct buf **bufs, int n, struct iogroup *g)
+{
+  struct buf *b;
+  int i, h, d, s;
+
+  if(n <= 0)
+    return;
+
+  acquire(&vlock);
+  for(i = 0; i < n; i++){
+    b = bufs[i];
+    if(!holdingsleep(&b->lock))
+      panic("iderw: buf not locked");
+    if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("iderw: nothing to do");
+    if(b->dev != ROOTDEV)
+      panic("iderw: request not for disk 1");
+    if(g == 0 && (b->flags & B_ASYNC) == 0)
+      panic("idesubmit: nobody waits");
+
+    if(nfree < 3){
+      // Let the device get on with what we have so far.
+      outw(vbase + VIRTIO_QNOTIFY, 0);
+      while(nfree < 3)
+        sleep(&nfree, &vlock);
+    }
+    b->group = g;
+    if(g)
+      g->pending++;
+
+    h = allocdesc();
+    d = allocdesc();
+    s = allocdesc();
+    vreq[h].type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+    vreq[h].reserved = 0;
+    vreq[h].sector = BDISKNO(b) * (BSIZE/512);
+    vreq[h].sectorhi = 0;
+    vinfo[h].b = b;
+    vinfo[h].status = 0xff;
+
+    desc[h].addr = V2P(&vreq[h]);
+    desc[h].addrhi = 0;
+    desc[h].len = sizeof(vreq[h]);
+    desc[h].flags = VRING_DESC_NEXT;
+    desc[h].next = d;
+
+    desc[d].addr = V2P(b->data);
+    desc[d].addrhi = 0;
+    desc[d].len = BSIZE;
+    desc[d].flags = VRING_DESC_NEXT;
+    if((b->flags & B_DIRTY) == 0)
+      desc[d].flags |= VRING_DESC_WRITE;
+    desc[d].next = s;
+
+    desc[s].addr = V2P(&vinfo[h].status);
+    desc[s].addrhi = 0;
+    desc[s].len = 1;
+    desc[s].flags = VRING_DESC_WRITE;
+    desc[s].next = 0;
+
+    avail->ring[avail->idx % vqsize] = h;
+    __sync_synchronize();  // ring entry before index
+    avail->idx++;
+  }
+  __sync_synchronize();  // index before notify
+  outw(vbase + VIRTIO_QNOTIFY, 0);
+  release(&vlock);
+}
+
+// Wait for all the requests counted in g to finish.
+void
+idewaitgroup(struct iogroup *g)
+{
+  acquire(&vlock);
+  while(g->pending > 0)
+    sleep(g, &vlock);
+  release(&vlock);
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return at once; ideintr() will release
+// the buf with bdone() when the request is done.
+void
+iderw(struct buf *b)
+{
+  struct iogroup g;
+
+  if(b->flags & B_ASYNC){
+    idesubmit(&b, 1, 0);
+    return;
+  }
+  g.pending = 0;
+  idesubmit(&b, 1, &g);
+  idewaitgroup(&g);
+}
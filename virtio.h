@@ -0,0 +1,65 @@
+// Virtio devices, legacy PCI interface.
+// See the virtio specification, version 1.0, sections 2.4
+// (virtqueues), 4.1.4.8 (legacy PCI registers) and 5.2 (block).
+
+#define VIRTIO_VENDOR       0x1af4
+#define VIRTIO_DEV_BLK      0x1001  // transitional block device
+
+// Registers, in the I/O space at BAR 0.
+#define VIRTIO_FEATURES     0x00  // device features (32 bits)
+#define VIRTIO_GUESTFEAT    0x04  // features the driver accepts
+#define VIRTIO_QADDR        0x08  // queue PFN: physical address >> 12
+#define VIRTIO_QSIZE        0x0c  // queue size (16 bits, read-only)
+#define VIRTIO_QSEL         0x0e  // queue select (16 bits)
+#define VIRTIO_QNOTIFY      0x10  // queue notify (16 bits)
+#define VIRTIO_STATUS       0x12  // device status (8 bits)
+#define VIRTIO_ISR          0x13  // interrupt status; read to acknowledge
+
+// Device status bits.
+#define VIRTIO_ST_ACK       1
+#define VIRTIO_ST_DRIVER    2
+#define VIRTIO_ST_DRIVER_OK 4
+#define VIRTIO_ST_FAILED    128
+
+#define VRING_ALIGN         4096  // legacy alignment of the used ring
+
+// A virtqueue descriptor.
+struct vring_desc {
+  uint addr;      // physical address; high 32 bits are addrhi
+  uint addrhi;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+#define VRING_DESC_NEXT     1  // chained with next
+#define VRING_DESC_WRITE    2  // device writes (vs reads)
+
+// The ring of descriptor chains the driver offers the device.
+struct vring_avail {
+  ushort flags;
+  ushort idx;     // where the driver puts the next entry
+  ushort ring[];  // heads of descriptor chains
+};
+
+// The ring of chains the device has finished with.
+struct vring_used_elem {
+  uint id;        // head of the finished chain
+  uint len;
+};
+
+struct vring_used {
+  ushort flags;
+  ushort idx;     // where the device puts the next entry
+  struct vring_used_elem ring[];
+};
+
+// A block device request header, the first descriptor of
+// each request; then comes the data, then a status byte.
+struct virtio_blk_req {
+  uint type;
+  uint reserved;
+  uint sector;    // 512-byte sector; high 32 bits are sectorhi
+  uint sectorhi;
+};
+#define VIRTIO_BLK_T_IN     0  // read
+#define VIRTIO_BLK_T_OUT    1  // write
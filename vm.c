@@ -32,7 +32,7 @@ seginit(void)
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
 // create any required page table pages.
-static pte_t *
+pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
   pde_t *pde;
@@ -57,7 +57,7 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
 // Create PTEs for virtual addresses starting at va that refer to
 // physical addresses starting at pa. va and size might not
 // be page-aligned.
-static int
+int
 mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 {
   char *a, *last;
@@ -101,22 +101,27 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 // (directly addressable from end..P2V(PHYSTOP)).
 
 // This table defines the kernel's mappings, which are present in
-// every process's page table.
+// every process's page table.  They never change, so they are
+// marked global: with CR4_PGE on (see pgeinit), their TLB entries
+// survive the %cr3 reload of a context switch.
 static struct kmap {
   void *virt;
   uint phys_start;
   uint phys_end;
   int perm;
 } kmap[] = {
- { (void*)KERNBASE, 0,             EXTMEM,    PTE_W}, // I/O space
- { (void*)KERNLINK, V2P(KERNLINK), V2P(data), 0},     // kern text+rodata
- { (void*)data,     V2P(data),     PHYSTOP,   PTE_W}, // kern data+memory
- { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
+ { (void*)KERNBASE, 0,             EXTMEM,    PTE_W|PTE_G}, // I/O space
+ { (void*)KERNLINK, V2P(KERNLINK), V2P(data), PTE_G},       // kern text+rodata
+ { (void*)data,     V2P(data),     PHYSTOP,   PTE_W|PTE_G}, // kern data+memory
+ { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W|PTE_G}, // more devices
 };
 
-// Set up kernel part of a page table.
-pde_t*
-setupkvm(void)
+// Build the kernel's own page table, allocating the second-level
+// page tables for the whole kernel half of the address space.
+// Called once, from kvmalloc(); every later page directory
+// shares these page tables (see setupkvm()).
+static pde_t*
+buildkvm(void)
 {
   pde_t *pgdir;
   struct kmap *k;
@@ -128,10 +133,26 @@ setupkvm(void)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
     if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
-      freevm(pgdir);
+                (uint)k->phys_start, k->perm) < 0)
       return 0;
-    }
+  return pgdir;
+}
+
+// Set up kernel part of a page table.
+// The kernel PDEs point at the page tables of kpgdir, which
+// are never freed, so only the page directory itself is new.
+pde_t*
+setupkvm(void)
+{
+  pde_t *pgdir;
+
+  if(kpgdir == 0)
+    panic("setupkvm: no kpgdir");
+  if((pgdir = (pde_t*)kalloc()) == 0)
+    return 0;
+  memset(pgdir, 0, PDX(KERNBASE) * sizeof(pde_t));
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
   return pgdir;
 }
 
@@ -140,8 +161,23 @@ setupkvm(void)
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  if((kpgdir = buildkvm()) == 0)
+    panic("kvmalloc");
   switchkvm();
+  pgeinit();
+}
+
+// Turn on global pages on this CPU, if it has them,
+// so that kernel TLB entries are not flushed by lcr3().
+// Run once on each CPU after it has switched to kpgdir.
+void
+pgeinit(void)
+{
+  uint edx;
+
+  cpuidinfo(1, 0, 0, 0, &edx);
+  if(edx & (1<<13))  // CPUID.1:EDX.PGE
+    lcr4(rcr4() | CR4_PGE);
 }
 
 // Switch h/w page table register to the kernel-only page table,
@@ -152,9 +188,10 @@ switchkvm(void)
   lcr3(V2P(kpgdir));   // switch to the kernel page table
 }
 
-// Switch TSS and h/w page table to correspond to process p.
-void
-switchuvm(struct proc *p)
+// Point this CPU's TSS at p's kernel stack.
+// Must be called with interrupts disabled.
+static void
+switchtss(struct proc *p)
 {
   if(p == 0)
     panic("switchuvm: no process");
@@ -163,7 +200,6 @@ switchuvm(struct proc *p)
   if(p->pgdir == 0)
     panic("switchuvm: no pgdir");
 
-  pushcli();
   mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
                                 sizeof(mycpu()->ts)-1, 0);
   mycpu()->gdt[SEG_TSS].s = 0;
@@ -173,10 +209,33 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
+}
+
+// Switch TSS and h/w page table to correspond to process p.
+void
+switchuvm(struct proc *p)
+{
+  pushcli();
+  switchtss(p);
   lcr3(V2P(p->pgdir));  // switch to process's address space
   popcli();
 }
 
+// Like switchuvm(), for the scheduler.  loaded is the page table
+// this CPU is still running on; if it is already p's, skip the
+// %cr3 reload and the TLB flush that comes with it.  The caller
+// must have held ptable.lock since p last ran on this CPU, so
+// nothing else can have changed or freed p's page table.
+void
+schedswitchuvm(struct proc *p, pde_t *loaded)
+{
+  pushcli();
+  switchtss(p);
+  if(p->pgdir != loaded)
+    lcr3(V2P(p->pgdir));
+  popcli();
+}
+
 // Load the initcode into address 0 of pgdir.
 // sz must be less than a page.
 void
@@ -279,7 +338,8 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part.  The kernel part is shared with kpgdir
+// and must not be freed.
 void
 freevm(pde_t *pgdir)
 {
@@ -287,8 +347,10 @@ freevm(pde_t *pgdir)
 
   if(pgdir == 0)
     panic("freevm: no pgdir");
+  if(pgdir == kpgdir)
+    panic("freevm: kpgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);